@@ -0,0 +1,327 @@
+/**
+ * @file ModelBenchmark.cpp
+ * @brief Source file for the ModelBenchmark tool
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details Compares a model library generated with a float32 or fixed-point
+ * profile (see code_gen_profile.m) against the float64 baseline of the same
+ * model: per-step cost and numerical error of the outputs for the same
+ * input sequence.
+ *
+ * Both libraries shall be generated with static_table = 1, so that the
+ * ports are found without the C-API. The first input and the first output
+ * of the table are used.
+ *
+ * Build (on the target, e.g. the Raspberry Pi):
+ * g++ -O2 -o ModelBenchmark ModelBenchmark.cpp -ldl
+ *
+ * Usage:
+ * ModelBenchmark MODEL BASELINE.so VARIANT.so single|fixed [STEPS] [FRACTION_BITS]
+ * e.g.
+ * ./ModelBenchmark PID ../PID/PID.so ../PID/PID_single.so single 100000
+ * ./ModelBenchmark PID ../PID/PID.so ../PID/PID_fixed.so fixed 100000 16
+ *
+ * The result is printed as CSV:
+ * library,type,ns_per_step,max_abs_error,rms_error,max_abs_baseline
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <dlfcn.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Layout of the entries returned by MODEL_GetStaticTable.
+ */
+struct StaticTableEntry {
+    const char *name;
+    unsigned int kind;
+    void *address;
+    size_t byteSize;
+};
+
+/**
+ * Numeric type of the ports of a model.
+ */
+enum PortType {
+    PORT_DOUBLE, PORT_SINGLE, PORT_FIXED
+};
+
+/**
+ * A loaded model instance.
+ */
+struct Model {
+    void *library;
+    void *instance;
+    void (*step)(void *);
+    PortType type;
+    void *input;
+    uint32_t numberOfInputs;
+    void *output;
+    uint32_t numberOfOutputs;
+};
+
+/**
+ * Number of timed runs. The fastest is reported.
+ */
+const uint32_t MODEL_BENCHMARK_RUNS = 5u;
+
+/**
+ * Maximum number of entries of the static table.
+ */
+const uint32_t MODEL_BENCHMARK_MAX_ENTRIES = 64u;
+
+/**
+ * Scale of the fixed-point ports (2^FRACTION_BITS).
+ */
+double fixedScale = 65536.0;
+
+/**
+ * @brief Gets the size of an element of the ports.
+ */
+uint32_t ElementSize(const PortType type) {
+    return (type == PORT_DOUBLE) ? (8u) : (4u);
+}
+
+/**
+ * @brief Loads a library, allocates and initialises a model instance and
+ * finds its first input and first output.
+ */
+bool Load(const char *modelName, const char *path, const PortType type, Model &model) {
+    model.type = type;
+    model.library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    bool ok = (model.library != NULL);
+    if (!ok) {
+        fprintf(stderr, "Could not open %s: %s\n", path, dlerror());
+    }
+    char symbol[256];
+    void *(*allocate)(void) = NULL;
+    void (*initialize)(void *) = NULL;
+    unsigned int (*getStaticTable)(void *, StaticTableEntry *, unsigned int) = NULL;
+    if (ok) {
+        *reinterpret_cast<void **>(&allocate) = dlsym(model.library, modelName);
+        (void) snprintf(symbol, sizeof(symbol), "%s_initialize", modelName);
+        *reinterpret_cast<void **>(&initialize) = dlsym(model.library, symbol);
+        (void) snprintf(symbol, sizeof(symbol), "%s_step", modelName);
+        *reinterpret_cast<void **>(&model.step) = dlsym(model.library, symbol);
+        (void) snprintf(symbol, sizeof(symbol), "%s_GetStaticTable", modelName);
+        *reinterpret_cast<void **>(&getStaticTable) = dlsym(model.library, symbol);
+        ok = ((allocate != NULL) && (initialize != NULL) && (model.step != NULL) && (getStaticTable != NULL));
+        if (!ok) {
+            fprintf(stderr, "%s shall export %s, %s_initialize, %s_step and %s_GetStaticTable (static_table = 1)\n", path, modelName, modelName,
+                    modelName, modelName);
+        }
+    }
+    if (ok) {
+        model.instance = allocate();
+        ok = (model.instance != NULL);
+    }
+    if (ok) {
+        initialize(model.instance);
+        StaticTableEntry table[MODEL_BENCHMARK_MAX_ENTRIES];
+        unsigned int n = getStaticTable(model.instance, table, MODEL_BENCHMARK_MAX_ENTRIES);
+        model.input = NULL;
+        model.output = NULL;
+        unsigned int i;
+        for (i = 0u; (i < n) && (i < MODEL_BENCHMARK_MAX_ENTRIES); i++) {
+            if ((table[i].kind == 1u) && (model.input == NULL)) {
+                model.input = table[i].address;
+                model.numberOfInputs = static_cast<uint32_t>(table[i].byteSize / ElementSize(type));
+            }
+            if ((table[i].kind == 2u) && (model.output == NULL)) {
+                model.output = table[i].address;
+                model.numberOfOutputs = static_cast<uint32_t>(table[i].byteSize / ElementSize(type));
+            }
+        }
+        ok = ((model.input != NULL) && (model.output != NULL));
+        if (!ok) {
+            fprintf(stderr, "%s has no input or no output in the static table\n", path);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes the input element i of a model.
+ */
+void SetInput(Model &model, const uint32_t i, const double value) {
+    if (model.type == PORT_DOUBLE) {
+        static_cast<double *>(model.input)[i] = value;
+    }
+    else if (model.type == PORT_SINGLE) {
+        static_cast<float *>(model.input)[i] = static_cast<float>(value);
+    }
+    else {
+        static_cast<int32_t *>(model.input)[i] = static_cast<int32_t>(floor((value * fixedScale) + 0.5));
+    }
+}
+
+/**
+ * @brief Reads the output element i of a model.
+ */
+double GetOutput(const Model &model, const uint32_t i) {
+    double value;
+    if (model.type == PORT_DOUBLE) {
+        value = static_cast<double *>(model.output)[i];
+    }
+    else if (model.type == PORT_SINGLE) {
+        value = static_cast<float *>(model.output)[i];
+    }
+    else {
+        value = static_cast<int32_t *>(model.output)[i] / fixedScale;
+    }
+    return value;
+}
+
+/**
+ * @brief The input sequence: two tones, shifted for each element.
+ */
+double Stimulus(const uint32_t step, const uint32_t element) {
+    double k = static_cast<double>(step);
+    double phase = 0.5 * static_cast<double>(element);
+    return (0.8 * sin((2.0 * M_PI * k / 1000.0) + phase)) + (0.1 * sin((2.0 * M_PI * k / 37.0) + phase));
+}
+
+/**
+ * @brief Times the model steps, with the input update.
+ * @param[in] stimulus the precomputed input of each step.
+ * @return the fastest time per step in ns.
+ */
+double Time(Model &model, const double * const stimulus, const uint32_t steps) {
+    double best = 0.0;
+    uint32_t run;
+    for (run = 0u; run < MODEL_BENCHMARK_RUNS; run++) {
+        struct timespec start;
+        struct timespec end;
+        (void) clock_gettime(CLOCK_MONOTONIC, &start);
+        uint32_t k;
+        for (k = 0u; k < steps; k++) {
+            SetInput(model, 0u, stimulus[k]);
+            model.step(model.instance);
+        }
+        (void) clock_gettime(CLOCK_MONOTONIC, &end);
+        double elapsed = (static_cast<double>(end.tv_sec - start.tv_sec) * 1e9) + static_cast<double>(end.tv_nsec - start.tv_nsec);
+        elapsed /= static_cast<double>(steps);
+        if ((run == 0u) || (elapsed < best)) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+int main(int argc, char **argv) {
+    bool ok = (argc >= 5);
+    if (!ok) {
+        fprintf(stderr, "Usage: %s MODEL BASELINE.so VARIANT.so single|fixed [STEPS] [FRACTION_BITS]\n", argv[0]);
+    }
+    PortType variantType = PORT_SINGLE;
+    uint32_t steps = 100000u;
+    if (ok) {
+        if (strcmp(argv[4], "fixed") == 0) {
+            variantType = PORT_FIXED;
+        }
+        else {
+            ok = (strcmp(argv[4], "single") == 0);
+            if (!ok) {
+                fprintf(stderr, "The type shall be single or fixed\n");
+            }
+        }
+        if (argc > 5) {
+            steps = static_cast<uint32_t>(strtoul(argv[5], NULL, 10));
+        }
+        if (argc > 6) {
+            fixedScale = ldexp(1.0, atoi(argv[6]));
+        }
+        ok = (ok && (steps > 0u));
+    }
+    Model baseline;
+    Model variant;
+    if (ok) {
+        ok = Load(argv[1], argv[2], PORT_DOUBLE, baseline);
+    }
+    if (ok) {
+        ok = Load(argv[1], argv[3], variantType, variant);
+    }
+    if (ok) {
+        ok = ((baseline.numberOfInputs == variant.numberOfInputs) && (baseline.numberOfOutputs == variant.numberOfOutputs));
+        if (!ok) {
+            fprintf(stderr, "The two libraries have different ports\n");
+        }
+    }
+    if (ok) {
+        //Numerical error, with both models fed by the same sequence.
+        double maxError = 0.0;
+        double sumSquaredError = 0.0;
+        double maxBaseline = 0.0;
+        uint32_t k;
+        for (k = 0u; k < steps; k++) {
+            uint32_t i;
+            for (i = 0u; i < baseline.numberOfInputs; i++) {
+                double value = Stimulus(k, i);
+                SetInput(baseline, i, value);
+                SetInput(variant, i, value);
+            }
+            baseline.step(baseline.instance);
+            variant.step(variant.instance);
+            for (i = 0u; i < baseline.numberOfOutputs; i++) {
+                double reference = GetOutput(baseline, i);
+                double error = fabs(GetOutput(variant, i) - reference);
+                sumSquaredError += error * error;
+                if (error > maxError) {
+                    maxError = error;
+                }
+                if (fabs(reference) > maxBaseline) {
+                    maxBaseline = fabs(reference);
+                }
+            }
+        }
+        double rmsError = sqrt(sumSquaredError / (static_cast<double>(steps) * baseline.numberOfOutputs));
+        //Cost per step.
+        double *stimulus = new double[steps];
+        for (k = 0u; k < steps; k++) {
+            stimulus[k] = Stimulus(k, 0u);
+        }
+        double baselineTime = Time(baseline, stimulus, steps);
+        double variantTime = Time(variant, stimulus, steps);
+        delete[] stimulus;
+        printf("library,type,ns_per_step,max_abs_error,rms_error,max_abs_baseline\n");
+        printf("%s,double,%.2f,0,0,%g\n", argv[2], baselineTime, maxBaseline);
+        printf("%s,%s,%.2f,%g,%g,%g\n", argv[3], argv[4], variantTime, maxError, rmsError, maxBaseline);
+    }
+    return (ok) ? (0) : (1);
+}
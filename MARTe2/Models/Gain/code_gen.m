@@ -12,32 +12,30 @@ set_param(model_name, 'GlobalVariableUsage', 'None');
 set_param(model_name, 'GenerateReport', 0);
 % Comments
 set_param(model_name, 'GenerateComments', 0);
-% Custom code (MODEL is a coder varialbe for the model name)
-set_param(model_name, 'CustomSourceCode', ...
-[ ...
-'#define CONCAT(str1, str2, str3) CONCAT_(str1, str2, str3)' newline, ...
-'#define CONCAT_(str1, str2, str3) str1 ## str2 ## str3' newline, ...
-'#define GET_MMI_FUNC CONCAT(MODEL, _GetCAPImmi , )' newline, ...
-'#define RT_MODEL_STRUCT CONCAT(RT_MODEL_ , MODEL, _T)' newline, ...
-newline, ...
-'void* GET_MMI_FUNC(void* voidPtrToRealTimeStructure)' newline, ...
-'{' newline, ...
-'rtwCAPI_ModelMappingInfo* mmiPtr = &(rtmGetDataMapInfo( ( RT_MODEL_STRUCT *)(voidPtrToRealTimeStructure) ).mmi);' newline, ...
-'return (void*) mmiPtr;' newline, ...
-'}' ...
-] ...
-);
+% Static parameter/IO table (see ../code_gen_static_table.m)
+static_table = 0;
+static_parameters = {'Param1'};
+static_inputs = {'Input1'};
+static_outputs = {'Output1'};
+% Numeric profile and target (see ../code_gen_profile.m)
+profile = 'double';
+target = 'host';
+% Custom code (see ../code_gen_static_table.m)
+addpath('..');
+set_param(model_name, 'CustomSourceCode', code_gen_static_table(static_table, static_parameters, static_inputs, static_outputs));
 % Interface
 set_param(model_name, 'SupportComplex', 0);
 set_param(model_name, 'SupportAbsoluteTime', 0);
 set_param(model_name, 'SuppressErrorStatus', 1);
 set_param(model_name, 'CodeInterfacePackaging', 'Reusable function');
 set_param(model_name, 'RootIOFormat', 'Part of model data structure');
-set_param(model_name, 'RTWCAPIParams', 1);
-set_param(model_name, 'RTWCAPIRootIO', 1);
+set_param(model_name, 'RTWCAPIParams', double(~static_table));
+set_param(model_name, 'RTWCAPIRootIO', double(~static_table));
 set_param(model_name, 'GenerateAllocFcn', 1);
 set_param(model_name, 'IncludeMdlTerminateFcn', 0);
 set_param(model_name, 'CombineSignalStateStructs', 1);
 set_param(model_name, 'ArrayLayout', 'Column-major');
 % Templates
 set_param(model_name, 'GenerateSampleERTMain', 0);
+% Profile
+code_gen_profile(model_name, profile, target);
@@ -0,0 +1,89 @@
+function code_gen_profile(model_name, profile, target)
+% CODE_GEN_PROFILE Sets the numeric type and the compiler flags of a model.
+%   Called at the end of the Models/*/code_gen.m scripts.
+%
+%   profile:
+%     'double' - float64 (the model as it is saved). Signals Type = float64.
+%     'single' - float32. Signals Type = float32.
+%     'fixed'  - Q-format fixed point, fixdt(1, 32, 16) (i.e. Q15.16, with
+%                saturation and round to nearest). Signals Type = int32,
+%                holding value * 2^16. Requires Fixed-Point Designer.
+%   target:
+%     'host'   - the toolchain defaults.
+%     'armv8'  - Raspberry Pi 3/4 with the 'Raspberry Pi (64-bit Linux)'
+%                toolchain (MATLAB/Toolchains, run register_tc first).
+%                Despite its name the toolchain is arm-linux-gnueabihf, so
+%                the code is built for 32-bit ARMv8 (AArch32, hard float),
+%                with -mcpu, -mfpu and -mfloat-abi set for the Cortex-A72
+%                NEON unit. The flags are appended to the 'Faster Runs'
+%                options of the toolchain (-O3 -fno-loop-optimize).
+%
+%   Every block with an output, parameter, state or accumulator data type
+%   is set to the profile type, so that the whole step runs in that type.
+%   The generated library keeps the model name: rename it after the build
+%   (e.g. PID.so -> PID_single.so) to keep several profiles side by side
+%   for Benchmark/ModelBenchmark.
+
+% Profile
+switch profile
+    case 'double'
+        data_type = '';
+    case 'single'
+        data_type = 'single';
+    case 'fixed'
+        word_length = 32;
+        fraction_length = 16;
+        data_type = sprintf('fixdt(1, %d, %d)', word_length, fraction_length);
+    otherwise
+        error('code_gen_profile:profile', 'Unknown profile %s', profile);
+end
+if ~isempty(data_type)
+    type_parameters = {'OutDataTypeStr', 'ParamDataTypeStr', 'StateDataTypeStr', ...
+        'AccumDataTypeStr', 'ProductDataTypeStr', 'InitialConditionDataTypeStr'};
+    blocks = find_system(model_name, 'LookUnderMasks', 'all', 'FollowLinks', 'on', 'Type', 'Block');
+    for i = 1:numel(blocks)
+        block_parameters = get_param(blocks{i}, 'ObjectParameters');
+        for j = 1:numel(type_parameters)
+            if isfield(block_parameters, type_parameters{j})
+                set_param(blocks{i}, type_parameters{j}, data_type);
+            end
+        end
+        if strcmp(profile, 'fixed')
+            if isfield(block_parameters, 'SaturateOnIntegerOverflow')
+                set_param(blocks{i}, 'SaturateOnIntegerOverflow', 'on');
+            end
+            if isfield(block_parameters, 'RndMeth')
+                set_param(blocks{i}, 'RndMeth', 'Nearest');
+            end
+        end
+    end
+end
+% Target
+switch target
+    case 'host'
+        c_flags = '';
+    case 'armv8'
+        set_param(model_name, 'ProdHWDeviceType', 'ARM Compatible->ARM Cortex');
+        set_param(model_name, 'Toolchain', 'Raspberry Pi (64-bit Linux)');
+        c_flags = '-mcpu=cortex-a72 -mfpu=neon-fp-armv8 -mfloat-abi=hard';
+        if strcmp(profile, 'single')
+            % The AArch32 NEON unit is not IEEE compliant (flush to zero),
+            % so gcc only vectorises float32 with unsafe math. This also
+            % allows the reductions (sums of products) to be reordered.
+            c_flags = [c_flags ' -funsafe-math-optimizations'];
+        end
+    otherwise
+        error('code_gen_profile:target', 'Unknown target %s', target);
+end
+if ~isempty(c_flags)
+    % Specify starts from the options of the previous configuration
+    set_param(model_name, 'BuildConfiguration', 'Faster Runs');
+    set_param(model_name, 'BuildConfiguration', 'Specify');
+    toolchain_options = get_param(model_name, 'CustomToolchainOptions');
+    index = find(strcmp(toolchain_options, 'C Compiler'));
+    if ~isempty(index)
+        toolchain_options{index + 1} = [toolchain_options{index + 1} ' ' c_flags];
+        set_param(model_name, 'CustomToolchainOptions', toolchain_options);
+    end
+end
+end
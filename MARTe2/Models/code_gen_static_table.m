@@ -0,0 +1,64 @@
+function custom_code = code_gen_static_table(static_table, static_parameters, static_inputs, static_outputs)
+% CODE_GEN_STATIC_TABLE Returns the CustomSourceCode of a model.
+%   Called by the Models/*/code_gen.m scripts.
+%
+%   static_table = 0: the model exports MODEL_GetCAPImmi, which returns
+%   the C-API model mapping info (see SimulinkWrapperGAM).
+%   static_table = 1: the C-API string tables are not generated and the
+%   model exports MODEL_GetStaticTable, which returns the address and size
+%   of each of the static_parameters, static_inputs and static_outputs
+%   (cell arrays of names, see SimulinkStaticWrapperGAM).
+%
+%   MODEL is a coder variable for the model name.
+
+custom_code = [ ...
+'#define CONCAT(str1, str2, str3) CONCAT_(str1, str2, str3)' newline, ...
+'#define CONCAT_(str1, str2, str3) str1 ## str2 ## str3' newline, ...
+'#define RT_MODEL_STRUCT CONCAT(RT_MODEL_ , MODEL, _T)' newline, ...
+newline ...
+];
+if static_table
+    entries = '';
+    for i = 1:numel(static_parameters)
+        entries = [entries sprintf('{"%s", 0u, (void *) &(m->defaultParam->%s), sizeof(m->defaultParam->%s)},\n', ...
+            static_parameters{i}, static_parameters{i}, static_parameters{i})];
+    end
+    for i = 1:numel(static_inputs)
+        entries = [entries sprintf('{"%s", 1u, (void *) &(m->inputs->%s), sizeof(m->inputs->%s)},\n', ...
+            static_inputs{i}, static_inputs{i}, static_inputs{i})];
+    end
+    for i = 1:numel(static_outputs)
+        entries = [entries sprintf('{"%s", 2u, (void *) &(m->outputs->%s), sizeof(m->outputs->%s)},\n', ...
+            static_outputs{i}, static_outputs{i}, static_outputs{i})];
+    end
+    custom_code = [custom_code ...
+    '#include <stddef.h>' newline, ...
+    '#define GET_STATIC_TABLE_FUNC CONCAT(MODEL, _GetStaticTable , )' newline, ...
+    'typedef struct { const char *name; unsigned int kind; void *address; size_t byteSize; } StaticTableEntry;' newline, ...
+    newline, ...
+    'unsigned int GET_STATIC_TABLE_FUNC(void* voidPtrToRealTimeStructure, StaticTableEntry *table, unsigned int size)' newline, ...
+    '{' newline, ...
+    'RT_MODEL_STRUCT *m = (RT_MODEL_STRUCT *)(voidPtrToRealTimeStructure);' newline, ...
+    'StaticTableEntry entries[] = {' newline, ...
+    entries, ...
+    '};' newline, ...
+    'unsigned int n = (unsigned int) (sizeof(entries) / sizeof(entries[0]));' newline, ...
+    'unsigned int i;' newline, ...
+    'for (i = 0u; (table != NULL) && (i < n) && (i < size); i++) {' newline, ...
+    'table[i] = entries[i];' newline, ...
+    '}' newline, ...
+    'return n;' newline, ...
+    '}' ...
+    ];
+else
+    custom_code = [custom_code ...
+    '#define GET_MMI_FUNC CONCAT(MODEL, _GetCAPImmi , )' newline, ...
+    newline, ...
+    'void* GET_MMI_FUNC(void* voidPtrToRealTimeStructure)' newline, ...
+    '{' newline, ...
+    'rtwCAPI_ModelMappingInfo* mmiPtr = &(rtmGetDataMapInfo( ( RT_MODEL_STRUCT *)(voidPtrToRealTimeStructure) ).mmi);' newline, ...
+    'return (void*) mmiPtr;' newline, ...
+    '}' ...
+    ];
+end
+end
@@ -0,0 +1,706 @@
+/**
+ * @file CycleJitterBenchmark.cpp
+ * @brief Source file for the CycleJitterBenchmark tool
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details Runs one state of the RealTimeApplication of CFG_FILE, headless,
+ * for DURATION_S seconds and measures the jitter of its real-time threads.
+ *
+ * Before the application is initialised, a CycleJitterGAM is appended to the
+ * Functions of every thread of the state. It reads, from the
+ * TimingDataSource of the GAMScheduler, the cycle time of the thread
+ * (State.Thread_CycleTime) and the execution time of each of its GAMs
+ * (GAM_ExecTime). Optionally, the SleepNature of all the LinuxTimer data
+ * sources and the CPUs of all the threads of the state are overridden, so
+ * that the same configuration can be compared with SleepNature = Busy and
+ * Default and with different CPU masks. The machine (e.g. x86_64 or aarch64)
+ * is recorded in every line.
+ *
+ * The period of a thread is the inverse of the Frequency of the first input
+ * signal of its GAMs that sets one (the timer); if there is none, the median
+ * cycle time is used. A sample misses the deadline if it is larger than the
+ * period plus DEADLINE_TOLERANCE (at the resolution of the BinWidth of the
+ * histograms). The execution time of a GAM is compared with the same
+ * deadline.
+ *
+ * The state is selected by STATE; if not set, the state whose threads have
+ * the most GAMs is run. The state is prepared and started as the
+ * RealTimeLoader does with -s, so that StateMachine objects are not
+ * triggered; the data sources still need their peers (e.g. the SDN
+ * publisher, the OPC UA server or the MDSplus trees).
+ *
+ * Build: make -f Makefile.gcc (built with the other components).
+ *
+ * Usage (with the LD_LIBRARY_PATH of MARTeApp.sh, see JitterBenchmark.sh):
+ * CycleJitterBenchmark.ex CFG_FILE DURATION_S CSV_FILE HISTOGRAM_FILE [SLEEP_NATURE|-] [CPUS|-] [STATE]
+ * e.g.
+ * ./CycleJitterBenchmark.ex RTApp-Log.cfg 60 jitter.csv jitter_hist.csv Busy 0x8
+ *
+ * For every sampled signal one line is appended to CSV_FILE (with a header
+ * if the file is empty) and printed on the standard output:
+ * arch,config,state,thread,signal,sleep_nature,cpus,duration_s,period_us,
+ * deadline_us,samples,mean_us,p50_us,p99_us,p999_us,max_us,missed
+ *
+ * The non-empty bins of the histograms are appended to HISTOGRAM_FILE:
+ * arch,config,state,thread,signal,sleep_nature,cpus,bin_us,count
+ *
+ * The errors of the framework are printed on the standard error.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/utsname.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "CycleJitterGAM.h"
+#include "File.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * A sample misses the deadline if it exceeds the period by more than this.
+ */
+const MARTe::float64 DEADLINE_TOLERANCE = 0.1;
+
+/**
+ * Prefix of the name of the injected CycleJitterGAMs.
+ */
+const MARTe::char8 * const CYCLE_JITTER_GAM_PREFIX = "CycleJitter";
+
+/**
+ * Value of the optional arguments which keeps the configuration as is.
+ */
+const MARTe::char8 * const KEEP_CONFIGURATION = "-";
+
+/**
+ * @brief Prints the errors of the framework on the standard error.
+ */
+void BenchmarkErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                   const MARTe::char8 * const errorDescription) {
+    fprintf(stderr, "[%s:%d] %s\n", errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+/**
+ * @brief Removes the + or $ of the name of a configuration node.
+ * @return the name of the object.
+ */
+const MARTe::char8 *ObjectName(const MARTe::char8 * const nodeName) {
+    const MARTe::char8 *name = nodeName;
+    if ((name[0] == '+') || (name[0] == '$')) {
+        name = &name[1];
+    }
+    return name;
+}
+
+/**
+ * @brief Reads the Class of the child of the current node.
+ * @return true if the child is a node with the given Class.
+ */
+bool ChildIsA(MARTe::ConfigurationDatabase &cdb,
+              const MARTe::char8 * const childName,
+              const MARTe::char8 * const className) {
+    MARTe::StreamString childClass;
+    bool isA = cdb.MoveRelative(childName);
+    if (isA) {
+        isA = cdb.Read("Class", childClass);
+        if (isA) {
+            isA = (childClass == className);
+        }
+        (void) cdb.MoveToAncestor(1u);
+    }
+    return isA;
+}
+
+/**
+ * @brief Finds the (first) RealTimeApplication of the configuration.
+ * @return true if there is one.
+ */
+bool FindApplication(MARTe::ConfigurationDatabase &cdb,
+                     MARTe::StreamString &appNode) {
+    using namespace MARTe;
+    bool found = false;
+    bool ok = cdb.MoveToRoot();
+    uint32 n = cdb.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; (i < n) && (ok) && (!found); i++) {
+        appNode = cdb.GetChildName(i);
+        found = ChildIsA(cdb, appNode.Buffer(), "RealTimeApplication");
+    }
+    return found;
+}
+
+/**
+ * @brief Overrides the SleepNature of all the LinuxTimer data sources.
+ * @return true if the configuration could be written.
+ */
+bool OverrideSleepNature(MARTe::ConfigurationDatabase &cdb,
+                         const MARTe::StreamString &appNode,
+                         const MARTe::char8 * const sleepNature) {
+    using namespace MARTe;
+    StreamString path;
+    bool ok = path.Printf("%s.+Data", appNode.Buffer());
+    if (ok) {
+        ok = cdb.MoveAbsolute(path.Buffer());
+    }
+    uint32 n = (ok) ? (cdb.GetNumberOfChildren()) : (0u);
+    uint32 i;
+    for (i = 0u; (i < n) && (ok); i++) {
+        StreamString dataSource = cdb.GetChildName(i);
+        if (ChildIsA(cdb, dataSource.Buffer(), "LinuxTimer")) {
+            ok = cdb.MoveRelative(dataSource.Buffer());
+            if (ok) {
+                (void) cdb.Delete("SleepNature");
+                ok = cdb.Write("SleepNature", sleepNature);
+            }
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the number of functions of a thread.
+ * @return the number of elements of the Functions of the thread (0 if none).
+ */
+MARTe::uint32 NumberOfFunctions(MARTe::ConfigurationDatabase &cdb,
+                                const MARTe::char8 * const threadPath) {
+    using namespace MARTe;
+    uint32 n = 0u;
+    if (cdb.MoveAbsolute(threadPath)) {
+        AnyType functions = cdb.GetType("Functions");
+        if (!functions.IsVoid()) {
+            n = functions.GetNumberOfElements(0u);
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Selects the state whose threads have the most functions.
+ * @return true if the application has at least one state with functions.
+ */
+bool SelectState(MARTe::ConfigurationDatabase &cdb,
+                 const MARTe::StreamString &appNode,
+                 MARTe::StreamString &stateNode) {
+    using namespace MARTe;
+    StreamString statesPath;
+    bool ok = statesPath.Printf("%s.+States", appNode.Buffer());
+    if (ok) {
+        ok = cdb.MoveAbsolute(statesPath.Buffer());
+    }
+    uint32 numberOfStates = (ok) ? (cdb.GetNumberOfChildren()) : (0u);
+    uint32 most = 0u;
+    uint32 s;
+    for (s = 0u; (s < numberOfStates) && (ok); s++) {
+        ok = cdb.MoveAbsolute(statesPath.Buffer());
+        StreamString candidate;
+        StreamString threadsPath;
+        if (ok) {
+            candidate = cdb.GetChildName(s);
+            ok = threadsPath.Printf("%s.%s.+Threads", statesPath.Buffer(), candidate.Buffer());
+        }
+        uint32 numberOfThreads = 0u;
+        if (ok) {
+            if (cdb.MoveAbsolute(threadsPath.Buffer())) {
+                numberOfThreads = cdb.GetNumberOfChildren();
+            }
+        }
+        uint32 functions = 0u;
+        uint32 t;
+        for (t = 0u; (t < numberOfThreads) && (ok); t++) {
+            StreamString threadPath;
+            ok = cdb.MoveAbsolute(threadsPath.Buffer());
+            if (ok) {
+                ok = threadPath.Printf("%s.%s", threadsPath.Buffer(), cdb.GetChildName(t));
+            }
+            if (ok) {
+                functions += NumberOfFunctions(cdb, threadPath.Buffer());
+            }
+        }
+        if (functions > most) {
+            most = functions;
+            stateNode = candidate;
+        }
+    }
+    return (ok) && (most > 0u);
+}
+
+/**
+ * @brief Gets the period set by the Frequency of an input signal of a GAM.
+ * @return the period in microseconds (0 if the GAM sets no Frequency).
+ */
+MARTe::float64 FunctionPeriod(MARTe::ConfigurationDatabase &cdb,
+                              const MARTe::StreamString &appNode,
+                              const MARTe::StreamString &function) {
+    using namespace MARTe;
+    float64 period = 0.0;
+    StreamString path;
+    bool ok = path.Printf("%s.+Functions.+%s.InputSignals", appNode.Buffer(), function.Buffer());
+    if (ok) {
+        ok = cdb.MoveAbsolute(path.Buffer());
+    }
+    uint32 n = (ok) ? (cdb.GetNumberOfChildren()) : (0u);
+    uint32 i;
+    for (i = 0u; (i < n) && (period <= 0.0); i++) {
+        if (cdb.MoveToChild(i)) {
+            float32 frequency = 0.0F;
+            if (cdb.Read("Frequency", frequency)) {
+                if (frequency > 0.0F) {
+                    period = 1e6 / static_cast<float64>(frequency);
+                }
+            }
+            (void) cdb.MoveToAncestor(1u);
+        }
+    }
+    return period;
+}
+
+/**
+ * @brief Appends a CycleJitterGAM, which samples the cycle time of the thread
+ * and the execution time of its GAMs, to the Functions of a thread and,
+ * optionally, overrides the CPUs of the thread.
+ * @param[out] gamName the name of the CycleJitterGAM.
+ * @param[out] period the period of the thread (0 if unknown).
+ * @return true if the configuration could be written.
+ */
+bool InstrumentThread(MARTe::ConfigurationDatabase &cdb,
+                      const MARTe::StreamString &appNode,
+                      const MARTe::StreamString &stateNode,
+                      const MARTe::StreamString &threadNode,
+                      const MARTe::StreamString &timings,
+                      const MARTe::char8 * const cpus,
+                      MARTe::StreamString &gamName,
+                      MARTe::float64 &period) {
+    using namespace MARTe;
+    period = 0.0;
+    StreamString threadPath;
+    bool ok = threadPath.Printf("%s.+States.%s.+Threads.%s", appNode.Buffer(), stateNode.Buffer(), threadNode.Buffer());
+    uint32 n = 0u;
+    if (ok) {
+        n = NumberOfFunctions(cdb, threadPath.Buffer());
+        ok = (n > 0u);
+    }
+    StreamString *functions = NULL_PTR(StreamString *);
+    if (ok) {
+        functions = new StreamString[n + 1u];
+        Vector<StreamString> functionsVector(functions, n);
+        ok = cdb.Read("Functions", functionsVector);
+    }
+    if (ok) {
+        if (cpus != NULL_PTR(const char8 *)) {
+            uint32 cpuMask = static_cast<uint32>(strtoul(cpus, NULL, 0));
+            (void) cdb.Delete("CPUs");
+            ok = cdb.Write("CPUs", cpuMask);
+        }
+    }
+    if (ok) {
+        ok = gamName.Printf("%s%s", CYCLE_JITTER_GAM_PREFIX, ObjectName(threadNode.Buffer()));
+    }
+    if (ok) {
+        functions[n] = gamName;
+        Vector<StreamString> functionsVector(functions, n + 1u);
+        (void) cdb.Delete("Functions");
+        ok = cdb.Write("Functions", functionsVector);
+    }
+    //The CycleJitterGAM
+    StreamString inputsPath;
+    if (ok) {
+        ok = inputsPath.Printf("%s.+Functions.+%s.InputSignals", appNode.Buffer(), gamName.Buffer());
+    }
+    if (ok) {
+        ok = cdb.CreateAbsolute(inputsPath.Buffer());
+    }
+    if (ok) {
+        ok = cdb.CreateRelative("CycleTime");
+    }
+    StreamString alias;
+    if (ok) {
+        ok = alias.Printf("%s.%s_CycleTime", ObjectName(stateNode.Buffer()), ObjectName(threadNode.Buffer()));
+    }
+    if (ok) {
+        ok = cdb.Write("DataSource", timings.Buffer());
+    }
+    if (ok) {
+        ok = cdb.Write("Type", "uint32");
+    }
+    if (ok) {
+        ok = cdb.Write("Alias", alias.Buffer());
+    }
+    StreamString functionsPath;
+    if (ok) {
+        ok = functionsPath.Printf("%s.+Functions", appNode.Buffer());
+    }
+    uint32 i;
+    for (i = 0u; (i < n) && (ok); i++) {
+        //Only the GAMs directly declared in Functions have an execution time
+        bool isGAM = (functions[i].Locate(".") < 0);
+        if (isGAM) {
+            StreamString functionNode;
+            ok = cdb.MoveAbsolute(functionsPath.Buffer());
+            if (ok) {
+                ok = functionNode.Printf("+%s", functions[i].Buffer());
+            }
+            if (ok) {
+                isGAM = !ChildIsA(cdb, functionNode.Buffer(), "ReferenceContainer");
+            }
+        }
+        if ((ok) && (isGAM)) {
+            StreamString signalName;
+            ok = signalName.Printf("%s_ExecTime", functions[i].Buffer());
+            if (ok) {
+                ok = cdb.MoveAbsolute(inputsPath.Buffer());
+            }
+            if (ok) {
+                ok = cdb.CreateRelative(signalName.Buffer());
+            }
+            if (ok) {
+                ok = cdb.Write("DataSource", timings.Buffer());
+            }
+            if (ok) {
+                ok = cdb.Write("Type", "uint32");
+            }
+            if ((ok) && (period <= 0.0)) {
+                period = FunctionPeriod(cdb, appNode, functions[i]);
+            }
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute(inputsPath.Buffer());
+    }
+    if (ok) {
+        ok = cdb.MoveToAncestor(1u);
+    }
+    if (ok) {
+        ok = cdb.Write("Class", "CycleJitterGAM");
+    }
+    if (functions != NULL_PTR(StreamString *)) {
+        delete[] functions;
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets a percentile from a histogram.
+ * @return the upper edge of the bin of the nearest-rank percentile, bounded
+ * by the maximum, or -1 if there are no samples.
+ */
+MARTe::float64 HistogramPercentile(const MARTe::ReferenceT<MARTe2Tutorial::CycleJitterGAM> &gam,
+                                   const MARTe::uint32 signalIdx,
+                                   const MARTe::float64 p) {
+    using namespace MARTe;
+    float64 value = -1.0;
+    uint32 samples = gam->GetNumberOfSamples();
+    if (samples > 0u) {
+        uint32 rank = static_cast<uint32>((p * static_cast<float64>(samples)) + 0.999999);
+        if (rank < 1u) {
+            rank = 1u;
+        }
+        if (rank > samples) {
+            rank = samples;
+        }
+        const uint32 *histogram = gam->GetHistogram(signalIdx);
+        uint32 bins = gam->GetNumberOfBins();
+        uint32 count = 0u;
+        uint32 b = 0u;
+        while ((b < bins) && (count < rank)) {
+            count += histogram[b];
+            b++;
+        }
+        value = static_cast<float64>(b * gam->GetBinWidth());
+        float64 maximum = static_cast<float64>(gam->GetMaximum(signalIdx));
+        if (value > maximum) {
+            value = maximum;
+        }
+    }
+    return value;
+}
+
+/**
+ * @brief Opens a CSV file to append, writing the header if it is empty.
+ * @return the file or NULL if it cannot be opened.
+ */
+FILE *OpenCSV(const MARTe::char8 * const fileName,
+              const MARTe::char8 * const header) {
+    FILE *csv = fopen(fileName, "a");
+    if (csv != NULL) {
+        (void) fseek(csv, 0, SEEK_END);
+        if (ftell(csv) == 0) {
+            fprintf(csv, "%s\n", header);
+        }
+    }
+    else {
+        fprintf(stderr, "Could not open %s\n", fileName);
+    }
+    return csv;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+int main(int argc,
+         char **argv) {
+    using namespace MARTe;
+    using namespace MARTe2Tutorial;
+    ErrorManagement::SetErrorProcessFunction(&BenchmarkErrorProcessFunction);
+    bool ok = (argc >= 5);
+    if (!ok) {
+        fprintf(stderr, "Usage: %s CFG_FILE DURATION_S CSV_FILE HISTOGRAM_FILE [SLEEP_NATURE|-] [CPUS|-] [STATE]\n", argv[0]);
+    }
+    uint32 duration = 0u;
+    const char8 *sleepNature = NULL_PTR(const char8 *);
+    const char8 *cpus = NULL_PTR(const char8 *);
+    StreamString stateNode;
+    if (ok) {
+        duration = static_cast<uint32>(strtoul(argv[2], NULL, 10));
+        if (argc > 5) {
+            if (StringHelper::Compare(argv[5], KEEP_CONFIGURATION) != 0) {
+                sleepNature = argv[5];
+            }
+        }
+        if (argc > 6) {
+            if (StringHelper::Compare(argv[6], KEEP_CONFIGURATION) != 0) {
+                cpus = argv[6];
+            }
+        }
+        if (argc > 7) {
+            ok = stateNode.Printf("+%s", argv[7]);
+        }
+        if (duration == 0u) {
+            ok = false;
+            fprintf(stderr, "DURATION_S shall be > 0\n");
+        }
+    }
+    struct utsname machine;
+    if (ok) {
+        ok = (uname(&machine) == 0);
+    }
+    //Parse and instrument the configuration
+    ConfigurationDatabase cdb;
+    if (ok) {
+        File cfgFile;
+        ok = cfgFile.Open(argv[1], File::ACCESS_MODE_R);
+        if (ok) {
+            ok = cfgFile.Seek(0LLU);
+        }
+        if (ok) {
+            StreamString err;
+            StandardParser parser(cfgFile, cdb, &err);
+            ok = parser.Parse();
+            if (!ok) {
+                fprintf(stderr, "Could not parse %s: %s\n", argv[1], err.Buffer());
+            }
+        }
+        else {
+            fprintf(stderr, "Could not open %s\n", argv[1]);
+        }
+        (void) cfgFile.Close();
+    }
+    StreamString appNode;
+    if (ok) {
+        ok = FindApplication(cdb, appNode);
+        if (!ok) {
+            fprintf(stderr, "No RealTimeApplication in %s\n", argv[1]);
+        }
+    }
+    StreamString timings;
+    if (ok) {
+        StreamString schedulerPath;
+        ok = schedulerPath.Printf("%s.+Scheduler", appNode.Buffer());
+        if (ok) {
+            ok = cdb.MoveAbsolute(schedulerPath.Buffer());
+        }
+        if (ok) {
+            ok = cdb.Read("TimingDataSource", timings);
+        }
+        if (!ok) {
+            fprintf(stderr, "The Scheduler shall set a TimingDataSource\n");
+        }
+    }
+    if ((ok) && (sleepNature != NULL_PTR(const char8 *))) {
+        ok = OverrideSleepNature(cdb, appNode, sleepNature);
+    }
+    if ((ok) && (stateNode.Size() == 0u)) {
+        ok = SelectState(cdb, appNode, stateNode);
+        if (!ok) {
+            fprintf(stderr, "No state with functions\n");
+        }
+    }
+    StreamString threadsPath;
+    uint32 numberOfThreads = 0u;
+    if (ok) {
+        ok = threadsPath.Printf("%s.+States.%s.+Threads", appNode.Buffer(), stateNode.Buffer());
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute(threadsPath.Buffer());
+        if (ok) {
+            numberOfThreads = cdb.GetNumberOfChildren();
+            ok = (numberOfThreads > 0u);
+        }
+        if (!ok) {
+            fprintf(stderr, "The state %s has no threads\n", ObjectName(stateNode.Buffer()));
+        }
+    }
+    StreamString *threadNodes = NULL_PTR(StreamString *);
+    StreamString *gamNames = NULL_PTR(StreamString *);
+    float64 *periods = NULL_PTR(float64 *);
+    if (ok) {
+        threadNodes = new StreamString[numberOfThreads];
+        gamNames = new StreamString[numberOfThreads];
+        periods = new float64[numberOfThreads];
+    }
+    uint32 t;
+    for (t = 0u; (t < numberOfThreads) && (ok); t++) {
+        ok = cdb.MoveAbsolute(threadsPath.Buffer());
+        if (ok) {
+            threadNodes[t] = cdb.GetChildName(t);
+            ok = InstrumentThread(cdb, appNode, stateNode, threadNodes[t], timings, cpus, gamNames[t], periods[t]);
+        }
+    }
+    //Run the state
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = ord->Initialise(cdb);
+        if (!ok) {
+            fprintf(stderr, "Could not initialise %s\n", argv[1]);
+        }
+    }
+    if (ok) {
+        application = ord->Find(ObjectName(appNode.Buffer()));
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+        if (!ok) {
+            fprintf(stderr, "Could not configure the application\n");
+        }
+    }
+    if (ok) {
+        ok = (application->PrepareNextState(ObjectName(stateNode.Buffer())) == ErrorManagement::NoError);
+        if (!ok) {
+            fprintf(stderr, "Could not prepare the state %s\n", ObjectName(stateNode.Buffer()));
+        }
+    }
+    if (ok) {
+        ok = (application->StartNextStateExecution() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        Sleep::Sec(static_cast<float64>(duration));
+        ok = (application->StopCurrentStateExecution() == ErrorManagement::NoError);
+    }
+    //Report
+    const char8 * const header = "arch,config,state,thread,signal,sleep_nature,cpus,duration_s,period_us,"
+            "deadline_us,samples,mean_us,p50_us,p99_us,p999_us,max_us,missed";
+    if (ok) {
+        printf("%s\n", header);
+    }
+    FILE *csv = NULL;
+    FILE *histogramCSV = NULL;
+    if (ok) {
+        csv = OpenCSV(argv[3], header);
+        histogramCSV = OpenCSV(argv[4], "arch,config,state,thread,signal,sleep_nature,cpus,bin_us,count");
+        ok = ((csv != NULL) && (histogramCSV != NULL));
+    }
+    const char8 * const sleepNatureLabel = (sleepNature != NULL_PTR(const char8 *)) ? (sleepNature) : ("cfg");
+    const char8 * const cpusLabel = (cpus != NULL_PTR(const char8 *)) ? (cpus) : ("cfg");
+    for (t = 0u; (t < numberOfThreads) && (ok); t++) {
+        StreamString gamPath;
+        ReferenceT<CycleJitterGAM> gam;
+        ok = gamPath.Printf("%s.Functions.%s", ObjectName(appNode.Buffer()), gamNames[t].Buffer());
+        if (ok) {
+            gam = ord->Find(gamPath.Buffer());
+            ok = gam.IsValid();
+        }
+        uint32 samples = (ok) ? (gam->GetNumberOfSamples()) : (0u);
+        float64 period = periods[t];
+        if ((ok) && (period <= 0.0)) {
+            period = HistogramPercentile(gam, 0u, 0.5);
+        }
+        float64 deadline = period * (1.0 + DEADLINE_TOLERANCE);
+        uint32 numberOfSignals = (ok) ? (gam->GetNumberOfInputSignals()) : (0u);
+        uint32 s;
+        for (s = 0u; (s < numberOfSignals) && (ok); s++) {
+            StreamString signalName;
+            ok = gam->GetSignalName(InputSignals, s, signalName);
+            const uint32 *histogram = gam->GetHistogram(s);
+            uint32 bins = gam->GetNumberOfBins();
+            uint32 width = gam->GetBinWidth();
+            uint32 missed = 0u;
+            uint32 b;
+            for (b = 0u; (b < bins) && (ok); b++) {
+                if (histogram[b] > 0u) {
+                    if (static_cast<float64>(b * width) > deadline) {
+                        missed += histogram[b];
+                    }
+                    fprintf(histogramCSV, "%s,%s,%s,%s,%s,%s,%s,%u,%u\n", machine.machine, argv[1], ObjectName(stateNode.Buffer()),
+                            ObjectName(threadNodes[t].Buffer()), signalName.Buffer(), sleepNatureLabel, cpusLabel, b * width, histogram[b]);
+                }
+            }
+            float64 mean = (samples > 0u) ? (static_cast<float64>(gam->GetSum(s)) / static_cast<float64>(samples)) : (-1.0);
+            StreamString row;
+            (void) row.Printf("%s,%s,%s,%s,", machine.machine, argv[1], ObjectName(stateNode.Buffer()), ObjectName(threadNodes[t].Buffer()));
+            (void) row.Printf("%s,%s,%s,%d,", signalName.Buffer(), sleepNatureLabel, cpusLabel, duration);
+            (void) row.Printf("%.1f,%.1f,%d,%.1f,", period, deadline, samples, mean);
+            (void) row.Printf("%.1f,%.1f,%.1f,", HistogramPercentile(gam, s, 0.5), HistogramPercentile(gam, s, 0.99),
+                              HistogramPercentile(gam, s, 0.999));
+            (void) row.Printf("%d,%d", gam->GetMaximum(s), missed);
+            fprintf(csv, "%s\n", row.Buffer());
+            printf("%s\n", row.Buffer());
+        }
+    }
+    if (csv != NULL) {
+        (void) fclose(csv);
+    }
+    if (histogramCSV != NULL) {
+        (void) fclose(histogramCSV);
+    }
+    if (threadNodes != NULL_PTR(StreamString *)) {
+        delete[] threadNodes;
+    }
+    if (gamNames != NULL_PTR(StreamString *)) {
+        delete[] gamNames;
+    }
+    if (periods != NULL_PTR(float64 *)) {
+        delete[] periods;
+    }
+    application = Reference();
+    ord->Purge();
+    return (ok) ? (0) : (1);
+}
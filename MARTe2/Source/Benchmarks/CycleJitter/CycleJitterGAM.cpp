@@ -0,0 +1,192 @@
+/**
+ * @file CycleJitterGAM.cpp
+ * @brief Source file for class CycleJitterGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CycleJitterGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CycleJitterGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Default number of bins (20 ms with the default width).
+ */
+const MARTe::uint32 CYCLE_JITTER_DEFAULT_BINS = 20000u;
+
+/**
+ * Default width of the bins (microseconds).
+ */
+const MARTe::uint32 CYCLE_JITTER_DEFAULT_BIN_WIDTH = 1u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+CycleJitterGAM::CycleJitterGAM() :
+        MARTe::GAM() {
+    using namespace MARTe;
+    numberOfBins = CYCLE_JITTER_DEFAULT_BINS;
+    binWidth = CYCLE_JITTER_DEFAULT_BIN_WIDTH;
+    numberOfSignals = 0u;
+    cycles = 0u;
+    inputs = NULL_PTR(uint32 **);
+    histograms = NULL_PTR(uint32 *);
+    maxima = NULL_PTR(uint32 *);
+    sums = NULL_PTR(uint64 *);
+}
+
+CycleJitterGAM::~CycleJitterGAM() {
+    using namespace MARTe;
+    if (inputs != NULL_PTR(uint32 **)) {
+        delete[] inputs;
+    }
+    if (histograms != NULL_PTR(uint32 *)) {
+        delete[] histograms;
+    }
+    if (maxima != NULL_PTR(uint32 *)) {
+        delete[] maxima;
+    }
+    if (sums != NULL_PTR(uint64 *)) {
+        delete[] sums;
+    }
+}
+
+bool CycleJitterGAM::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        if (!data.Read("NumberOfBins", numberOfBins)) {
+            numberOfBins = CYCLE_JITTER_DEFAULT_BINS;
+        }
+        if (!data.Read("BinWidth", binWidth)) {
+            binWidth = CYCLE_JITTER_DEFAULT_BIN_WIDTH;
+        }
+        ok = ((numberOfBins > 0u) && (binWidth > 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBins and BinWidth shall be > 0");
+        }
+    }
+    return ok;
+}
+
+bool CycleJitterGAM::Setup() {
+    using namespace MARTe;
+    numberOfSignals = GetNumberOfInputSignals();
+    bool ok = (numberOfSignals > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "At least one input signal shall be defined");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "No output signals shall be defined");
+        }
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        uint32 elements = 0u;
+        ok = (GetSignalType(InputSignals, i) == UnsignedInteger32Bit);
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, elements);
+        }
+        if (ok) {
+            ok = (elements == 1u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The input signal %d shall be a uint32 scalar", i);
+        }
+    }
+    if (ok) {
+        inputs = new uint32*[numberOfSignals];
+        histograms = new uint32[numberOfSignals * numberOfBins];
+        maxima = new uint32[numberOfSignals];
+        sums = new uint64[numberOfSignals];
+        for (i = 0u; i < numberOfSignals; i++) {
+            inputs[i] = static_cast<uint32 *>(GetInputSignalMemory(i));
+            maxima[i] = 0u;
+            sums[i] = 0u;
+        }
+        for (i = 0u; i < (numberOfSignals * numberOfBins); i++) {
+            histograms[i] = 0u;
+        }
+    }
+    return ok;
+}
+
+bool CycleJitterGAM::Execute() {
+    using namespace MARTe;
+    if (cycles > 0u) {
+        uint32 i;
+        for (i = 0u; i < numberOfSignals; i++) {
+            uint32 value = *inputs[i];
+            uint32 bin = value / binWidth;
+            if (bin >= numberOfBins) {
+                bin = numberOfBins - 1u;
+            }
+            histograms[(i * numberOfBins) + bin]++;
+            if (value > maxima[i]) {
+                maxima[i] = value;
+            }
+            sums[i] += value;
+        }
+    }
+    cycles++;
+    return true;
+}
+
+MARTe::uint32 CycleJitterGAM::GetNumberOfSamples() const {
+    return (cycles > 0u) ? (cycles - 1u) : (0u);
+}
+
+MARTe::uint32 CycleJitterGAM::GetNumberOfBins() const {
+    return numberOfBins;
+}
+
+MARTe::uint32 CycleJitterGAM::GetBinWidth() const {
+    return binWidth;
+}
+
+const MARTe::uint32 *CycleJitterGAM::GetHistogram(const MARTe::uint32 signalIdx) const {
+    return &histograms[signalIdx * numberOfBins];
+}
+
+MARTe::uint32 CycleJitterGAM::GetMaximum(const MARTe::uint32 signalIdx) const {
+    return maxima[signalIdx];
+}
+
+MARTe::uint64 CycleJitterGAM::GetSum(const MARTe::uint32 signalIdx) const {
+    return sums[signalIdx];
+}
+
+CLASS_REGISTER(CycleJitterGAM, "")
+} // namespace MARTe2Tutorial
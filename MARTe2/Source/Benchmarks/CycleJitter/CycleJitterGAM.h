@@ -0,0 +1,196 @@
+/**
+ * @file CycleJitterGAM.h
+ * @brief Header file for class CycleJitterGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * CycleJitterGAM with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef BENCHMARKS_CYCLEJITTER_CYCLEJITTERGAM_H_
+#define BENCHMARKS_CYCLEJITTER_CYCLEJITTERGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Accumulates a latency histogram of every input signal.
+ *
+ * @details Meant to read the signals of a TimingDataSource (in microseconds),
+ * i.e. the cycle time of the thread and the execution time of its GAMs.
+ * The histogram of each signal has NumberOfBins bins of BinWidth
+ * microseconds; the last bin also counts all the larger values. The first
+ * cycle is not accounted, as its cycle time includes the start of the state.
+ *
+ * Nothing is allocated nor reported in Execute, so that the GAM can be
+ * appended to the real-time thread under measurement. The histograms are
+ * read by the benchmark once the state is stopped.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +CycleJitterThread1 = {
+ *     Class = CycleJitterGAM
+ *     NumberOfBins = 20000 //Optional. Default = 20000
+ *     BinWidth = 1 //Optional (microseconds). Default = 1
+ *     InputSignals = {
+ *         CycleTime = {
+ *             DataSource = Timings
+ *             Alias = Run.Thread1_CycleTime
+ *             Type = uint32
+ *         }
+ *         GAMTimer_ExecTime = {
+ *             DataSource = Timings
+ *             Type = uint32
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class CycleJitterGAM : public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    CycleJitterGAM();
+
+    /**
+     * @brief Destructor. Frees the histograms.
+     */
+    virtual ~CycleJitterGAM();
+
+    /**
+     * @brief Reads the NumberOfBins and the BinWidth.
+     * @return true if both are > 0.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Allocates the histograms.
+     * @return true if all the input signals are uint32 with one element and
+     * there are no output signals.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Adds the current value of each signal to its histogram.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Gets the number of accounted cycles.
+     * @return the number of values in each histogram.
+     */
+    MARTe::uint32 GetNumberOfSamples() const;
+
+    /**
+     * @brief Gets the number of bins of the histograms.
+     * @return NumberOfBins.
+     */
+    MARTe::uint32 GetNumberOfBins() const;
+
+    /**
+     * @brief Gets the width of the bins.
+     * @return BinWidth (microseconds).
+     */
+    MARTe::uint32 GetBinWidth() const;
+
+    /**
+     * @brief Gets the histogram of a signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @return the NumberOfBins counts of the signal.
+     * @pre signalIdx < GetNumberOfInputSignals()
+     */
+    const MARTe::uint32 *GetHistogram(const MARTe::uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the maximum value of a signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @return the maximum value (microseconds).
+     * @pre signalIdx < GetNumberOfInputSignals()
+     */
+    MARTe::uint32 GetMaximum(const MARTe::uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the sum of the values of a signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @return the sum of the values (microseconds).
+     * @pre signalIdx < GetNumberOfInputSignals()
+     */
+    MARTe::uint64 GetSum(const MARTe::uint32 signalIdx) const;
+
+private:
+    /**
+     * The number of bins of each histogram.
+     */
+    MARTe::uint32 numberOfBins;
+
+    /**
+     * The width of the bins.
+     */
+    MARTe::uint32 binWidth;
+
+    /**
+     * The number of input signals.
+     */
+    MARTe::uint32 numberOfSignals;
+
+    /**
+     * The number of executed cycles.
+     */
+    MARTe::uint32 cycles;
+
+    /**
+     * The input signals.
+     */
+    MARTe::uint32 **inputs;
+
+    /**
+     * The histograms, numberOfBins per signal.
+     */
+    MARTe::uint32 *histograms;
+
+    /**
+     * The maximum of each signal.
+     */
+    MARTe::uint32 *maxima;
+
+    /**
+     * The sum of each signal.
+     */
+    MARTe::uint64 *sums;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKS_CYCLEJITTER_CYCLEJITTERGAM_H_ */
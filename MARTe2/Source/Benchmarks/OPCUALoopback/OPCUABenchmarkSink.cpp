@@ -0,0 +1,188 @@
+/**
+ * @file OPCUABenchmarkSink.cpp
+ * @brief Source file for class OPCUABenchmarkSink
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUABenchmarkSink (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CLASSMETHODREGISTER.h"
+#include "HighResolutionTimer.h"
+#include "OPCUABenchmarkSink.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Prefix of the names of the subscribed variables.
+ */
+const MARTe::char8 * const SUBSCRIBED_VARIABLE_PREFIX = "Sub";
+
+/**
+ * @brief Gets the CPU time consumed by the calling thread.
+ * @return the CPU time in ns.
+ */
+MARTe::uint64 ThreadCPUTime() {
+    struct timespec now;
+    (void) clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (static_cast<MARTe::uint64>(now.tv_sec) * 1000000000ull) + static_cast<MARTe::uint64>(now.tv_nsec);
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+OPCUABenchmarkSink::OPCUABenchmarkSink() :
+        MARTe::Object(), MARTe::MessageI() {
+    using namespace MARTe;
+    numberOfVariables = 0u;
+    samples = 0u;
+    receptionTimes = NULL_PTR(volatile uint64 *);
+    received = 0u;
+    ignored = 0u;
+    firstCPUTime = 0u;
+    lastCPUTime = 0u;
+
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
+}
+
+OPCUABenchmarkSink::~OPCUABenchmarkSink() {
+    if (receptionTimes != NULL_PTR(volatile MARTe::uint64 *)) {
+        delete[] receptionTimes;
+    }
+}
+
+bool OPCUABenchmarkSink::Configure(const MARTe::uint32 numberOfVariablesIn,
+                                   const MARTe::uint32 samplesIn) {
+    using namespace MARTe;
+    bool ok = ((numberOfVariablesIn > 0u) && (samplesIn > 0u) && (receptionTimes == NULL_PTR(volatile uint64 *)));
+    if (ok) {
+        uint32 size = numberOfVariablesIn * samplesIn;
+        uint64 *times = new uint64[size];
+        uint32 i;
+        for (i = 0u; i < size; i++) {
+            times[i] = 0u;
+        }
+        numberOfVariables = numberOfVariablesIn;
+        samples = samplesIn;
+        __atomic_store_n(&receptionTimes, times, __ATOMIC_RELEASE);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "The number of variables and of samples shall be > 0");
+    }
+    return ok;
+}
+
+MARTe::ErrorManagement::ErrorType OPCUABenchmarkSink::Notify(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    uint64 now = HighResolutionTimer::Counter();
+    ErrorManagement::ErrorType err;
+    StreamString variableName;
+    uint32 sequence = 0u;
+    err.parametersError = !data.Read("param1", variableName);
+    if (err.ErrorsCleared()) {
+        err.parametersError = !data.Read("param2", sequence);
+    }
+    volatile uint64 *times = __atomic_load_n(&receptionTimes, __ATOMIC_ACQUIRE);
+    bool record = ((err.ErrorsCleared()) && (times != NULL_PTR(volatile uint64 *)));
+    uint32 variable = 0u;
+    if (record) {
+        const char8 *name = variableName.Buffer();
+        uint32 prefixSize = StringHelper::Length(SUBSCRIBED_VARIABLE_PREFIX);
+        record = (StringHelper::CompareN(name, SUBSCRIBED_VARIABLE_PREFIX, prefixSize) == 0);
+        uint32 c;
+        for (c = prefixSize; (record) && (name[c] != '\0'); c++) {
+            record = ((name[c] >= '0') && (name[c] <= '9'));
+            variable = (variable * 10u) + static_cast<uint32>(name[c] - '0');
+        }
+    }
+    if (record) {
+        record = ((variable < numberOfVariables) && (sequence > 0u) && (sequence <= samples));
+    }
+    if (record) {
+        uint32 idx = (variable * samples) + (sequence - 1u);
+        record = (times[idx] == 0u);
+        if (record) {
+            times[idx] = now;
+        }
+    }
+    if (record) {
+        uint64 cpuTime = ThreadCPUTime();
+        if (received == 0u) {
+            firstCPUTime = cpuTime;
+        }
+        lastCPUTime = cpuTime;
+        __atomic_store_n(&received, received + 1u, __ATOMIC_RELEASE);
+    }
+    else {
+        __atomic_store_n(&ignored, ignored + 1u, __ATOMIC_RELEASE);
+    }
+    return err;
+}
+
+MARTe::uint64 OPCUABenchmarkSink::GetReceptionTime(const MARTe::uint32 variable,
+                                                   const MARTe::uint32 sequence) const {
+    using namespace MARTe;
+    uint64 receptionTime = 0u;
+    volatile uint64 *times = __atomic_load_n(&receptionTimes, __ATOMIC_ACQUIRE);
+    if ((times != NULL_PTR(volatile uint64 *)) && (variable < numberOfVariables) && (sequence > 0u) && (sequence <= samples)) {
+        receptionTime = times[(variable * samples) + (sequence - 1u)];
+    }
+    return receptionTime;
+}
+
+MARTe::uint32 OPCUABenchmarkSink::GetNumberOfReceived() const {
+    return __atomic_load_n(&received, __ATOMIC_ACQUIRE);
+}
+
+MARTe::uint32 OPCUABenchmarkSink::GetNumberOfIgnored() const {
+    return __atomic_load_n(&ignored, __ATOMIC_ACQUIRE);
+}
+
+MARTe::float64 OPCUABenchmarkSink::GetCPUTimePerNotification() const {
+    using namespace MARTe;
+    float64 cpuTime = -1.0;
+    uint32 n = GetNumberOfReceived();
+    if (n > 1u) {
+        cpuTime = static_cast<float64>(lastCPUTime - firstCPUTime) / (1e3 * static_cast<float64>(n - 1u));
+    }
+    return cpuTime;
+}
+
+CLASS_REGISTER(OPCUABenchmarkSink, "")
+CLASS_METHOD_REGISTER(OPCUABenchmarkSink, Notify)
+} // namespace MARTe2Tutorial
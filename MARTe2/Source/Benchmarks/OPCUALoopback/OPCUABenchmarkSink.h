@@ -0,0 +1,176 @@
+/**
+ * @file OPCUABenchmarkSink.h
+ * @brief Header file for class OPCUABenchmarkSink
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * OPCUABenchmarkSink with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef BENCHMARKS_OPCUALOOPBACK_OPCUABENCHMARKSINK_H_
+#define BENCHMARKS_OPCUALOOPBACK_OPCUABENCHMARKSINK_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MessageI.h"
+#include "Object.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Destination of the event messages of the OPCUAVariable instances
+ * under benchmark.
+ *
+ * @details The OPCUAVariable instances shall be configured with
+ * PVValue = ParameterName and Function = Notify, so that each message carries
+ * the name of the variable (param1, e.g. Sub12) and the new value (param2).
+ * The value is the sequence number (1 to Samples) of the update written by
+ * the OPCUALoopbackServer. The reception time of the first message with a
+ * given (variable, sequence number) is recorded, the others (duplicates,
+ * values out of range) are only counted.
+ *
+ * The Notify method is called in the context of the OPCUAClient thread,
+ * whose CPU time is also sampled at every message.
+ *
+ * <pre>
+ * +BenchmarkSink = {
+ *     Class = OPCUABenchmarkSink
+ * }
+ * </pre>
+ */
+class OPCUABenchmarkSink : public MARTe::Object, public MARTe::MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the RegisteredMethodsMessageFilter.
+     */
+    OPCUABenchmarkSink();
+
+    /**
+     * @brief Destructor. Frees the reception times.
+     */
+    virtual ~OPCUABenchmarkSink();
+
+    /**
+     * @brief Allocates the reception times. Shall be called before the first
+     * update is written by the server.
+     * @param[in] numberOfVariablesIn number of subscribed variables (named
+     * Sub0 to SubN-1).
+     * @param[in] samplesIn number of updates per variable.
+     * @return true if numberOfVariablesIn and samplesIn are > 0.
+     */
+    bool Configure(const MARTe::uint32 numberOfVariablesIn,
+                   const MARTe::uint32 samplesIn);
+
+    /**
+     * @brief Records the reception of an update.
+     * @details Registered for RPC.
+     * @param[in] data shall contain param1 (the variable name) and param2
+     * (the sequence number).
+     * @return ErrorManagement::NoError if both parameters can be read.
+     */
+    MARTe::ErrorManagement::ErrorType Notify(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Gets the reception time of an update.
+     * @param[in] variable the variable index.
+     * @param[in] sequence the sequence number (1 to Samples).
+     * @return the HighResolutionTimer::Counter at the reception or 0 if the
+     * update was not received.
+     */
+    MARTe::uint64 GetReceptionTime(const MARTe::uint32 variable,
+                                   const MARTe::uint32 sequence) const;
+
+    /**
+     * @brief Gets the number of recorded (unique) updates.
+     * @return the number of recorded updates.
+     */
+    MARTe::uint32 GetNumberOfReceived() const;
+
+    /**
+     * @brief Gets the number of messages which were not recorded.
+     * @return the number of duplicated or out of range messages.
+     */
+    MARTe::uint32 GetNumberOfIgnored() const;
+
+    /**
+     * @brief Gets the CPU time of the OPCUAClient thread per recorded update.
+     * @return the CPU time in microseconds between the first and the last
+     * recorded update divided by the number of updates in between, or -1 if
+     * less than two updates were recorded.
+     */
+    MARTe::float64 GetCPUTimePerNotification() const;
+
+private:
+    /**
+     * Number of subscribed variables.
+     */
+    MARTe::uint32 numberOfVariables;
+
+    /**
+     * Number of updates per variable.
+     */
+    MARTe::uint32 samples;
+
+    /**
+     * numberOfVariables x samples reception times.
+     */
+    volatile MARTe::uint64 *receptionTimes;
+
+    /**
+     * Number of recorded updates.
+     */
+    volatile MARTe::uint32 received;
+
+    /**
+     * Number of ignored messages.
+     */
+    volatile MARTe::uint32 ignored;
+
+    /**
+     * Thread CPU time (ns) at the first recorded update.
+     */
+    MARTe::uint64 firstCPUTime;
+
+    /**
+     * Thread CPU time (ns) at the last recorded update.
+     */
+    MARTe::uint64 lastCPUTime;
+
+    /**
+     * The message filter.
+     */
+    MARTe::ReferenceT<MARTe::RegisteredMethodsMessageFilter> filter;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKS_OPCUALOOPBACK_OPCUABENCHMARKSINK_H_ */
@@ -0,0 +1,430 @@
+/**
+ * @file OPCUALoopbackBenchmark.cpp
+ * @brief Source file for the OPCUALoopbackBenchmark tool
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details Measures the OPCUAClient and OPCUAVariable classes against an
+ * OPCUALoopbackServer running in the same process, so that no external OPC
+ * UA server (nor network) is involved:
+ *  - startup: time to connect (ObjectRegistryDatabase::Initialise of the
+ *    OPCUAClient, with AutoStart = 1) and time from then until the first
+ *    notification of every subscribed variable was received (browse,
+ *    subscription and monitored item of each variable);
+ *  - latency: the server writes Samples sequence numbers to its VARIABLES
+ *    variables, one every PERIOD_MS. Each of them is subscribed by an
+ *    OPCUAVariable (Sub0 to SubN-1) whose event message is received by an
+ *    OPCUABenchmarkSink. The latency is the time from the server write to
+ *    the message reception (percentiles over all the variables and
+ *    samples). Notifications never received are reported as lost;
+ *  - write throughput: WRITES OPCUAWrite messages are sent, round robin,
+ *    to the write-only OPCUAVariable instances (Wr0 to WrN-1);
+ *  - CPU per notification: CPU time of the OPCUAClient thread and of the
+ *    whole process (which includes the server) per received notification.
+ *
+ * Build: make -f Makefile.gcc (built with the other components when
+ * OPEN62541_LIB is defined).
+ *
+ * Usage:
+ * OPCUALoopbackBenchmark.ex CSV_FILE [VARIABLES] [SAMPLES] [PERIOD_MS] [WRITES] [PORT]
+ * e.g.
+ * ./OPCUALoopbackBenchmark.ex opcua.csv 10 20 1000 1000 4841
+ *
+ * One line is appended to CSV_FILE (with a header if the file is empty) and
+ * printed on the standard output:
+ * variables,samples,period_ms,connect_ms,subscribe_ms,received,lost,
+ * latency_p50_ms,latency_p90_ms,latency_p99_ms,latency_max_ms,writes,
+ * writes_per_s,client_cpu_us_per_notification,process_cpu_us_per_notification
+ *
+ * The errors of the framework are printed on the standard error.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
+#include "Message.h"
+#include "ObjectRegistryDatabase.h"
+#include "OPCUABenchmarkSink.h"
+#include "OPCUAClient.h"
+#include "OPCUALoopbackServer.h"
+#include "OPCUAVariable.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Maximum time (ms) to wait for the first notification of all the variables.
+ */
+const MARTe::uint32 OPCUA_BENCHMARK_STARTUP_TIMEOUT = 60000u;
+
+/**
+ * Time (ms) to wait for the notifications after the last update. Larger
+ * than the sampling plus the publishing interval of the OPCUAVariable.
+ */
+const MARTe::uint32 OPCUA_BENCHMARK_DRAIN_TIMEOUT = 5000u;
+
+/**
+ * Polling period (ms) of the main thread.
+ */
+const MARTe::uint32 OPCUA_BENCHMARK_POLL_PERIOD = 10u;
+
+/**
+ * @brief Prints the errors of the framework on the standard error.
+ */
+void BenchmarkErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                   const MARTe::char8 * const errorDescription) {
+    fprintf(stderr, "[%s:%d] %s\n", errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+/**
+ * @brief Gets the CPU time consumed by the process.
+ * @return the CPU time in ns.
+ */
+MARTe::uint64 ProcessCPUTime() {
+    struct timespec now;
+    (void) clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+    return (static_cast<MARTe::uint64>(now.tv_sec) * 1000000000ull) + static_cast<MARTe::uint64>(now.tv_nsec);
+}
+
+/**
+ * @brief Gets the elapsed time since a HighResolutionTimer::Counter.
+ * @return the elapsed time in ms.
+ */
+MARTe::float64 ElapsedMs(const MARTe::uint64 start) {
+    using namespace MARTe;
+    return static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period() * 1e3;
+}
+
+/**
+ * @brief qsort comparator.
+ */
+int CompareFloat64(const void *a,
+                   const void *b) {
+    MARTe::float64 x = *static_cast<const MARTe::float64 *>(a);
+    MARTe::float64 y = *static_cast<const MARTe::float64 *>(b);
+    return (x < y) ? (-1) : ((x > y) ? (1) : (0));
+}
+
+/**
+ * @brief Gets the nearest-rank percentile of sorted values.
+ * @return the percentile or -1 if there are no values.
+ */
+MARTe::float64 Percentile(const MARTe::float64 * const sorted,
+                          const MARTe::uint32 n,
+                          const MARTe::float64 p) {
+    MARTe::float64 value = -1.0;
+    if (n > 0u) {
+        MARTe::uint32 rank = static_cast<MARTe::uint32>((p * static_cast<MARTe::float64>(n)) + 0.999999);
+        if (rank < 1u) {
+            rank = 1u;
+        }
+        if (rank > n) {
+            rank = n;
+        }
+        value = sorted[rank - 1u];
+    }
+    return value;
+}
+
+/**
+ * @brief Builds the configuration of the OPCUAClient and of the sink.
+ */
+bool BuildConfiguration(MARTe::ConfigurationDatabase &cdb,
+                        const MARTe::uint32 numberOfVariables,
+                        const MARTe::uint16 port) {
+    using namespace MARTe;
+    StreamString cfg;
+    bool ok = cfg.Printf("%s", "+BenchmarkSink = {\n    Class = OPCUABenchmarkSink\n}\n");
+    if (ok) {
+        ok = cfg.Printf("+OPCUAClient = {\n    Class = OPCUAClient\n    AutoStart = 1\n    Address = \"opc.tcp://127.0.0.1:%d\"\n", port);
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfVariables) && (ok); i++) {
+        ok = cfg.Printf("    +Sub%d = {\n        Class = OPCUAVariable\n        Path = Benchmark.Var%d\n        Type = uint32\n"
+                        "        NameSpaceIndex = 1\n        NumberOfElements = 1\n        Event = {\n            Destination = BenchmarkSink\n"
+                        "            PVValue = ParameterName\n            Function = Notify\n        }\n    }\n",
+                        i, i);
+        if (ok) {
+            ok = cfg.Printf("    +Wr%d = {\n        Class = OPCUAVariable\n        Path = Benchmark.Var%d\n        Type = uint32\n"
+                            "        NameSpaceIndex = 1\n        NumberOfElements = 1\n    }\n",
+                            i, i);
+        }
+    }
+    if (ok) {
+        ok = cfg.Printf("%s", "}\n");
+    }
+    if (ok) {
+        ok = cfg.Seek(0LLU);
+    }
+    if (ok) {
+        StreamString err;
+        StandardParser parser(cfg, cdb, &err);
+        ok = parser.Parse();
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not parse the configuration: %s", err.Buffer());
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+/**
+ * @brief Sends WRITES OPCUAWrite messages to the Wr variables.
+ * @return the number of successful writes per second.
+ */
+MARTe::float64 MeasureWrites(const MARTe::uint32 numberOfVariables,
+                             const MARTe::uint32 writes,
+                             MARTe::uint32 &failed) {
+    using namespace MARTe;
+    ReferenceT<Message> *messages = new ReferenceT<Message>[numberOfVariables];
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < numberOfVariables) && (ok); i++) {
+        ConfigurationDatabase cdb;
+        StreamString destination;
+        ok = destination.Printf("OPCUAClient.Wr%d", i);
+        if (ok) {
+            ok = cdb.Write("Destination", destination.Buffer());
+        }
+        if (ok) {
+            ok = cdb.Write("Function", "OPCUAWrite");
+        }
+        if (ok) {
+            ok = cdb.CreateAbsolute("+Parameters");
+        }
+        if (ok) {
+            ok = cdb.Write("Class", "ConfigurationDatabase");
+        }
+        if (ok) {
+            //Never a sequence number, so that the notifications are ignored by the sink
+            ok = cdb.Write("param1", 0u);
+        }
+        if (ok) {
+            ok = cdb.MoveToRoot();
+        }
+        if (ok) {
+            messages[i] = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            ok = messages[i]->Initialise(cdb);
+        }
+    }
+    float64 writesPerSecond = -1.0;
+    failed = 0u;
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        uint32 k;
+        for (k = 0u; k < writes; k++) {
+            if (MessageI::SendMessage(messages[k % numberOfVariables], NULL_PTR(Object *)) != ErrorManagement::NoError) {
+                failed++;
+            }
+        }
+        float64 elapsed = ElapsedMs(start) / 1e3;
+        if (elapsed > 0.0) {
+            writesPerSecond = static_cast<float64>(writes - failed) / elapsed;
+        }
+    }
+    delete[] messages;
+    return writesPerSecond;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+int main(int argc,
+         char **argv) {
+    using namespace MARTe;
+    using namespace MARTe2Tutorial;
+    ErrorManagement::SetErrorProcessFunction(&BenchmarkErrorProcessFunction);
+    bool ok = (argc >= 2);
+    if (!ok) {
+        fprintf(stderr, "Usage: %s CSV_FILE [VARIABLES] [SAMPLES] [PERIOD_MS] [WRITES] [PORT]\n", argv[0]);
+    }
+    uint32 numberOfVariables = 10u;
+    uint32 samples = 20u;
+    uint32 period = 1000u;
+    uint32 writes = 1000u;
+    uint16 port = 4841u;
+    if (ok) {
+        if (argc > 2) {
+            numberOfVariables = static_cast<uint32>(strtoul(argv[2], NULL, 10));
+        }
+        if (argc > 3) {
+            samples = static_cast<uint32>(strtoul(argv[3], NULL, 10));
+        }
+        if (argc > 4) {
+            period = static_cast<uint32>(strtoul(argv[4], NULL, 10));
+        }
+        if (argc > 5) {
+            writes = static_cast<uint32>(strtoul(argv[5], NULL, 10));
+        }
+        if (argc > 6) {
+            port = static_cast<uint16>(strtoul(argv[6], NULL, 10));
+        }
+        ok = ((numberOfVariables > 0u) && (samples > 0u) && (period > 0u));
+        if (!ok) {
+            fprintf(stderr, "VARIABLES, SAMPLES and PERIOD_MS shall be > 0\n");
+        }
+    }
+    OPCUALoopbackServer server;
+    if (ok) {
+        ok = server.Start(port, numberOfVariables, samples, static_cast<float64>(period));
+    }
+    //Startup
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = BuildConfiguration(cdb, numberOfVariables, port);
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    float64 connectMs = -1.0;
+    float64 subscribeMs = -1.0;
+    ReferenceT<OPCUABenchmarkSink> sink;
+    //Typed, so that the OPCUAClient (and its class registration) is linked from the static library
+    ReferenceT<OPCUAClient> client;
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        ok = ord->Initialise(cdb);
+        connectMs = ElapsedMs(start);
+        if (!ok) {
+            fprintf(stderr, "Could not initialise the OPCUAClient\n");
+        }
+    }
+    if (ok) {
+        sink = ord->Find("BenchmarkSink");
+        client = ord->Find("OPCUAClient");
+        ok = ((sink.IsValid()) && (client.IsValid()));
+    }
+    if (ok) {
+        ok = sink->Configure(numberOfVariables, samples);
+    }
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        bool subscribed = false;
+        while ((!subscribed) && (ElapsedMs(start) < OPCUA_BENCHMARK_STARTUP_TIMEOUT)) {
+            subscribed = true;
+            uint32 i;
+            for (i = 0u; (i < client->Size()) && (subscribed); i++) {
+                ReferenceT<OPCUAVariable> variable = client->Get(i);
+                if (variable.IsValid()) {
+                    if (!variable->GetMode().notSet.operator bool()) {
+                        subscribed = !variable->IsFirstTime();
+                    }
+                }
+            }
+            if (!subscribed) {
+                Sleep::MSec(OPCUA_BENCHMARK_POLL_PERIOD);
+            }
+        }
+        subscribeMs = ElapsedMs(start);
+        ok = subscribed;
+        if (!ok) {
+            fprintf(stderr, "Not all the variables were subscribed after %d ms\n", OPCUA_BENCHMARK_STARTUP_TIMEOUT);
+        }
+    }
+    //Latency and CPU
+    uint32 received = 0u;
+    float64 processCPUPerNotification = -1.0;
+    if (ok) {
+        uint64 cpuStart = ProcessCPUTime();
+        server.Enable();
+        uint32 expected = numberOfVariables * samples;
+        while (server.GetSequence() < samples) {
+            Sleep::MSec(OPCUA_BENCHMARK_POLL_PERIOD);
+        }
+        uint64 start = HighResolutionTimer::Counter();
+        while ((sink->GetNumberOfReceived() < expected) && (ElapsedMs(start) < OPCUA_BENCHMARK_DRAIN_TIMEOUT)) {
+            Sleep::MSec(OPCUA_BENCHMARK_POLL_PERIOD);
+        }
+        received = sink->GetNumberOfReceived();
+        if (received > 0u) {
+            processCPUPerNotification = static_cast<float64>(ProcessCPUTime() - cpuStart) / (1e3 * static_cast<float64>(received));
+        }
+    }
+    float64 *latencies = NULL_PTR(float64 *);
+    uint32 nLatencies = 0u;
+    if (ok) {
+        latencies = new float64[numberOfVariables * samples];
+        uint32 i;
+        for (i = 0u; i < numberOfVariables; i++) {
+            uint32 k;
+            for (k = 1u; k <= samples; k++) {
+                uint64 receptionTime = sink->GetReceptionTime(i, k);
+                uint64 updateTime = server.GetUpdateTime(i, k);
+                if ((receptionTime != 0u) && (receptionTime >= updateTime)) {
+                    latencies[nLatencies] = static_cast<float64>(receptionTime - updateTime) * HighResolutionTimer::Period() * 1e3;
+                    nLatencies++;
+                }
+            }
+        }
+        qsort(latencies, nLatencies, sizeof(float64), &CompareFloat64);
+    }
+    //Write throughput
+    float64 writesPerSecond = -1.0;
+    uint32 failedWrites = 0u;
+    if ((ok) && (writes > 0u)) {
+        writesPerSecond = MeasureWrites(numberOfVariables, writes, failedWrites);
+    }
+    if (ok) {
+        StreamString row;
+        (void) row.Printf("%d,%d,%d,", numberOfVariables, samples, period);
+        (void) row.Printf("%.3f,%.3f,%d,%d,", connectMs, subscribeMs, received, (numberOfVariables * samples) - received);
+        (void) row.Printf("%.3f,%.3f,", Percentile(latencies, nLatencies, 0.5), Percentile(latencies, nLatencies, 0.9));
+        (void) row.Printf("%.3f,%.3f,%d,", Percentile(latencies, nLatencies, 0.99), Percentile(latencies, nLatencies, 1.0), writes - failedWrites);
+        (void) row.Printf("%.1f,%.3f,%.3f", writesPerSecond, sink->GetCPUTimePerNotification(), processCPUPerNotification);
+        const char8 * const header = "variables,samples,period_ms,connect_ms,subscribe_ms,received,lost,"
+                "latency_p50_ms,latency_p90_ms,latency_p99_ms,latency_max_ms,writes,"
+                "writes_per_s,client_cpu_us_per_notification,process_cpu_us_per_notification";
+        FILE *csv = fopen(argv[1], "a");
+        ok = (csv != NULL);
+        if (ok) {
+            (void) fseek(csv, 0, SEEK_END);
+            if (ftell(csv) == 0) {
+                fprintf(csv, "%s\n", header);
+            }
+            fprintf(csv, "%s\n", row.Buffer());
+            (void) fclose(csv);
+        }
+        else {
+            fprintf(stderr, "Could not open %s\n", argv[1]);
+        }
+        printf("%s\n%s\n", header, row.Buffer());
+    }
+    if (latencies != NULL_PTR(float64 *)) {
+        delete[] latencies;
+    }
+    sink = Reference();
+    client = Reference();
+    ord->Purge();
+    server.Stop();
+    return (ok) ? (0) : (1);
+}
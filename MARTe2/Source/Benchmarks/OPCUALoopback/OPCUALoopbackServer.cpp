@@ -0,0 +1,197 @@
+/**
+ * @file OPCUALoopbackServer.cpp
+ * @brief Source file for class OPCUALoopbackServer
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUALoopbackServer (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "OPCUALoopbackServer.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Numeric identifier of the Benchmark object.
+ */
+const MARTe::uint32 OPCUA_LOOPBACK_OBJECT_ID = 1000u;
+
+/**
+ * Numeric identifier of Var0. VarI is OPCUA_LOOPBACK_FIRST_VARIABLE_ID + I.
+ */
+const MARTe::uint32 OPCUA_LOOPBACK_FIRST_VARIABLE_ID = 2000u;
+
+/**
+ * Namespace of the benchmark nodes.
+ */
+const MARTe::uint16 OPCUA_LOOPBACK_NAMESPACE = 1u;
+
+/**
+ * @brief The repeated callback of the server.
+ */
+void OPCUALoopbackServerUpdate(UA_Server *server,
+                               void *data) {
+    static_cast<MARTe2Tutorial::OPCUALoopbackServer *>(data)->Update();
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+OPCUALoopbackServer::OPCUALoopbackServer() :
+        MARTe::EmbeddedServiceMethodBinderI(), executor(*this) {
+    using namespace MARTe;
+    server = NULL_PTR(UA_Server *);
+    numberOfVariables = 0u;
+    samples = 0u;
+    enabled = false;
+    sequence = 0u;
+    updateTimes = NULL_PTR(uint64 *);
+}
+
+OPCUALoopbackServer::~OPCUALoopbackServer() {
+    Stop();
+    if (updateTimes != NULL_PTR(MARTe::uint64 *)) {
+        delete[] updateTimes;
+    }
+}
+
+bool OPCUALoopbackServer::Start(const MARTe::uint16 port,
+                                const MARTe::uint32 numberOfVariablesIn,
+                                const MARTe::uint32 samplesIn,
+                                const MARTe::float64 period) {
+    using namespace MARTe;
+    numberOfVariables = numberOfVariablesIn;
+    samples = samplesIn;
+    updateTimes = new uint64[numberOfVariables * samples];
+    server = UA_Server_new();
+    bool ok = (server != NULL_PTR(UA_Server *));
+    if (ok) {
+        ok = (UA_ServerConfig_setMinimal(UA_Server_getConfig(server), port, NULL) == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        UA_ObjectAttributes objectAttributes = UA_ObjectAttributes_default;
+        objectAttributes.displayName = UA_LOCALIZEDTEXT(const_cast<char8 *>("en-US"), const_cast<char8 *>("Benchmark"));
+        ok = (UA_Server_addObjectNode(server, UA_NODEID_NUMERIC(OPCUA_LOOPBACK_NAMESPACE, OPCUA_LOOPBACK_OBJECT_ID),
+                                      UA_NODEID_NUMERIC(0u, UA_NS0ID_OBJECTSFOLDER), UA_NODEID_NUMERIC(0u, UA_NS0ID_ORGANIZES),
+                                      UA_QUALIFIEDNAME(OPCUA_LOOPBACK_NAMESPACE, const_cast<char8 *>("Benchmark")),
+                                      UA_NODEID_NUMERIC(0u, UA_NS0ID_BASEOBJECTTYPE), objectAttributes, NULL, NULL) == UA_STATUSCODE_GOOD);
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfVariables) && (ok); i++) {
+        StreamString name;
+        (void) name.Printf("Var%d", i);
+        UA_UInt32 value = 0u;
+        UA_VariableAttributes variableAttributes = UA_VariableAttributes_default;
+        UA_Variant_setScalar(&variableAttributes.value, &value, &UA_TYPES[UA_TYPES_UINT32]);
+        variableAttributes.dataType = UA_TYPES[UA_TYPES_UINT32].typeId;
+        variableAttributes.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+        variableAttributes.displayName = UA_LOCALIZEDTEXT(const_cast<char8 *>("en-US"), const_cast<char8 *>(name.Buffer()));
+        ok = (UA_Server_addVariableNode(server, UA_NODEID_NUMERIC(OPCUA_LOOPBACK_NAMESPACE, OPCUA_LOOPBACK_FIRST_VARIABLE_ID + i),
+                                        UA_NODEID_NUMERIC(OPCUA_LOOPBACK_NAMESPACE, OPCUA_LOOPBACK_OBJECT_ID),
+                                        UA_NODEID_NUMERIC(0u, UA_NS0ID_HASCOMPONENT),
+                                        UA_QUALIFIEDNAME(OPCUA_LOOPBACK_NAMESPACE, const_cast<char8 *>(name.Buffer())),
+                                        UA_NODEID_NUMERIC(0u, UA_NS0ID_BASEDATAVARIABLETYPE), variableAttributes, NULL, NULL) == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        ok = (UA_Server_addRepeatedCallback(server, &OPCUALoopbackServerUpdate, this, period, NULL) == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        ok = (UA_Server_run_startup(server) == UA_STATUSCODE_GOOD);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the OPC UA server on port %d", port);
+        }
+    }
+    if (ok) {
+        executor.SetName("OPCUALoopbackServer");
+        ok = (executor.Start() == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
+void OPCUALoopbackServer::Stop() {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (server != NULL_PTR(UA_Server *)) {
+        (void) UA_Server_run_shutdown(server);
+        UA_Server_delete(server);
+        server = NULL_PTR(UA_Server *);
+    }
+}
+
+void OPCUALoopbackServer::Enable() {
+    __atomic_store_n(&enabled, true, __ATOMIC_RELEASE);
+}
+
+MARTe::uint32 OPCUALoopbackServer::GetSequence() const {
+    return __atomic_load_n(&sequence, __ATOMIC_ACQUIRE);
+}
+
+MARTe::uint64 OPCUALoopbackServer::GetUpdateTime(const MARTe::uint32 variable,
+                                                 const MARTe::uint32 sequenceIn) const {
+    MARTe::uint64 updateTime = 0u;
+    if ((variable < numberOfVariables) && (sequenceIn > 0u) && (sequenceIn <= GetSequence())) {
+        updateTime = updateTimes[(variable * samples) + (sequenceIn - 1u)];
+    }
+    return updateTime;
+}
+
+MARTe::ErrorManagement::ErrorType OPCUALoopbackServer::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        //Waits at most until the next repeated callback (or 50 ms), so that Stop is not blocked
+        (void) UA_Server_run_iterate(server, true);
+    }
+    return ErrorManagement::NoError;
+}
+
+void OPCUALoopbackServer::Update() {
+    using namespace MARTe;
+    bool update = (__atomic_load_n(&enabled, __ATOMIC_ACQUIRE) && (sequence < samples));
+    if (update) {
+        UA_UInt32 value = sequence + 1u;
+        UA_Variant variant;
+        UA_Variant_setScalar(&variant, &value, &UA_TYPES[UA_TYPES_UINT32]);
+        uint32 i;
+        for (i = 0u; i < numberOfVariables; i++) {
+            updateTimes[(i * samples) + sequence] = HighResolutionTimer::Counter();
+            (void) UA_Server_writeValue(server, UA_NODEID_NUMERIC(OPCUA_LOOPBACK_NAMESPACE, OPCUA_LOOPBACK_FIRST_VARIABLE_ID + i), variant);
+        }
+        __atomic_store_n(&sequence, value, __ATOMIC_RELEASE);
+    }
+}
+
+} // namespace MARTe2Tutorial
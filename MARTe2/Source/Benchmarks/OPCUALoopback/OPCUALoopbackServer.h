@@ -0,0 +1,161 @@
+/**
+ * @file OPCUALoopbackServer.h
+ * @brief Header file for class OPCUALoopbackServer
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * OPCUALoopbackServer with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef BENCHMARKS_OPCUALOOPBACK_OPCUALOOPBACKSERVER_H_
+#define BENCHMARKS_OPCUALOOPBACK_OPCUALOOPBACKSERVER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "open62541.h"
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "SingleThreadService.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief An open62541 server embedded in the benchmark process, which
+ * publishes NumberOfVariables uint32 variables and updates them periodically.
+ *
+ * @details The address space is Objects.Benchmark.Var0 to
+ * Objects.Benchmark.VarN-1, all in namespace 1, so that an OPCUAVariable can
+ * use Path = Benchmark.Var0 and NameSpaceIndex = 1.
+ *
+ * Once Enable is called, every Period ms (a repeated callback of the server,
+ * so that the address space is only touched by the server thread) the
+ * server writes the next sequence number (1 to Samples) to all the variables
+ * and records the HighResolutionTimer::Counter just before each write.
+ */
+class OPCUALoopbackServer : public MARTe::EmbeddedServiceMethodBinderI {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    OPCUALoopbackServer();
+
+    /**
+     * @brief Destructor. Calls Stop.
+     */
+    virtual ~OPCUALoopbackServer();
+
+    /**
+     * @brief Creates the address space, opens the port and starts the
+     * server thread.
+     * @param[in] port the TCP port (on all the interfaces).
+     * @param[in] numberOfVariablesIn the number of variables.
+     * @param[in] samplesIn the number of updates.
+     * @param[in] period the period of the updates in ms.
+     * @return true if the server is listening.
+     */
+    bool Start(const MARTe::uint16 port,
+               const MARTe::uint32 numberOfVariablesIn,
+               const MARTe::uint32 samplesIn,
+               const MARTe::float64 period);
+
+    /**
+     * @brief Stops the server thread and closes the server.
+     */
+    void Stop();
+
+    /**
+     * @brief Starts the periodic updates.
+     */
+    void Enable();
+
+    /**
+     * @brief Gets the sequence number of the last update.
+     * @return the number of updates already written (0 to Samples).
+     */
+    MARTe::uint32 GetSequence() const;
+
+    /**
+     * @brief Gets the time of an update.
+     * @param[in] variable the variable index.
+     * @param[in] sequence the sequence number (1 to GetSequence()).
+     * @return the HighResolutionTimer::Counter just before the write.
+     */
+    MARTe::uint64 GetUpdateTime(const MARTe::uint32 variable,
+                                const MARTe::uint32 sequence) const;
+
+    /**
+     * @brief Runs an iteration of the server. Called by the server thread.
+     * @param[in] info see EmbeddedServiceMethodBinderI::Execute.
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+    /**
+     * @brief Writes the next update. Called from the repeated callback.
+     */
+    void Update();
+
+private:
+    /**
+     * The open62541 server.
+     */
+    UA_Server *server;
+
+    /**
+     * The server thread.
+     */
+    MARTe::SingleThreadService executor;
+
+    /**
+     * Number of variables.
+     */
+    MARTe::uint32 numberOfVariables;
+
+    /**
+     * Number of updates.
+     */
+    MARTe::uint32 samples;
+
+    /**
+     * True once Enable was called.
+     */
+    volatile bool enabled;
+
+    /**
+     * Sequence number of the last update.
+     */
+    volatile MARTe::uint32 sequence;
+
+    /**
+     * numberOfVariables x samples update times.
+     */
+    MARTe::uint64 *updateTimes;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKS_OPCUALOOPBACK_OPCUALOOPBACKSERVER_H_ */
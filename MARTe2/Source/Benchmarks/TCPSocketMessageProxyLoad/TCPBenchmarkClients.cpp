@@ -0,0 +1,150 @@
+/**
+ * @file TCPBenchmarkClients.cpp
+ * @brief Source file for class TCPBenchmarkClients
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TCPBenchmarkClients (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
+#include "TCPBenchmarkClients.h"
+#include "TCPSocket.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Idle period (ms) of the threads once all the messages were taken.
+ */
+const MARTe::uint32 TCP_BENCHMARK_IDLE_PERIOD = 10u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+TCPBenchmarkClients::TCPBenchmarkClients() :
+        MARTe::EmbeddedServiceMethodBinderI(), clients(*this) {
+    port = 0u;
+    messages = 0u;
+    taken = 0u;
+    sent = 0u;
+    failed = 0u;
+    messageSize = 0u;
+}
+
+TCPBenchmarkClients::~TCPBenchmarkClients() {
+    Stop();
+}
+
+bool TCPBenchmarkClients::Start(const MARTe::uint16 portIn,
+                                const MARTe::uint32 numberOfClients,
+                                const MARTe::uint32 messagesIn,
+                                const MARTe::uint32 payloadSize) {
+    using namespace MARTe;
+    port = portIn;
+    messages = messagesIn;
+    payload = "\"";
+    uint32 i;
+    for (i = 0u; i < payloadSize; i++) {
+        payload += "x";
+    }
+    payload += "\"";
+    clients.SetName("TCPBenchmarkClients");
+    clients.SetNumberOfPoolThreads(numberOfClients);
+    bool ok = (clients.Start() == ErrorManagement::NoError);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not start the %d clients", numberOfClients);
+    }
+    return ok;
+}
+
+void TCPBenchmarkClients::Stop() {
+    using namespace MARTe;
+    if (clients.Stop() != ErrorManagement::NoError) {
+        if (clients.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop MultiThreadService.");
+        }
+    }
+}
+
+MARTe::uint32 TCPBenchmarkClients::GetNumberOfSent() const {
+    return __atomic_load_n(&sent, __ATOMIC_ACQUIRE);
+}
+
+MARTe::uint32 TCPBenchmarkClients::GetNumberOfFailed() const {
+    return __atomic_load_n(&failed, __ATOMIC_ACQUIRE);
+}
+
+MARTe::uint32 TCPBenchmarkClients::GetMessageSize() const {
+    return __atomic_load_n(&messageSize, __ATOMIC_ACQUIRE);
+}
+
+MARTe::ErrorManagement::ErrorType TCPBenchmarkClients::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        bool send = (__atomic_fetch_add(&taken, 1u, __ATOMIC_ACQ_REL) < messages);
+        if (send) {
+            uint64 stamp = HighResolutionTimer::Counter();
+            StreamString message;
+            bool ok = message.Printf("Destination = BenchmarkSink\nFunction = Count\n+Parameters = {\nClass = ConfigurationDatabase\nparam1 = %d\n", stamp);
+            if (ok) {
+                ok = message.Printf("param2 = %s\n}\n", payload.Buffer());
+            }
+            TCPSocket socket;
+            if (ok) {
+                ok = socket.Open();
+            }
+            if (ok) {
+                ok = socket.Connect("127.0.0.1", port);
+            }
+            if (ok) {
+                uint32 size = static_cast<uint32>(message.Size());
+                __atomic_store_n(&messageSize, size, __ATOMIC_RELEASE);
+                ok = socket.Write(message.Buffer(), size);
+            }
+            (void) socket.Close();
+            if (ok) {
+                (void) __atomic_add_fetch(&sent, 1u, __ATOMIC_ACQ_REL);
+            }
+            else {
+                (void) __atomic_add_fetch(&failed, 1u, __ATOMIC_ACQ_REL);
+            }
+        }
+        else {
+            //Do not let taken wrap around
+            __atomic_store_n(&taken, messages, __ATOMIC_RELEASE);
+            Sleep::MSec(TCP_BENCHMARK_IDLE_PERIOD);
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+} // namespace MARTe2Tutorial
@@ -0,0 +1,155 @@
+/**
+ * @file TCPBenchmarkClients.h
+ * @brief Header file for class TCPBenchmarkClients
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * TCPBenchmarkClients with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef BENCHMARKS_TCPSOCKETMESSAGEPROXYLOAD_TCPBENCHMARKCLIENTS_H_
+#define BENCHMARKS_TCPSOCKETMESSAGEPROXYLOAD_TCPBENCHMARKCLIENTS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "MultiThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief K concurrent loopback clients of a TCPSocketMessageProxy.
+ *
+ * @details Each of the K threads of a MultiThreadService repeatedly takes the
+ * next of the Messages to send and, as the TCPSocketMessageProxy protocol
+ * prescribes, connects, writes the message configuration and closes the
+ * connection. The message calls the Count function of the BenchmarkSink
+ * with param1 set to the HighResolutionTimer::Counter just before connecting
+ * and param2 set to a string of PayloadSize characters.
+ */
+class TCPBenchmarkClients : public MARTe::EmbeddedServiceMethodBinderI {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    TCPBenchmarkClients();
+
+    /**
+     * @brief Destructor. Calls Stop.
+     */
+    virtual ~TCPBenchmarkClients();
+
+    /**
+     * @brief Starts the clients.
+     * @param[in] portIn the port of the proxy (on 127.0.0.1).
+     * @param[in] numberOfClients the number of concurrent clients (K).
+     * @param[in] messagesIn the total number of messages.
+     * @param[in] payloadSize the number of characters of param2.
+     * @return true if the threads are started.
+     */
+    bool Start(const MARTe::uint16 portIn,
+               const MARTe::uint32 numberOfClients,
+               const MARTe::uint32 messagesIn,
+               const MARTe::uint32 payloadSize);
+
+    /**
+     * @brief Stops the clients.
+     */
+    void Stop();
+
+    /**
+     * @brief Gets the number of messages which were written.
+     * @return the number of messages which were written.
+     */
+    MARTe::uint32 GetNumberOfSent() const;
+
+    /**
+     * @brief Gets the number of messages which could not be written.
+     * @return the number of failed connections or writes.
+     */
+    MARTe::uint32 GetNumberOfFailed() const;
+
+    /**
+     * @brief Gets the size of the message configuration.
+     * @return the number of bytes written per message.
+     */
+    MARTe::uint32 GetMessageSize() const;
+
+    /**
+     * @brief Sends the next message. Called by the client threads.
+     * @param[in] info see EmbeddedServiceMethodBinderI::Execute.
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+private:
+    /**
+     * The client threads.
+     */
+    MARTe::MultiThreadService clients;
+
+    /**
+     * The port of the proxy.
+     */
+    MARTe::uint16 port;
+
+    /**
+     * Total number of messages.
+     */
+    MARTe::uint32 messages;
+
+    /**
+     * Number of messages taken by the threads.
+     */
+    volatile MARTe::uint32 taken;
+
+    /**
+     * Number of written messages.
+     */
+    volatile MARTe::uint32 sent;
+
+    /**
+     * Number of failed messages.
+     */
+    volatile MARTe::uint32 failed;
+
+    /**
+     * The payload (param2), quoted.
+     */
+    MARTe::StreamString payload;
+
+    /**
+     * The size of the last written message.
+     */
+    volatile MARTe::uint32 messageSize;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKS_TCPSOCKETMESSAGEPROXYLOAD_TCPBENCHMARKCLIENTS_H_ */
@@ -0,0 +1,115 @@
+/**
+ * @file TCPBenchmarkSink.cpp
+ * @brief Source file for class TCPBenchmarkSink
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TCPBenchmarkSink (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CLASSMETHODREGISTER.h"
+#include "HighResolutionTimer.h"
+#include "TCPBenchmarkSink.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+TCPBenchmarkSink::TCPBenchmarkSink() :
+        MARTe::Object(), MARTe::MessageI() {
+    using namespace MARTe;
+    maxMessages = 0u;
+    latencies = NULL_PTR(uint64 *);
+    received = 0u;
+    lastReceptionTime = 0u;
+
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
+}
+
+TCPBenchmarkSink::~TCPBenchmarkSink() {
+    if (latencies != NULL_PTR(MARTe::uint64 *)) {
+        delete[] latencies;
+    }
+}
+
+bool TCPBenchmarkSink::Configure(const MARTe::uint32 maxMessagesIn) {
+    using namespace MARTe;
+    bool ok = ((maxMessagesIn > 0u) && (latencies == NULL_PTR(uint64 *)));
+    if (ok) {
+        latencies = new uint64[maxMessagesIn];
+        maxMessages = maxMessagesIn;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "The number of messages shall be > 0");
+    }
+    return ok;
+}
+
+MARTe::ErrorManagement::ErrorType TCPBenchmarkSink::Count(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    uint64 now = HighResolutionTimer::Counter();
+    uint64 stamp = 0u;
+    ErrorManagement::ErrorType err;
+    err.parametersError = !data.Read("param1", stamp);
+    if (err.ErrorsCleared()) {
+        uint32 idx = __atomic_fetch_add(&received, 1u, __ATOMIC_ACQ_REL);
+        if (idx < maxMessages) {
+            latencies[idx] = (now > stamp) ? (now - stamp) : (0u);
+        }
+        __atomic_store_n(&lastReceptionTime, now, __ATOMIC_RELEASE);
+    }
+    return err;
+}
+
+MARTe::uint32 TCPBenchmarkSink::GetNumberOfReceived() const {
+    return __atomic_load_n(&received, __ATOMIC_ACQUIRE);
+}
+
+MARTe::uint64 TCPBenchmarkSink::GetLatency(const MARTe::uint32 idx) const {
+    MARTe::uint64 latency = 0u;
+    if (idx < maxMessages) {
+        latency = latencies[idx];
+    }
+    return latency;
+}
+
+MARTe::uint64 TCPBenchmarkSink::GetLastReceptionTime() const {
+    return __atomic_load_n(&lastReceptionTime, __ATOMIC_ACQUIRE);
+}
+
+CLASS_REGISTER(TCPBenchmarkSink, "")
+CLASS_METHOD_REGISTER(TCPBenchmarkSink, Count)
+} // namespace MARTe2Tutorial
@@ -0,0 +1,139 @@
+/**
+ * @file TCPBenchmarkSink.h
+ * @brief Header file for class TCPBenchmarkSink
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * TCPBenchmarkSink with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef BENCHMARKS_TCPSOCKETMESSAGEPROXYLOAD_TCPBENCHMARKSINK_H_
+#define BENCHMARKS_TCPSOCKETMESSAGEPROXYLOAD_TCPBENCHMARKSINK_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MessageI.h"
+#include "Object.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Destination of the messages relayed by the TCPSocketMessageProxy
+ * under benchmark. Counts them and records their latency.
+ *
+ * @details The messages shall call the Count function with param1 set to the
+ * HighResolutionTimer::Counter taken by the client just before connecting.
+ * Count may be called concurrently by all the threads of the proxy.
+ *
+ * <pre>
+ * +BenchmarkSink = {
+ *     Class = TCPBenchmarkSink
+ * }
+ * </pre>
+ */
+class TCPBenchmarkSink : public MARTe::Object, public MARTe::MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the RegisteredMethodsMessageFilter.
+     */
+    TCPBenchmarkSink();
+
+    /**
+     * @brief Destructor. Frees the latencies.
+     */
+    virtual ~TCPBenchmarkSink();
+
+    /**
+     * @brief Allocates the latencies. Shall be called before the first
+     * message is sent.
+     * @param[in] maxMessages the maximum number of recorded messages.
+     * @return true if maxMessages > 0.
+     */
+    bool Configure(const MARTe::uint32 maxMessages);
+
+    /**
+     * @brief Records the latency of a message.
+     * @details Registered for RPC.
+     * @param[in] data shall contain param1 (the client counter).
+     * @return ErrorManagement::NoError if param1 can be read.
+     */
+    MARTe::ErrorManagement::ErrorType Count(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Gets the number of received messages.
+     * @return the number of received messages.
+     */
+    MARTe::uint32 GetNumberOfReceived() const;
+
+    /**
+     * @brief Gets the latency of a message.
+     * @param[in] idx the message index (in order of arrival).
+     * @return the latency in ticks of the HighResolutionTimer.
+     */
+    MARTe::uint64 GetLatency(const MARTe::uint32 idx) const;
+
+    /**
+     * @brief Gets the reception time of the last message.
+     * @return the HighResolutionTimer::Counter at the last reception.
+     */
+    MARTe::uint64 GetLastReceptionTime() const;
+
+private:
+    /**
+     * The maximum number of recorded messages.
+     */
+    MARTe::uint32 maxMessages;
+
+    /**
+     * The latency of each message.
+     */
+    MARTe::uint64 *latencies;
+
+    /**
+     * Number of received messages.
+     */
+    volatile MARTe::uint32 received;
+
+    /**
+     * Reception time of the last message.
+     */
+    volatile MARTe::uint64 lastReceptionTime;
+
+    /**
+     * The message filter.
+     */
+    MARTe::ReferenceT<MARTe::RegisteredMethodsMessageFilter> filter;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKS_TCPSOCKETMESSAGEPROXYLOAD_TCPBENCHMARKSINK_H_ */
@@ -0,0 +1,302 @@
+/**
+ * @file TCPSocketMessageProxyBenchmark.cpp
+ * @brief Source file for the TCPSocketMessageProxyBenchmark tool
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details Loads a TCPSocketMessageProxy with CLIENTS concurrent loopback
+ * clients (TCPBenchmarkClients) which send MESSAGES messages in total, each
+ * with a PAYLOAD_BYTES string parameter, to a TCPBenchmarkSink destination.
+ *
+ * The latency of a message is measured from just before the client connects
+ * until the proxy calls the sink (accept, read, parse, Message::Initialise
+ * and SendMessage). The throughput is the number of received messages over
+ * the time from the start of the clients to the last reception. Messages
+ * which were written but never reached the sink (e.g. larger than what the
+ * proxy reads at once) are reported as lost.
+ *
+ * The number of threads of the process (from /proc/self/status) is sampled
+ * before the clients start (threads_idle) and during the load; threads_peak
+ * is the maximum observed minus the CLIENTS client threads.
+ *
+ * Build: make -f Makefile.gcc (built with the other components).
+ *
+ * Usage:
+ * TCPSocketMessageProxyBenchmark.ex CSV_FILE [CLIENTS] [MESSAGES] [PAYLOAD_BYTES] [PORT]
+ * e.g.
+ * ./TCPSocketMessageProxyBenchmark.ex proxy.csv 8 10000 64 24690 2>/dev/null
+ *
+ * One line is appended to CSV_FILE (with a header if the file is empty) and
+ * printed on the standard output:
+ * clients,messages,payload_bytes,message_bytes,sent,failed,received,lost,
+ * messages_per_s,latency_p50_us,latency_p99_us,latency_p999_us,
+ * latency_max_us,threads_idle,threads_peak
+ *
+ * The errors of the framework (the proxy reports every message) are printed
+ * on the standard error.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "TCPBenchmarkClients.h"
+#include "TCPBenchmarkSink.h"
+#include "TCPSocketMessageProxy.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * The run ends when no message was sent nor received for this time (ms).
+ */
+const MARTe::uint32 TCP_BENCHMARK_IDLE_TIMEOUT = 5000u;
+
+/**
+ * Polling period (ms) of the main thread.
+ */
+const MARTe::uint32 TCP_BENCHMARK_POLL_PERIOD = 10u;
+
+/**
+ * @brief Prints the errors of the framework on the standard error.
+ */
+void BenchmarkErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                   const MARTe::char8 * const errorDescription) {
+    fprintf(stderr, "[%s:%d] %s\n", errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+/**
+ * @brief Gets the number of threads of the process.
+ * @return the Threads entry of /proc/self/status (0 if it cannot be read).
+ */
+MARTe::uint32 NumberOfThreads() {
+    MARTe::uint32 threads = 0u;
+    FILE *status = fopen("/proc/self/status", "r");
+    if (status != NULL) {
+        char line[256];
+        while (fgets(line, static_cast<int>(sizeof(line)), status) != NULL) {
+            unsigned int n = 0u;
+            if (sscanf(line, "Threads: %u", &n) == 1) {
+                threads = n;
+            }
+        }
+        (void) fclose(status);
+    }
+    return threads;
+}
+
+/**
+ * @brief qsort comparator.
+ */
+int CompareFloat64(const void *a,
+                   const void *b) {
+    MARTe::float64 x = *static_cast<const MARTe::float64 *>(a);
+    MARTe::float64 y = *static_cast<const MARTe::float64 *>(b);
+    return (x < y) ? (-1) : ((x > y) ? (1) : (0));
+}
+
+/**
+ * @brief Gets the nearest-rank percentile of sorted values.
+ * @return the percentile or -1 if there are no values.
+ */
+MARTe::float64 Percentile(const MARTe::float64 * const sorted,
+                          const MARTe::uint32 n,
+                          const MARTe::float64 p) {
+    MARTe::float64 value = -1.0;
+    if (n > 0u) {
+        MARTe::uint32 rank = static_cast<MARTe::uint32>((p * static_cast<MARTe::float64>(n)) + 0.999999);
+        if (rank < 1u) {
+            rank = 1u;
+        }
+        if (rank > n) {
+            rank = n;
+        }
+        value = sorted[rank - 1u];
+    }
+    return value;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+int main(int argc,
+         char **argv) {
+    using namespace MARTe;
+    using namespace MARTe2Tutorial;
+    ErrorManagement::SetErrorProcessFunction(&BenchmarkErrorProcessFunction);
+    bool ok = (argc >= 2);
+    if (!ok) {
+        fprintf(stderr, "Usage: %s CSV_FILE [CLIENTS] [MESSAGES] [PAYLOAD_BYTES] [PORT]\n", argv[0]);
+    }
+    uint32 numberOfClients = 4u;
+    uint32 messages = 10000u;
+    uint32 payloadSize = 64u;
+    uint16 port = 24690u;
+    if (ok) {
+        if (argc > 2) {
+            numberOfClients = static_cast<uint32>(strtoul(argv[2], NULL, 10));
+        }
+        if (argc > 3) {
+            messages = static_cast<uint32>(strtoul(argv[3], NULL, 10));
+        }
+        if (argc > 4) {
+            payloadSize = static_cast<uint32>(strtoul(argv[4], NULL, 10));
+        }
+        if (argc > 5) {
+            port = static_cast<uint16>(strtoul(argv[5], NULL, 10));
+        }
+        ok = ((numberOfClients > 0u) && (messages > 0u));
+        if (!ok) {
+            fprintf(stderr, "CLIENTS and MESSAGES shall be > 0\n");
+        }
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        StreamString cfg;
+        ok = cfg.Printf("+BenchmarkSink = {\n    Class = TCPBenchmarkSink\n}\n+TCPMessageProxy = {\n    Class = TCPSocketMessageProxy\n    Port = %d\n}\n",
+                        port);
+        if (ok) {
+            ok = cfg.Seek(0LLU);
+        }
+        if (ok) {
+            StreamString err;
+            StandardParser parser(cfg, cdb, &err);
+            ok = parser.Parse();
+            if (!ok) {
+                fprintf(stderr, "Could not parse the configuration: %s\n", err.Buffer());
+            }
+        }
+        if (ok) {
+            ok = cdb.MoveToRoot();
+        }
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<TCPBenchmarkSink> sink;
+    //Typed, so that the proxy (and its class registration) is linked from the static library
+    ReferenceT<TCPSocketMessageProxy> proxy;
+    if (ok) {
+        ok = ord->Initialise(cdb);
+        if (!ok) {
+            fprintf(stderr, "Could not initialise the TCPSocketMessageProxy\n");
+        }
+    }
+    if (ok) {
+        sink = ord->Find("BenchmarkSink");
+        proxy = ord->Find("TCPMessageProxy");
+        ok = ((sink.IsValid()) && (proxy.IsValid()));
+    }
+    if (ok) {
+        ok = sink->Configure(messages);
+    }
+    //Load
+    TCPBenchmarkClients clients;
+    uint32 threadsIdle = NumberOfThreads();
+    uint32 threadsPeak = threadsIdle;
+    uint64 start = HighResolutionTimer::Counter();
+    if (ok) {
+        ok = clients.Start(port, numberOfClients, messages, payloadSize);
+    }
+    if (ok) {
+        uint32 lastProgress = 0u;
+        uint64 lastProgressTime = HighResolutionTimer::Counter();
+        bool done = false;
+        while (!done) {
+            Sleep::MSec(TCP_BENCHMARK_POLL_PERIOD);
+            uint32 threads = NumberOfThreads();
+            if (threads > threadsPeak) {
+                threadsPeak = threads;
+            }
+            uint32 progress = sink->GetNumberOfReceived() + clients.GetNumberOfSent() + clients.GetNumberOfFailed();
+            if (progress != lastProgress) {
+                lastProgress = progress;
+                lastProgressTime = HighResolutionTimer::Counter();
+            }
+            done = ((sink->GetNumberOfReceived() + clients.GetNumberOfFailed()) >= messages);
+            if (!done) {
+                float64 idle = static_cast<float64>(HighResolutionTimer::Counter() - lastProgressTime) * HighResolutionTimer::Period() * 1e3;
+                done = (idle > static_cast<float64>(TCP_BENCHMARK_IDLE_TIMEOUT));
+            }
+        }
+        clients.Stop();
+        //Let the proxy threads which are still relaying finish
+        Sleep::MSec(TCP_BENCHMARK_POLL_PERIOD);
+    }
+    if (ok) {
+        uint32 received = sink->GetNumberOfReceived();
+        if (received > messages) {
+            received = messages;
+        }
+        float64 *latencies = new float64[messages];
+        uint32 i;
+        for (i = 0u; i < received; i++) {
+            latencies[i] = static_cast<float64>(sink->GetLatency(i)) * HighResolutionTimer::Period() * 1e6;
+        }
+        qsort(latencies, received, sizeof(float64), &CompareFloat64);
+        float64 messagesPerSecond = -1.0;
+        if (received > 0u) {
+            float64 elapsed = static_cast<float64>(sink->GetLastReceptionTime() - start) * HighResolutionTimer::Period();
+            if (elapsed > 0.0) {
+                messagesPerSecond = static_cast<float64>(received) / elapsed;
+            }
+        }
+        uint32 sent = clients.GetNumberOfSent();
+        uint32 lost = (sent > received) ? (sent - received) : (0u);
+        threadsPeak = (threadsPeak > numberOfClients) ? (threadsPeak - numberOfClients) : (0u);
+        StreamString row;
+        (void) row.Printf("%d,%d,%d,%d,", numberOfClients, messages, payloadSize, clients.GetMessageSize());
+        (void) row.Printf("%d,%d,%d,%d,", sent, clients.GetNumberOfFailed(), received, lost);
+        (void) row.Printf("%.1f,%.1f,%.1f,", messagesPerSecond, Percentile(latencies, received, 0.5), Percentile(latencies, received, 0.99));
+        (void) row.Printf("%.1f,%.1f,%d,%d", Percentile(latencies, received, 0.999), Percentile(latencies, received, 1.0), threadsIdle, threadsPeak);
+        delete[] latencies;
+        const char8 * const header = "clients,messages,payload_bytes,message_bytes,sent,failed,received,lost,"
+                "messages_per_s,latency_p50_us,latency_p99_us,latency_p999_us,"
+                "latency_max_us,threads_idle,threads_peak";
+        FILE *csv = fopen(argv[1], "a");
+        ok = (csv != NULL);
+        if (ok) {
+            (void) fseek(csv, 0, SEEK_END);
+            if (ftell(csv) == 0) {
+                fprintf(csv, "%s\n", header);
+            }
+            fprintf(csv, "%s\n", row.Buffer());
+            (void) fclose(csv);
+        }
+        else {
+            fprintf(stderr, "Could not open %s\n", argv[1]);
+        }
+        printf("%s\n%s\n", header, row.Buffer());
+    }
+    sink = Reference();
+    proxy = Reference();
+    ord->Purge();
+    return (ok) ? (0) : (1);
+}
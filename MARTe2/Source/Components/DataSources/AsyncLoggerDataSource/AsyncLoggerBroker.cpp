@@ -0,0 +1,100 @@
+/**
+ * @file AsyncLoggerBroker.cpp
+ * @brief Source file for class AsyncLoggerBroker
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class AsyncLoggerBroker (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "AsyncLoggerBroker.h"
+#include "HotPathTrace.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+AsyncLoggerBroker::AsyncLoggerBroker() :
+        MARTe::MemoryMapBroker() {
+    ring = NULL_PTR(AsyncLoggerDataSource *);
+    slotSize = 0u;
+    decimation = 1u;
+    countdown = 0u;
+}
+
+AsyncLoggerBroker::~AsyncLoggerBroker() {
+}
+
+bool AsyncLoggerBroker::Init(const MARTe::SignalDirection direction, MARTe::DataSourceI &dataSourceIn, const MARTe::char8 * const functionName,
+                  void * const gamMemoryAddress) {
+    using namespace MARTe;
+    bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
+    if (ok) {
+        ring = dynamic_cast<AsyncLoggerDataSource *>(&dataSourceIn);
+        ok = (ring != NULL_PTR(AsyncLoggerDataSource *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The DataSource shall be an AsyncLoggerDataSource");
+        }
+    }
+    if (ok) {
+        slotSize = ring->GetSampleSize();
+        decimation = ring->GetDecimation();
+        countdown = 0u;
+    }
+    return ok;
+}
+
+bool AsyncLoggerBroker::Execute() {
+    using namespace MARTe;
+    HOT_PATH_TRACE_BEGIN("AsyncLoggerBroker::Execute");
+    if (countdown > 0u) {
+        countdown--;
+    }
+    else {
+        countdown = decimation - 1u;
+        uint32 slot = 0u;
+        if (ring->BeginWrite(slot)) {
+            uint32 numberOfCopies = GetNumberOfCopies();
+            uint32 offset = slot * slotSize;
+            uint32 n;
+            for (n = 0u; n < numberOfCopies; n++) {
+                char8 *destination = static_cast<char8 *>(copyTable[n].dataSourcePointer);
+                (void) MemoryOperationsHelper::Copy(&destination[offset], copyTable[n].gamPointer, copyTable[n].copySize);
+            }
+            ring->EndWrite();
+        }
+    }
+    HOT_PATH_TRACE_END("AsyncLoggerBroker::Execute");
+    return true;
+}
+
+CLASS_REGISTER(AsyncLoggerBroker, "")
+} // namespace MARTe2Tutorial
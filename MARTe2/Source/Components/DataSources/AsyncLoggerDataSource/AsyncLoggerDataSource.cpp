@@ -0,0 +1,467 @@
+/**
+ * @file AsyncLoggerDataSource.cpp
+ * @brief Source file for class AsyncLoggerDataSource
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class AsyncLoggerDataSource (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "AsyncLoggerBroker.h"
+#include "AsyncLoggerDataSource.h"
+#include "HotPathTrace.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Cache line size of the supported targets (x86-64 and armv8).
+ */
+const MARTe::uint32 ASYNC_LOGGER_CACHE_LINE_SIZE = 64u;
+
+/**
+ * Largest alignment of a signal in a slot (that of the 64 bit types).
+ */
+const MARTe::uint32 ASYNC_LOGGER_MAX_ALIGNMENT = 8u;
+
+/**
+ * @brief Natural alignment of a type: its size rounded up to a power of 2,
+ * at most ASYNC_LOGGER_MAX_ALIGNMENT.
+ */
+MARTe::uint32 GetAlignment(const MARTe::TypeDescriptor &type) {
+    MARTe::uint32 size = static_cast<MARTe::uint32>(type.numberOfBits) / 8u;
+    MARTe::uint32 alignment = 1u;
+    while ((alignment < size) && (alignment < ASYNC_LOGGER_MAX_ALIGNMENT)) {
+        alignment *= 2u;
+    }
+    return alignment;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+AsyncLoggerDataSource::AsyncLoggerDataSource() :
+        MARTe::DataSourceI(), MARTe::EmbeddedServiceMethodBinderI(), executor(*this) {
+    using namespace MARTe;
+    depth = 1024u;
+    decimation = 1u;
+    binary = false;
+    flushPeriod = 100u;
+    rawMemory = NULL_PTR(void *);
+    slots = NULL_PTR(char8 *);
+    producerLine = NULL_PTR(volatile uint32 *);
+    consumerLine = NULL_PTR(volatile uint32 *);
+    sampleSize = 0u;
+    packedSize = 0u;
+    signalOffsets = NULL_PTR(uint32 *);
+    signalSizes = NULL_PTR(uint32 *);
+    packed = NULL_PTR(char8 *);
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+}
+
+AsyncLoggerDataSource::~AsyncLoggerDataSource() {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (rawMemory != NULL_PTR(void *)) {
+        Drain();
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(rawMemory);
+    }
+    if (packed != NULL_PTR(char8 *)) {
+        void *packedMemory = packed;
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(packedMemory);
+    }
+    if (file.IsValid()) {
+        (void) file.Close();
+    }
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+    if (signalSizes != NULL_PTR(uint32 *)) {
+        delete[] signalSizes;
+    }
+}
+
+void AsyncLoggerDataSource::Purge(MARTe::ReferenceContainer &purgeList) {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (rawMemory != NULL_PTR(void *)) {
+        Drain();
+    }
+    DataSourceI::Purge(purgeList);
+}
+
+bool AsyncLoggerDataSource::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::Initialise(data);
+    if (ok) {
+        (void) data.Read("Depth", depth);
+        ok = ((depth >= 2u) && ((depth & (depth - 1u)) == 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Depth shall be a power of 2 >= 2");
+        }
+    }
+    if (ok) {
+        (void) data.Read("Decimation", decimation);
+        ok = (decimation > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Decimation shall be > 0");
+        }
+    }
+    if (ok) {
+        StreamString format = "Text";
+        (void) data.Read("Format", format);
+        if (format == "Binary") {
+            binary = true;
+            ok = data.Read("FileName", fileName);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "FileName shall be specified with Format = Binary");
+            }
+        }
+        else if (format == "Text") {
+            binary = false;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "Format %s is not supported. Use Text or Binary", format.Buffer());
+        }
+    }
+    if (ok) {
+        (void) data.Read("FlushPeriod", flushPeriod);
+        ok = (flushPeriod > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "FlushPeriod shall be > 0");
+        }
+    }
+    if (ok) {
+        (void) data.Read("CPUs", cpuMask);
+        (void) data.Read("StackSize", stackSize);
+    }
+    return ok;
+}
+
+bool AsyncLoggerDataSource::SetConfiguredDatabase(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 numberOfSignals = GetNumberOfSignals();
+    uint32 producers = 0u;
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfFunctions()) && (ok); i++) {
+        uint32 nOfInputs = 0u;
+        uint32 nOfOutputs = 0u;
+        ok = GetFunctionNumberOfSignals(InputSignals, i, nOfInputs);
+        if (ok) {
+            ok = GetFunctionNumberOfSignals(OutputSignals, i, nOfOutputs);
+        }
+        if ((ok) && (nOfInputs > 0u)) {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "The signals of an AsyncLoggerDataSource cannot be read");
+        }
+        if ((ok) && (nOfOutputs > 0u)) {
+            producers++;
+            ok = (nOfOutputs == numberOfSignals);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The producer shall write all the %d signals", numberOfSignals);
+            }
+        }
+        uint32 j;
+        for (j = 0u; (j < nOfOutputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(OutputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be written with Samples = 1");
+            }
+        }
+    }
+    if (ok) {
+        ok = (producers == 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Exactly one GAM shall write to an AsyncLoggerDataSource (found %d)", producers);
+        }
+    }
+    if (ok) {
+        signalOffsets = new uint32[numberOfSignals];
+        signalSizes = new uint32[numberOfSignals];
+        sampleSize = 0u;
+        packedSize = 0u;
+        uint32 slotAlignment = 1u;
+        for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+            signalSizes[i] = 0u;
+            ok = GetSignalByteSize(i, signalSizes[i]);
+            //Each signal at its natural alignment, so that the GAMs and the broker never access unaligned 64 bit values
+            uint32 alignment = GetAlignment(GetSignalType(i));
+            if (alignment > slotAlignment) {
+                slotAlignment = alignment;
+            }
+            signalOffsets[i] = ((sampleSize + alignment - 1u) / alignment) * alignment;
+            sampleSize = signalOffsets[i] + signalSizes[i];
+            packedSize += signalSizes[i];
+        }
+        //The next slot starts aligned as its first signal
+        sampleSize = ((sampleSize + slotAlignment - 1u) / slotAlignment) * slotAlignment;
+    }
+    return ok;
+}
+
+bool AsyncLoggerDataSource::AllocateMemory() {
+    using namespace MARTe;
+    //Producer line + consumer line + slots + room for the alignment
+    uint32 memorySize = (3u * ASYNC_LOGGER_CACHE_LINE_SIZE) + (depth * sampleSize);
+    rawMemory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize);
+    bool ok = (rawMemory != NULL_PTR(void *));
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(rawMemory, '\0', memorySize);
+    }
+    if (ok) {
+        uintp aligned = reinterpret_cast<uintp>(rawMemory);
+        aligned = (aligned + (ASYNC_LOGGER_CACHE_LINE_SIZE - 1u)) & ~static_cast<uintp>(ASYNC_LOGGER_CACHE_LINE_SIZE - 1u);
+        producerLine = reinterpret_cast<volatile uint32 *>(aligned);
+        consumerLine = reinterpret_cast<volatile uint32 *>(aligned + ASYNC_LOGGER_CACHE_LINE_SIZE);
+        slots = reinterpret_cast<char8 *>(aligned + (2u * ASYNC_LOGGER_CACHE_LINE_SIZE));
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate %d bytes", memorySize);
+    }
+    //The file is packed: the samples with padding are packed in this buffer before being written
+    if ((ok) && (binary) && (packedSize != sampleSize)) {
+        uint32 packedMemorySize = depth * packedSize;
+        packed = static_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(packedMemorySize));
+        ok = (packed != NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate %d bytes", packedMemorySize);
+        }
+    }
+    if ((ok) && (binary)) {
+        ok = file.Open(fileName.Buffer(), File::ACCESS_MODE_W | File::FLAG_CREAT | File::FLAG_TRUNC);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not open %s", fileName.Buffer());
+        }
+        if (ok) {
+            StreamString header = "AsyncLogger\n";
+            uint32 i;
+            for (i = 0u; (i < GetNumberOfSignals()) && (ok); i++) {
+                StreamString signalName;
+                uint32 numberOfElements = 0u;
+                ok = GetSignalName(i, signalName);
+                if (ok) {
+                    ok = GetSignalNumberOfElements(i, numberOfElements);
+                }
+                if (ok) {
+                    const char8 *typeName = TypeDescriptor::GetTypeNameFromTypeDescriptor(GetSignalType(i));
+                    ok = header.Printf("%s %s %d\n", signalName.Buffer(), typeName, numberOfElements);
+                }
+            }
+            header += "\n";
+            uint32 size = static_cast<uint32>(header.Size());
+            if (ok) {
+                ok = file.Write(header.Buffer(), size);
+            }
+        }
+    }
+    if (ok) {
+        executor.SetName(GetName());
+        executor.SetCPUMask(cpuMask);
+        executor.SetStackSize(stackSize);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start SingleThreadService");
+        }
+    }
+    return ok;
+}
+
+MARTe::uint32 AsyncLoggerDataSource::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool AsyncLoggerDataSource::GetSignalMemoryBuffer(const MARTe::uint32 signalIdx, const MARTe::uint32 bufferIdx, void *&signalAddress) {
+    using namespace MARTe;
+    bool ok = (slots != NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((signalIdx < GetNumberOfSignals()) && (bufferIdx == 0u));
+    }
+    if (ok) {
+        signalAddress = &slots[signalOffsets[signalIdx]];
+    }
+    return ok;
+}
+
+const MARTe::char8 *AsyncLoggerDataSource::GetBrokerName(MARTe::StructuredDataI &data, const MARTe::SignalDirection direction) {
+    using namespace MARTe;
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == OutputSignals) {
+        brokerName = "AsyncLoggerBroker";
+    }
+    return brokerName;
+}
+
+bool AsyncLoggerDataSource::GetInputBrokers(MARTe::ReferenceContainer &inputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    return false;
+}
+
+bool AsyncLoggerDataSource::GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<AsyncLoggerBroker> broker(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+    if (ok) {
+        ok = outputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool AsyncLoggerDataSource::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    uint32 dropped = __atomic_exchange_n(&producerLine[1], 0u, __ATOMIC_RELAXED);
+    if (dropped > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d samples were dropped because the ring was full", dropped);
+    }
+    return true;
+}
+
+bool AsyncLoggerDataSource::Synchronise() {
+    return true;
+}
+
+MARTe::ErrorManagement::ErrorType AsyncLoggerDataSource::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        Sleep::MSec(flushPeriod);
+        HOT_PATH_TRACE_BEGIN("AsyncLoggerDataSource::Drain");
+        Drain();
+        HOT_PATH_TRACE_END("AsyncLoggerDataSource::Drain");
+    }
+    return ErrorManagement::NoError;
+}
+
+MARTe::uint32 AsyncLoggerDataSource::GetSampleSize() const {
+    return sampleSize;
+}
+
+MARTe::uint32 AsyncLoggerDataSource::GetDecimation() const {
+    return decimation;
+}
+
+bool AsyncLoggerDataSource::BeginWrite(MARTe::uint32 &slot) {
+    using namespace MARTe;
+    uint32 written = producerLine[0];
+    bool ok = ((written - __atomic_load_n(&consumerLine[0], __ATOMIC_ACQUIRE)) < depth);
+    if (ok) {
+        slot = written & (depth - 1u);
+    }
+    else {
+        (void) __atomic_add_fetch(&producerLine[1], 1u, __ATOMIC_RELAXED);
+    }
+    return ok;
+}
+
+void AsyncLoggerDataSource::EndWrite() {
+    __atomic_store_n(&producerLine[0], producerLine[0] + 1u, __ATOMIC_RELEASE);
+}
+
+void AsyncLoggerDataSource::Drain() {
+    using namespace MARTe;
+    uint32 written = __atomic_load_n(&producerLine[0], __ATOMIC_ACQUIRE);
+    uint32 read = consumerLine[0];
+    while (read != written) {
+        uint32 slot = read & (depth - 1u);
+        uint32 count = 1u;
+        if (binary) {
+            //All the contiguous samples, up to the end of the ring, in one write
+            count = written - read;
+            if (count > (depth - slot)) {
+                count = depth - slot;
+            }
+            const char8 *batch = &slots[slot * sampleSize];
+            if (packed != NULL_PTR(char8 *)) {
+                uint32 numberOfSignals = GetNumberOfSignals();
+                uint32 s;
+                for (s = 0u; s < count; s++) {
+                    const char8 * const sample = &batch[s * sampleSize];
+                    char8 *destination = &packed[s * packedSize];
+                    uint32 i;
+                    for (i = 0u; i < numberOfSignals; i++) {
+                        (void) MemoryOperationsHelper::Copy(destination, &sample[signalOffsets[i]], signalSizes[i]);
+                        destination = &destination[signalSizes[i]];
+                    }
+                }
+                batch = packed;
+            }
+            uint32 size = count * packedSize;
+            if (!file.Write(batch, size)) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not write %d samples in %s", count, fileName.Buffer());
+            }
+        }
+        else {
+            PrintSample(&slots[slot * sampleSize]);
+        }
+        read += count;
+        __atomic_store_n(&consumerLine[0], read, __ATOMIC_RELEASE);
+    }
+    if (binary) {
+        (void) file.Flush();
+    }
+}
+
+void AsyncLoggerDataSource::PrintSample(const MARTe::char8 * const sample) {
+    using namespace MARTe;
+    StreamString line;
+    uint32 i;
+    for (i = 0u; i < GetNumberOfSignals(); i++) {
+        StreamString signalName;
+        uint32 numberOfElements = 1u;
+        (void) GetSignalName(i, signalName);
+        (void) GetSignalNumberOfElements(i, numberOfElements);
+        AnyType value(GetSignalType(i), 0u, const_cast<char8 *>(&sample[signalOffsets[i]]));
+        if (numberOfElements > 1u) {
+            value.SetNumberOfDimensions(1u);
+            value.SetNumberOfElements(0u, numberOfElements);
+        }
+        if (i > 0u) {
+            line += " | ";
+        }
+        (void) line.Printf("%s = %!", signalName.Buffer(), value);
+    }
+    REPORT_ERROR(ErrorManagement::Information, "%s", line.Buffer());
+}
+
+CLASS_REGISTER(AsyncLoggerDataSource, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,336 @@
+/**
+ * @file AsyncLoggerDataSource.h
+ * @brief Header file for class AsyncLoggerDataSource
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * AsyncLoggerDataSource with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef DATASOURCES_ASYNCLOGGERDATASOURCE_ASYNCLOGGERDATASOURCE_H_
+#define DATASOURCES_ASYNCLOGGERDATASOURCE_ASYNCLOGGERDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "File.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Logs the signals from a background thread, so that the real-time
+ * thread only copies the raw bytes of the signals.
+ *
+ * @details The AsyncLoggerBroker copies the signals of the GAM directly into
+ * the next slot of a lock-free single-producer/single-consumer ring of Depth
+ * samples (one every Decimation cycles) and never waits: if the ring is full
+ * the sample is dropped and counted. The logging thread, which can be
+ * pinned to other CPUs than the real-time threads, drains the ring every
+ * FlushPeriod ms and either:
+ *  - Format = Text: prints each sample as one line
+ *    (e.g. "Counter = 10 | Time = 1000") through the ErrorManagement, like
+ *    the LoggerDataSource does from the real-time thread;
+ *  - Format = Binary: appends the samples as they are, in batches, to
+ *    FileName.
+ *
+ * In the ring each signal is placed at its natural alignment (e.g. 8 bytes
+ * for a float64) and each slot is padded to the largest alignment, so that
+ * no signal is accessed unaligned.
+ *
+ * The binary file starts with a text header: the line "AsyncLogger", then
+ * one line "Name Type NumberOfElements" per signal, then an empty line. It
+ * is followed by the samples: the signals of a sample are packed in the
+ * order of the header, without padding, in the byte order of the target.
+ * If the slots have padding, the batch is packed before being written.
+ * E.g. with numpy:
+ * <pre>
+ * data = numpy.fromfile(f, dtype=[('Counter', 'u4'), ('Time', 'u4')], offset=header_size)
+ * </pre>
+ *
+ * The dropped samples are reported at every state change.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Logger = {
+ *     Class = AsyncLoggerDataSource
+ *     Depth = 1024 //Optional. Number of samples of the ring. Shall be a power of 2 >= 2. Default = 1024.
+ *     Decimation = 10 //Optional. Log one sample every Decimation cycles. Default = 1.
+ *     Format = Binary //Optional. Text or Binary. Default = Text.
+ *     FileName = "/tmp/RTApp-Log.bin" //Compulsory if Format = Binary. The file is truncated.
+ *     FlushPeriod = 100 //Optional. Period (ms) of the logging thread. Default = 100.
+ *     CPUs = 0x4 //Optional. CPU mask of the logging thread. Default = 0xff.
+ *     StackSize = 1048576 //Optional. Stack size of the logging thread. Default = THREADS_DEFAULT_STACKSIZE.
+ * }
+ * </pre>
+ *
+ * Exactly one GAM shall write all the signals, with Samples = 1. The ring
+ * shall hold at least FlushPeriod ms of (decimated) samples.
+ */
+class AsyncLoggerDataSource : public MARTe::DataSourceI, public MARTe::EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    AsyncLoggerDataSource();
+
+    /**
+     * @brief Destructor. Stops the logging thread, logs the remaining
+     * samples, closes the file and frees the ring memory.
+     */
+    virtual ~AsyncLoggerDataSource();
+
+    /**
+     * @brief Stops the logging thread and logs the remaining samples.
+     * @param[in] purgeList see ReferenceContainer::Purge.
+     */
+    virtual void Purge(MARTe::ReferenceContainer &purgeList);
+
+    /**
+     * @brief Reads the parameters listed in the class description.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if the parameters are valid.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies that there is exactly one producer, which writes all
+     * the signals with Samples = 1, and computes the layout of a sample.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if the constraints above are met.
+     */
+    virtual bool SetConfiguredDatabase(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Allocates the ring, opens the file (Format = Binary) and starts
+     * the logging thread.
+     * @return true if the memory can be allocated, the file opened and the
+     * thread started.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief The broker manages the slots, so only one buffer is exposed.
+     * @return 1u.
+     */
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief Gets the address of the signal in the first slot.
+     * @details The broker computes the address in the other slots by adding a
+     * multiple of GetSampleSize.
+     * @param[in] signalIdx the signal index.
+     * @param[in] bufferIdx shall be 0u.
+     * @param[out] signalAddress the signal address in the first slot.
+     * @return true if signalIdx and bufferIdx are valid.
+     */
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief Gets the broker name.
+     * @return AsyncLoggerBroker for OutputSignals, NULL otherwise.
+     */
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction);
+
+    /**
+     * @brief Input signals are not supported.
+     * @return false.
+     */
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Creates an AsyncLoggerBroker for the producer.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief Reports (and clears) the dropped samples.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Not used, the broker synchronises through the ring indexes.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Drains the ring every FlushPeriod. Called by the logging
+     * thread.
+     * @param[in] info see EmbeddedServiceMethodBinderI::Execute.
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+    /**
+     * @brief Gets the distance in bytes between two consecutive slots.
+     * @return the size of a slot (padded to the largest alignment of the
+     * signals).
+     */
+    MARTe::uint32 GetSampleSize() const;
+
+    /**
+     * @brief Gets the number of cycles per logged sample.
+     * @return the Decimation.
+     */
+    MARTe::uint32 GetDecimation() const;
+
+    /**
+     * @brief Reserves the next slot for the producer. Never waits.
+     * @param[out] slot the slot to be written.
+     * @return false if the ring is full, in which case the sample shall be
+     * dropped.
+     */
+    bool BeginWrite(MARTe::uint32 &slot);
+
+    /**
+     * @brief Publishes the slot reserved by BeginWrite to the logging thread.
+     */
+    void EndWrite();
+
+private:
+    /**
+     * @brief Logs all the samples in the ring.
+     */
+    void Drain();
+
+    /**
+     * @brief Prints a sample as text.
+     * @param[in] sample the first byte of the sample.
+     */
+    void PrintSample(const MARTe::char8 * const sample);
+
+    /**
+     * Number of slots (power of 2).
+     */
+    MARTe::uint32 depth;
+
+    /**
+     * Cycles per logged sample.
+     */
+    MARTe::uint32 decimation;
+
+    /**
+     * True if Format = Binary.
+     */
+    bool binary;
+
+    /**
+     * The binary file name.
+     */
+    MARTe::StreamString fileName;
+
+    /**
+     * The binary file.
+     */
+    MARTe::File file;
+
+    /**
+     * Period of the logging thread in ms.
+     */
+    MARTe::uint32 flushPeriod;
+
+    /**
+     * The raw memory (not aligned).
+     */
+    void *rawMemory;
+
+    /**
+     * The first slot (cache line aligned).
+     */
+    MARTe::char8 *slots;
+
+    /**
+     * Producer cache line: [0] samples published, [1] samples dropped.
+     */
+    volatile MARTe::uint32 *producerLine;
+
+    /**
+     * Consumer cache line: [0] samples logged.
+     */
+    volatile MARTe::uint32 *consumerLine;
+
+    /**
+     * Size in bytes of a slot (signals at their natural alignment).
+     */
+    MARTe::uint32 sampleSize;
+
+    /**
+     * Size in bytes of a sample in the binary file (packed signals).
+     */
+    MARTe::uint32 packedSize;
+
+    /**
+     * Offset of each signal inside a slot.
+     */
+    MARTe::uint32 *signalOffsets;
+
+    /**
+     * Size in bytes of each signal.
+     */
+    MARTe::uint32 *signalSizes;
+
+    /**
+     * Where the binary samples are packed before being written (only if the
+     * slots have padding).
+     */
+    MARTe::char8 *packed;
+
+    /**
+     * The logging thread.
+     */
+    MARTe::SingleThreadService executor;
+
+    /**
+     * The CPU mask of the logging thread.
+     */
+    MARTe::uint32 cpuMask;
+
+    /**
+     * The stack size of the logging thread.
+     */
+    MARTe::uint32 stackSize;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_ASYNCLOGGERDATASOURCE_ASYNCLOGGERDATASOURCE_H_ */
@@ -0,0 +1,628 @@
+/**
+ * @file MDSSegmentReader.cpp
+ * @brief Source file for class MDSSegmentReader
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MDSSegmentReader (public, protected, and private). Be aware that
+ * some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <mdsobjects.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryMapSynchronisedInputBroker.h"
+#include "MDSSegmentReader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Maximum time the prefetch thread waits for a released segment, in ms.
+ * Also the period at which new segments of a growing pulse are looked for.
+ */
+const MARTe::uint32 MDS_SEGMENT_READER_TIMEOUT = 100u;
+
+/**
+ * @brief Writes the element i of a signal of type T.
+ */
+template<typename T>
+void Store(MARTe::char8 * const address, const MARTe::uint32 i, const MARTe::float64 value) {
+    reinterpret_cast<T *>(address)[i] = static_cast<T>(value);
+}
+
+/**
+ * @brief Writes the element i of a signal, rounding to the nearest integer
+ * for the integer types.
+ */
+void StoreValue(const MARTe::TypeDescriptor &type, MARTe::char8 * const address, const MARTe::uint32 i, const MARTe::float64 value) {
+    using namespace MARTe;
+    if (type == Float32Bit) {
+        Store<float32>(address, i, value);
+    }
+    else if (type == Float64Bit) {
+        Store<float64>(address, i, value);
+    }
+    else {
+        float64 rounded = value + ((value < 0.0) ? (-0.5) : (0.5));
+        if (type == UnsignedInteger8Bit) {
+            Store<uint8>(address, i, rounded);
+        }
+        else if (type == SignedInteger8Bit) {
+            Store<int8>(address, i, rounded);
+        }
+        else if (type == UnsignedInteger16Bit) {
+            Store<uint16>(address, i, rounded);
+        }
+        else if (type == SignedInteger16Bit) {
+            Store<int16>(address, i, rounded);
+        }
+        else if (type == UnsignedInteger32Bit) {
+            Store<uint32>(address, i, rounded);
+        }
+        else if (type == SignedInteger32Bit) {
+            Store<int32>(address, i, rounded);
+        }
+        else if (type == UnsignedInteger64Bit) {
+            Store<uint64>(address, i, rounded);
+        }
+        else {
+            Store<int64>(address, i, rounded);
+        }
+    }
+}
+
+/**
+ * @brief Verifies that a type can be replayed.
+ */
+bool IsSupportedType(const MARTe::TypeDescriptor &type) {
+    using namespace MARTe;
+    return ((type == Float32Bit) || (type == Float64Bit) || (type == UnsignedInteger8Bit) || (type == SignedInteger8Bit)
+            || (type == UnsignedInteger16Bit) || (type == SignedInteger16Bit) || (type == UnsignedInteger32Bit) || (type == SignedInteger32Bit)
+            || (type == UnsignedInteger64Bit) || (type == SignedInteger64Bit));
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+MDSSegmentReader::MDSSegmentReader() :
+        MARTe::DataSourceI(), MARTe::EmbeddedServiceMethodBinderI(), executor(*this) {
+    using namespace MARTe;
+    shotNumber = 0;
+    tree = NULL_PTR(MDSplus::Tree *);
+    frequency = 0.0;
+    startTime = 0.0;
+    startTimeSet = false;
+    numberOfCachedSegments = 4u;
+    signals = NULL_PTR(MDSSegmentReaderSignal *);
+    signalOffsets = NULL_PTR(uint32 *);
+    memorySize = 0u;
+    memory = NULL_PTR(char8 *);
+    timeSignalIdx = 0u;
+    timeSignalMultiplier = 1e-6;
+    cycles = 0u;
+    lateCycles = 0u;
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    (void) segmentReleased.Create();
+}
+
+MDSSegmentReader::~MDSSegmentReader() {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (signals != NULL_PTR(MDSSegmentReaderSignal *)) {
+        uint32 i;
+        for (i = 0u; i < GetNumberOfSignals(); i++) {
+            if (signals[i].slots != NULL_PTR(MDSSegmentReaderSlot *)) {
+                uint32 j;
+                for (j = 0u; j < numberOfCachedSegments; j++) {
+                    if (signals[i].slots[j].times != NULL_PTR(float64 *)) {
+                        delete[] signals[i].slots[j].times;
+                    }
+                    if (signals[i].slots[j].values != NULL_PTR(float64 *)) {
+                        delete[] signals[i].slots[j].values;
+                    }
+                }
+                delete[] signals[i].slots;
+            }
+            if (signals[i].node != NULL_PTR(MDSplus::TreeNode *)) {
+                MDSplus::deleteData(signals[i].node);
+            }
+        }
+        delete[] signals;
+    }
+    if (tree != NULL_PTR(MDSplus::Tree *)) {
+        delete tree;
+    }
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+    if (memory != NULL_PTR(char8 *)) {
+        delete[] memory;
+    }
+    (void) segmentReleased.Close();
+}
+
+void MDSSegmentReader::Purge(MARTe::ReferenceContainer &purgeList) {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    DataSourceI::Purge(purgeList);
+}
+
+bool MDSSegmentReader::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::Initialise(data);
+    if (ok) {
+        ok = data.Read("TreeName", treeName);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "TreeName shall be specified");
+        }
+    }
+    if (ok) {
+        ok = data.Read("ShotNumber", shotNumber);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "ShotNumber shall be specified");
+        }
+    }
+    if (ok) {
+        ok = data.Read("Frequency", frequency);
+        if (ok) {
+            ok = (frequency > 0.0);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "A Frequency > 0 shall be specified");
+        }
+    }
+    if (ok) {
+        startTimeSet = data.Read("StartTime", startTime);
+        (void) data.Read("NumberOfCachedSegments", numberOfCachedSegments);
+        ok = (numberOfCachedSegments > 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfCachedSegments shall be > 1");
+        }
+    }
+    if (ok) {
+        (void) data.Read("CPUMask", cpuMask);
+        (void) data.Read("StackSize", stackSize);
+    }
+    return ok;
+}
+
+bool MDSSegmentReader::SetConfiguredDatabase(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfFunctions()) && (ok); i++) {
+        uint32 nOfInputs = 0u;
+        uint32 nOfOutputs = 0u;
+        ok = GetFunctionNumberOfSignals(InputSignals, i, nOfInputs);
+        if (ok) {
+            ok = GetFunctionNumberOfSignals(OutputSignals, i, nOfOutputs);
+        }
+        if ((ok) && (nOfOutputs > 0u)) {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "The signals of a MDSSegmentReader cannot be written");
+        }
+        uint32 j;
+        for (j = 0u; (j < nOfInputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(InputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be read with Samples = 1");
+            }
+        }
+    }
+    if (ok) {
+        try {
+            tree = new MDSplus::Tree(treeName.Buffer(), shotNumber, "READONLY");
+        }
+        catch (const MDSplus::MdsException &exc) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not open the pulse %d of %s: %s", shotNumber, treeName.Buffer(), exc.what());
+            tree = NULL_PTR(MDSplus::Tree *);
+            ok = false;
+        }
+    }
+    uint32 numberOfSignals = GetNumberOfSignals();
+    if (ok) {
+        signals = new MDSSegmentReaderSignal[numberOfSignals];
+        signalOffsets = new uint32[numberOfSignals];
+        timeSignalIdx = numberOfSignals;
+        ok = data.MoveRelative("Signals");
+    }
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        MDSSegmentReaderSignal &signal = signals[i];
+        signal.node = NULL_PTR(MDSplus::TreeNode *);
+        signal.type = GetSignalType(i);
+        signal.linear = false;
+        signal.slots = NULL_PTR(MDSSegmentReaderSlot *);
+        signal.nextSegment = 0;
+        signal.loaded = 0u;
+        signal.consumed = 0u;
+        signal.caughtUp = false;
+        signal.cursor = 0u;
+        StreamString signalName;
+        ok = GetSignalName(i, signalName);
+        if (ok) {
+            ok = data.MoveRelative(data.GetChildName(i));
+        }
+        uint32 byteSize = 0u;
+        if (ok) {
+            ok = GetSignalByteSize(i, byteSize);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(i, signal.numberOfElements);
+        }
+        if (ok) {
+            ok = IsSupportedType(signal.type);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The type of %s is not supported", signalName.Buffer());
+            }
+        }
+        if (ok) {
+            signalOffsets[i] = memorySize;
+            //Keep the signals 64 bits aligned
+            memorySize += (byteSize + 7u) & ~7u;
+            uint32 isTimeSignal = 0u;
+            (void) data.Read("TimeSignal", isTimeSignal);
+            if (isTimeSignal != 0u) {
+                ok = ((timeSignalIdx == numberOfSignals) && (signal.numberOfElements == 1u));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Only one TimeSignal, scalar, can be specified");
+                }
+                if (ok) {
+                    timeSignalIdx = i;
+                    (void) data.Read("TimeSignalMultiplier", timeSignalMultiplier);
+                }
+            }
+            else {
+                ok = data.Read("NodeName", signal.nodeName);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "NodeName shall be specified for %s", signalName.Buffer());
+                }
+            }
+        }
+        if ((ok) && (i != timeSignalIdx)) {
+            StreamString interpolation = "Hold";
+            (void) data.Read("Interpolation", interpolation);
+            signal.linear = (interpolation == "Linear");
+            ok = ((signal.linear) || (interpolation == "Hold"));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The Interpolation of %s shall be Linear or Hold", signalName.Buffer());
+            }
+        }
+        if ((ok) && (i != timeSignalIdx)) {
+            try {
+                signal.node = tree->getNode(signal.nodeName.Buffer());
+            }
+            catch (const MDSplus::MdsException &exc) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Could not find the node %s: %s", signal.nodeName.Buffer(), exc.what());
+                ok = false;
+            }
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    if (ok) {
+        ok = data.MoveToAncestor(1u);
+    }
+    return ok;
+}
+
+bool MDSSegmentReader::AllocateMemory() {
+    using namespace MARTe;
+    memory = new char8[memorySize];
+    bool ok = MemoryOperationsHelper::Set(memory, '\0', memorySize);
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfSignals()) && (ok); i++) {
+        if (signals[i].node != NULL_PTR(MDSplus::TreeNode *)) {
+            signals[i].slots = new MDSSegmentReaderSlot[numberOfCachedSegments];
+            uint32 j;
+            for (j = 0u; j < numberOfCachedSegments; j++) {
+                signals[i].slots[j].times = NULL_PTR(float64 *);
+                signals[i].slots[j].values = NULL_PTR(float64 *);
+                signals[i].slots[j].rows = 0u;
+            }
+        }
+    }
+    //The first segments are decoded before the real-time thread starts
+    if (ok) {
+        ok = Prefetch();
+    }
+    bool first = true;
+    for (i = 0u; (i < GetNumberOfSignals()) && (ok); i++) {
+        if (signals[i].node != NULL_PTR(MDSplus::TreeNode *)) {
+            ok = (signals[i].loaded > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The node %s has no segments", signals[i].nodeName.Buffer());
+            }
+            else if ((!startTimeSet) && ((first) || (signals[i].slots[0u].times[0u] < startTime))) {
+                startTime = signals[i].slots[0u].times[0u];
+                first = false;
+            }
+            else {
+                //NOOP
+            }
+        }
+    }
+    if (ok) {
+        executor.SetName(GetName());
+        executor.SetCPUMask(cpuMask);
+        executor.SetStackSize(stackSize);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start SingleThreadService");
+        }
+    }
+    return ok;
+}
+
+MARTe::uint32 MDSSegmentReader::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool MDSSegmentReader::GetSignalMemoryBuffer(const MARTe::uint32 signalIdx, const MARTe::uint32 bufferIdx, void *&signalAddress) {
+    using namespace MARTe;
+    bool ok = (memory != NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((signalIdx < GetNumberOfSignals()) && (bufferIdx == 0u));
+    }
+    if (ok) {
+        signalAddress = &memory[signalOffsets[signalIdx]];
+    }
+    return ok;
+}
+
+const MARTe::char8 *MDSSegmentReader::GetBrokerName(MARTe::StructuredDataI &data, const MARTe::SignalDirection direction) {
+    using namespace MARTe;
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        brokerName = "MemoryMapSynchronisedInputBroker";
+    }
+    return brokerName;
+}
+
+bool MDSSegmentReader::GetInputBrokers(MARTe::ReferenceContainer &inputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<MemoryMapSynchronisedInputBroker> broker("MemoryMapSynchronisedInputBroker");
+    bool ok = broker.IsValid();
+    if (ok) {
+        ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+    }
+    if (ok) {
+        ok = inputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool MDSSegmentReader::GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    return false;
+}
+
+bool MDSSegmentReader::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    uint32 late = __atomic_exchange_n(&lateCycles, 0u, __ATOMIC_RELAXED);
+    if (late > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d cycles were served before the segments were decoded", late);
+    }
+    return true;
+}
+
+bool MDSSegmentReader::Synchronise() {
+    using namespace MARTe;
+    float64 time = startTime + (static_cast<float64>(cycles) / frequency);
+    bool late = false;
+    uint32 i;
+    for (i = 0u; i < GetNumberOfSignals(); i++) {
+        if (signals[i].slots != NULL_PTR(MDSSegmentReaderSlot *)) {
+            if (!Interpolate(signals[i], time, &memory[signalOffsets[i]])) {
+                late = true;
+            }
+        }
+    }
+    if (timeSignalIdx < GetNumberOfSignals()) {
+        StoreValue(signals[timeSignalIdx].type, &memory[signalOffsets[timeSignalIdx]], 0u, time / timeSignalMultiplier);
+    }
+    if (late) {
+        (void) __atomic_add_fetch(&lateCycles, 1u, __ATOMIC_RELAXED);
+    }
+    cycles++;
+    return true;
+}
+
+bool MDSSegmentReader::Interpolate(MDSSegmentReaderSignal &signal, const MARTe::float64 time, MARTe::char8 * const address) {
+    using namespace MARTe;
+    uint32 loaded = __atomic_load_n(&signal.loaded, __ATOMIC_ACQUIRE);
+    //Release the current segment once the time reaches the next one
+    bool released = false;
+    while (((loaded - signal.consumed) > 1u) && (time >= signal.slots[(signal.consumed + 1u) % numberOfCachedSegments].times[0u])) {
+        __atomic_store_n(&signal.consumed, signal.consumed + 1u, __ATOMIC_RELEASE);
+        signal.cursor = 0u;
+        released = true;
+    }
+    if (released) {
+        (void) segmentReleased.Post();
+    }
+    const MDSSegmentReaderSlot &slot = signal.slots[signal.consumed % numberOfCachedSegments];
+    while (((signal.cursor + 1u) < slot.rows) && (slot.times[signal.cursor + 1u] <= time)) {
+        signal.cursor++;
+    }
+    const float64 *before = &slot.values[signal.cursor * signal.numberOfElements];
+    const float64 *after = NULL_PTR(const float64 *);
+    float64 beforeTime = slot.times[signal.cursor];
+    float64 afterTime = beforeTime;
+    bool ok = true;
+    if ((signal.cursor + 1u) < slot.rows) {
+        after = &before[signal.numberOfElements];
+        afterTime = slot.times[signal.cursor + 1u];
+    }
+    else if ((loaded - signal.consumed) > 1u) {
+        const MDSSegmentReaderSlot &next = signal.slots[(signal.consumed + 1u) % numberOfCachedSegments];
+        after = next.values;
+        afterTime = next.times[0u];
+    }
+    else {
+        //Past the decoded rows: hold the last one
+        ok = ((time <= beforeTime) || (__atomic_load_n(&signal.caughtUp, __ATOMIC_ACQUIRE)));
+    }
+    float64 weight = 0.0;
+    if ((signal.linear) && (after != NULL_PTR(const float64 *)) && (time > beforeTime) && (afterTime > beforeTime)) {
+        weight = (time - beforeTime) / (afterTime - beforeTime);
+    }
+    uint32 e;
+    for (e = 0u; e < signal.numberOfElements; e++) {
+        float64 value = before[e];
+        if (weight > 0.0) {
+            value += weight * (after[e] - value);
+        }
+        StoreValue(signal.type, address, e, value);
+    }
+    return ok;
+}
+
+MARTe::ErrorManagement::ErrorType MDSSegmentReader::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        (void) segmentReleased.Wait(TimeoutType(MDS_SEGMENT_READER_TIMEOUT));
+        //Reset before looking at the slots, so that no Post is lost
+        (void) segmentReleased.Reset();
+        (void) Prefetch();
+    }
+    return ErrorManagement::NoError;
+}
+
+bool MDSSegmentReader::Prefetch() {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; i < GetNumberOfSignals(); i++) {
+        MDSSegmentReaderSignal &signal = signals[i];
+        if (signal.slots != NULL_PTR(MDSSegmentReaderSlot *)) {
+            //Looked up every time, so that the segments of a pulse being written are found
+            int32 numberOfSegments = 0;
+            try {
+                numberOfSegments = signal.node->getNumSegments();
+            }
+            catch (const MDSplus::MdsException &exc) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not read the segments of %s: %s", signal.nodeName.Buffer(), exc.what());
+                ok = false;
+            }
+            uint32 consumed = __atomic_load_n(&signal.consumed, __ATOMIC_ACQUIRE);
+            while ((signal.nextSegment < numberOfSegments) && ((signal.loaded - consumed) < numberOfCachedSegments)) {
+                MDSSegmentReaderSlot &slot = signal.slots[signal.loaded % numberOfCachedSegments];
+                if (Decode(signal, slot, signal.nextSegment)) {
+                    __atomic_store_n(&signal.loaded, signal.loaded + 1u, __ATOMIC_RELEASE);
+                }
+                else {
+                    ok = false;
+                }
+                //A segment which cannot be decoded is skipped
+                signal.nextSegment++;
+            }
+            __atomic_store_n(&signal.caughtUp, (signal.nextSegment >= numberOfSegments), __ATOMIC_RELEASE);
+        }
+    }
+    return ok;
+}
+
+bool MDSSegmentReader::Decode(const MDSSegmentReaderSignal &signal, MDSSegmentReaderSlot &slot, const MARTe::int32 segmentIdx) const {
+    using namespace MARTe;
+    bool ok = true;
+    MDSplus::Array *data = NULL_PTR(MDSplus::Array *);
+    MDSplus::Data *dimension = NULL_PTR(MDSplus::Data *);
+    float64 *values = NULL_PTR(float64 *);
+    float64 *times = NULL_PTR(float64 *);
+    int32 numberOfValues = 0;
+    int32 numberOfTimes = 0;
+    try {
+        data = signal.node->getSegment(segmentIdx);
+        dimension = signal.node->getSegmentDim(segmentIdx);
+        //Range timebases are expanded here, by MDSplus
+        values = data->getDoubleArray(&numberOfValues);
+        times = dimension->getDoubleArray(&numberOfTimes);
+    }
+    catch (const MDSplus::MdsException &exc) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not read the segment %d of %s: %s", segmentIdx, signal.nodeName.Buffer(), exc.what());
+        ok = false;
+    }
+    if (data != NULL_PTR(MDSplus::Array *)) {
+        MDSplus::deleteData(data);
+    }
+    if (dimension != NULL_PTR(MDSplus::Data *)) {
+        MDSplus::deleteData(dimension);
+    }
+    uint32 rows = 0u;
+    if (ok) {
+        ok = ((numberOfValues > 0) && ((static_cast<uint32>(numberOfValues) % signal.numberOfElements) == 0u));
+        if (ok) {
+            rows = static_cast<uint32>(numberOfValues) / signal.numberOfElements;
+            if (static_cast<uint32>(numberOfTimes) < rows) {
+                rows = static_cast<uint32>(numberOfTimes);
+            }
+            ok = (rows > 0u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The segment %d of %s does not have %d elements per row", segmentIdx, signal.nodeName.Buffer(),
+                         signal.numberOfElements);
+        }
+    }
+    if (ok) {
+        //The slot is not used by the real-time thread: adopt the decoded arrays
+        if (slot.times != NULL_PTR(float64 *)) {
+            delete[] slot.times;
+        }
+        if (slot.values != NULL_PTR(float64 *)) {
+            delete[] slot.values;
+        }
+        slot.times = times;
+        slot.values = values;
+        slot.rows = rows;
+    }
+    else {
+        if (times != NULL_PTR(float64 *)) {
+            delete[] times;
+        }
+        if (values != NULL_PTR(float64 *)) {
+            delete[] values;
+        }
+    }
+    return ok;
+}
+
+CLASS_REGISTER(MDSSegmentReader, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,433 @@
+/**
+ * @file MDSSegmentReader.h
+ * @brief Header file for class MDSSegmentReader
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * MDSSegmentReader with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef DATASOURCES_MDSSEGMENTREADER_MDSSEGMENTREADER_H_
+#define DATASOURCES_MDSSEGMENTREADER_MDSSEGMENTREADER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MDSplus {
+class Tree;
+class TreeNode;
+}
+
+namespace MARTe2Tutorial {
+/**
+ * @brief A segment of a signal, decoded by the MDSSegmentReader.
+ */
+struct MDSSegmentReaderSlot {
+    /**
+     * Time of each row in seconds.
+     */
+    MARTe::float64 *times;
+
+    /**
+     * The rows, converted to float64.
+     */
+    MARTe::float64 *values;
+
+    /**
+     * Rows of the segment.
+     */
+    MARTe::uint32 rows;
+};
+
+/**
+ * @brief A signal read by the MDSSegmentReader.
+ * @details The slots are a ring of NumberOfCachedSegments decoded segments.
+ * The prefetch thread owns nextSegment and loaded, the real-time thread
+ * owns consumed and cursor.
+ */
+struct MDSSegmentReaderSignal {
+    /**
+     * Path of the node in the tree.
+     */
+    MARTe::StreamString nodeName;
+
+    /**
+     * The node. NULL for the TimeSignal.
+     */
+    MDSplus::TreeNode *node;
+
+    /**
+     * Type of the signal.
+     */
+    MARTe::TypeDescriptor type;
+
+    /**
+     * Number of elements of a row.
+     */
+    MARTe::uint32 numberOfElements;
+
+    /**
+     * True for linear interpolation, false for zero-order hold.
+     */
+    bool linear;
+
+    /**
+     * The decoded segments.
+     */
+    MDSSegmentReaderSlot *slots;
+
+    /**
+     * Next segment of the node to be decoded.
+     */
+    MARTe::int32 nextSegment;
+
+    /**
+     * Number of segments decoded by the prefetch thread.
+     */
+    volatile MARTe::uint32 loaded;
+
+    /**
+     * Number of segments released by the real-time thread.
+     */
+    volatile MARTe::uint32 consumed;
+
+    /**
+     * True when all the segments of the node have been decoded.
+     */
+    volatile bool caughtUp;
+
+    /**
+     * Row of the current segment at or before the current time.
+     */
+    MARTe::uint32 cursor;
+};
+
+/**
+ * @brief Replays signals stored in MDSplus segments, read ahead by a
+ * background thread.
+ *
+ * @details The prefetch thread reads whole segments (data and timebase)
+ * of each node and decodes them to float64 in a ring of
+ * NumberOfCachedSegments slots per signal, keeping the ring as full as
+ * possible. At every Synchronise the current time advances by
+ * 1 / Frequency and the value of each signal at that time is computed from
+ * the cached segments, either with zero-order hold (the last row at or
+ * before the current time) or with linear interpolation between the two
+ * rows around it (also across two consecutive segments). A segment is
+ * released to the prefetch thread as soon as the current time reaches the
+ * next one, so the real-time thread never accesses the tree.
+ *
+ * Since the time advances by cycles and not by the wall clock, the
+ * playback speed is the ratio between the cycle frequency of the thread and
+ * Frequency: e.g. a 1 kHz LinuxTimer with Frequency = 1 replays 1000
+ * seconds of data per second, as long as the prefetch thread keeps up. The
+ * cycles served while the next segment is not decoded yet hold the last
+ * available row and are reported at every state change.
+ *
+ * Before the first row of a node the first row is served and after the
+ * last one (e.g. a pulse being written) the last row is held.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +MDSReader = {
+ *     Class = MDSSegmentReader
+ *     TreeName = "wrrd" //Compulsory.
+ *     ShotNumber = 0 //Compulsory. 0 = the current pulse.
+ *     Frequency = 1000 //Compulsory. Samples per second of data time, i.e. the time advances by 1 / Frequency per cycle.
+ *     StartTime = 0.0 //Optional. Data time of the first cycle in seconds. Default = the first row of the first segment of all the nodes.
+ *     NumberOfCachedSegments = 4 //Optional. Decoded segments per signal (>= 2). Default = 4.
+ *     CPUMask = 0x2 //Optional. CPU mask of the prefetch thread. Default = 0xff.
+ *     StackSize = 1048576 //Optional. Stack size of the prefetch thread. Default = THREADS_DEFAULT_STACKSIZE.
+ *     Signals = {
+ *         Sin = {
+ *             NodeName = "SIN" //Compulsory, except for the TimeSignal.
+ *             Type = float32
+ *             NumberOfElements = 1
+ *             Interpolation = "Linear" //Optional. "Linear" or "Hold" (zero-order hold). Default = "Hold".
+ *         }
+ *         Timebase = {
+ *             Type = uint32
+ *             TimeSignal = 1 //Optional. The current data time. Only one signal, scalar. Default = 0.
+ *             TimeSignalMultiplier = 1e-6 //Optional. Seconds per unit of the TimeSignal. Default = 1e-6.
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * The signals shall be read with Samples = 1. The number of elements of a
+ * row of the node shall be the NumberOfElements of the signal.
+ */
+class MDSSegmentReader : public MARTe::DataSourceI, public MARTe::EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MDSSegmentReader();
+
+    /**
+     * @brief Destructor. Stops the prefetch thread, closes the tree and
+     * frees the memory.
+     */
+    virtual ~MDSSegmentReader();
+
+    /**
+     * @brief Stops the prefetch thread.
+     * @param[in] purgeList see ReferenceContainer::Purge.
+     */
+    virtual void Purge(MARTe::ReferenceContainer &purgeList);
+
+    /**
+     * @brief Reads the parameters listed in the class description.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if the compulsory parameters are set and the optional ones
+     * are valid.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies that the signals are only read, with Samples = 1,
+     * reads the parameters of each signal and opens the tree.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if the constraints above are met and all the nodes
+     * exist.
+     */
+    virtual bool SetConfiguredDatabase(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Allocates the slots, decodes the first segments and starts the
+     * prefetch thread.
+     * @return true if the first segment of each node can be decoded and the
+     * thread started.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief The signals are computed at Synchronise.
+     * @return 1u.
+     */
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief Gets the address of the signal.
+     * @param[in] signalIdx the signal index.
+     * @param[in] bufferIdx shall be 0u.
+     * @param[out] signalAddress the signal address.
+     * @return true if signalIdx and bufferIdx are valid.
+     */
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief Gets the broker name.
+     * @return MemoryMapSynchronisedInputBroker for InputSignals, NULL
+     * otherwise.
+     */
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction);
+
+    /**
+     * @brief Creates a MemoryMapSynchronisedInputBroker.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Output signals are not supported.
+     * @return false.
+     */
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief Reports (and clears) the cycles served before the segment was
+     * decoded.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Advances the time and computes the signals from the cached
+     * segments.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Decodes the next segments. Called by the prefetch thread.
+     * @param[in] info see EmbeddedServiceMethodBinderI::Execute.
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+private:
+    /**
+     * @brief Decodes segments of each node until all the slots are full or
+     * all the segments are decoded.
+     * @return true if no segment failed to be read.
+     */
+    bool Prefetch();
+
+    /**
+     * @brief Reads and decodes a segment of a node in a slot.
+     * @param[in] signal the signal.
+     * @param[in] slot the slot.
+     * @param[in] segmentIdx the segment.
+     * @return true if the segment is read and has the expected number of
+     * elements per row.
+     */
+    bool Decode(const MDSSegmentReaderSignal &signal,
+                MDSSegmentReaderSlot &slot,
+                const MARTe::int32 segmentIdx) const;
+
+    /**
+     * @brief Computes the value of a signal at a time and writes it in the
+     * signal memory. Releases the segments which are no longer needed.
+     * @param[in] signal the signal.
+     * @param[in] time the time.
+     * @param[out] address the signal memory.
+     * @return false if the time is past the decoded segments while the
+     * prefetch thread has not decoded all the segments yet.
+     */
+    bool Interpolate(MDSSegmentReaderSignal &signal,
+                     const MARTe::float64 time,
+                     MARTe::char8 * const address);
+
+    /**
+     * Name of the tree.
+     */
+    MARTe::StreamString treeName;
+
+    /**
+     * The pulse.
+     */
+    MARTe::int32 shotNumber;
+
+    /**
+     * The open tree.
+     */
+    MDSplus::Tree *tree;
+
+    /**
+     * Data samples per second.
+     */
+    MARTe::float64 frequency;
+
+    /**
+     * Data time of the first cycle.
+     */
+    MARTe::float64 startTime;
+
+    /**
+     * True if StartTime is set.
+     */
+    bool startTimeSet;
+
+    /**
+     * Decoded segments per signal.
+     */
+    MARTe::uint32 numberOfCachedSegments;
+
+    /**
+     * The signals, in the order of the DataSource.
+     */
+    MDSSegmentReaderSignal *signals;
+
+    /**
+     * Offset of each signal inside the memory.
+     */
+    MARTe::uint32 *signalOffsets;
+
+    /**
+     * Size in bytes of the memory.
+     */
+    MARTe::uint32 memorySize;
+
+    /**
+     * The signal memory, read by the broker.
+     */
+    MARTe::char8 *memory;
+
+    /**
+     * Index of the TimeSignal. Equal to the number of signals if there is no
+     * TimeSignal.
+     */
+    MARTe::uint32 timeSignalIdx;
+
+    /**
+     * Seconds per unit of the TimeSignal.
+     */
+    MARTe::float64 timeSignalMultiplier;
+
+    /**
+     * Cycles since the start.
+     */
+    MARTe::uint64 cycles;
+
+    /**
+     * Cycles served before the segment was decoded, since the last state
+     * change.
+     */
+    MARTe::uint32 lateCycles;
+
+    /**
+     * Posted by the real-time thread when a segment is released.
+     */
+    MARTe::EventSem segmentReleased;
+
+    /**
+     * The prefetch thread.
+     */
+    MARTe::SingleThreadService executor;
+
+    /**
+     * The CPU mask of the prefetch thread.
+     */
+    MARTe::uint32 cpuMask;
+
+    /**
+     * The stack size of the prefetch thread.
+     */
+    MARTe::uint32 stackSize;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_MDSSEGMENTREADER_MDSSEGMENTREADER_H_ */
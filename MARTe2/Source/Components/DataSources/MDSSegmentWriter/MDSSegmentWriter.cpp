@@ -0,0 +1,711 @@
+/**
+ * @file MDSSegmentWriter.cpp
+ * @brief Source file for class MDSSegmentWriter
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MDSSegmentWriter (public, protected, and private). Be aware that
+ * some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <mdsdescrip.h>
+#include <mdsshr.h>
+#include <treeshr.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MDSSegmentWriter.h"
+#include "MDSSegmentWriterOutputBroker.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Maximum time the writer thread waits for a full segment, in ms.
+ */
+const MARTe::uint32 MDS_SEGMENT_WRITER_TIMEOUT = 100u;
+
+/**
+ * @brief MDSplus status codes are odd on success.
+ */
+bool IsSuccess(const MARTe::int32 status) {
+    return ((status & 1) != 0);
+}
+
+/**
+ * @brief Gets the MDSplus data type of a MARTe type.
+ * @return false if the type cannot be stored.
+ */
+bool GetMDSplusType(const MARTe::TypeDescriptor &type, MARTe::uint8 &dataType) {
+    using namespace MARTe;
+    bool ok = true;
+    if (type == UnsignedInteger8Bit) {
+        dataType = DTYPE_BU;
+    }
+    else if (type == SignedInteger8Bit) {
+        dataType = DTYPE_B;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        dataType = DTYPE_WU;
+    }
+    else if (type == SignedInteger16Bit) {
+        dataType = DTYPE_W;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        dataType = DTYPE_LU;
+    }
+    else if (type == SignedInteger32Bit) {
+        dataType = DTYPE_L;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        dataType = DTYPE_QU;
+    }
+    else if (type == SignedInteger64Bit) {
+        dataType = DTYPE_Q;
+    }
+    else if (type == Float32Bit) {
+        dataType = DTYPE_FLOAT;
+    }
+    else if (type == Float64Bit) {
+        dataType = DTYPE_DOUBLE;
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+MDSSegmentWriter::MDSSegmentWriter() :
+        MARTe::DataSourceI(), MARTe::EmbeddedServiceMethodBinderI(), MARTe::MessageI(), executor(*this) {
+    using namespace MARTe;
+    pulseNumber = 0;
+    treeContext = NULL_PTR(void *);
+    numberOfSegmentBuffers = 4u;
+    signals = NULL_PTR(MDSSegmentWriterSignal *);
+    signalOffsets = NULL_PTR(uint32 *);
+    sampleSize = 0u;
+    sample = NULL_PTR(char8 *);
+    rowAddresses = NULL_PTR(char8 **);
+    skipping = false;
+    paused = 0u;
+    writing = 0u;
+    skippedWrites = 0u;
+    timeSignalIdx = 0u;
+    timeSignalMultiplier = 1e-6;
+    writes = 0u;
+    discardedSegments = 0u;
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    (void) segmentFull.Create();
+    (void) mux.Create(false);
+
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
+}
+
+MDSSegmentWriter::~MDSSegmentWriter() {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    CloseTree();
+    if (signals != NULL_PTR(MDSSegmentWriterSignal *)) {
+        uint32 i;
+        for (i = 0u; i < GetNumberOfSignals(); i++) {
+            if (signals[i].segments != NULL_PTR(char8 *)) {
+                delete[] signals[i].segments;
+            }
+            if (signals[i].segmentStartTimes != NULL_PTR(float64 *)) {
+                delete[] signals[i].segmentStartTimes;
+            }
+        }
+        delete[] signals;
+    }
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+    if (sample != NULL_PTR(char8 *)) {
+        delete[] sample;
+    }
+    if (rowAddresses != NULL_PTR(char8 **)) {
+        delete[] rowAddresses;
+    }
+    (void) segmentFull.Close();
+    (void) mux.Close();
+}
+
+void MDSSegmentWriter::Purge(MARTe::ReferenceContainer &purgeList) {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    (void) RemoveMessageFilter(filter);
+    DataSourceI::Purge(purgeList);
+}
+
+bool MDSSegmentWriter::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::Initialise(data);
+    if (ok) {
+        ok = data.Read("TreeName", treeName);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "TreeName shall be specified");
+        }
+    }
+    if (ok) {
+        (void) data.Read("NumberOfSegmentBuffers", numberOfSegmentBuffers);
+        ok = (numberOfSegmentBuffers > 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfSegmentBuffers shall be > 1");
+        }
+    }
+    if (ok) {
+        (void) data.Read("CPUMask", cpuMask);
+        (void) data.Read("StackSize", stackSize);
+    }
+    return ok;
+}
+
+bool MDSSegmentWriter::SetConfiguredDatabase(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 numberOfSignals = GetNumberOfSignals();
+    uint32 producers = 0u;
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfFunctions()) && (ok); i++) {
+        uint32 nOfInputs = 0u;
+        uint32 nOfOutputs = 0u;
+        ok = GetFunctionNumberOfSignals(InputSignals, i, nOfInputs);
+        if (ok) {
+            ok = GetFunctionNumberOfSignals(OutputSignals, i, nOfOutputs);
+        }
+        if ((ok) && (nOfInputs > 0u)) {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "The signals of a MDSSegmentWriter cannot be read");
+        }
+        if ((ok) && (nOfOutputs > 0u)) {
+            //The broker writes the rows in place, so a row shall be written in full
+            producers++;
+            ok = (nOfOutputs == numberOfSignals);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The GAM shall write all the %d signals", numberOfSignals);
+            }
+        }
+        uint32 j;
+        for (j = 0u; (j < nOfOutputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(OutputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be written with Samples = 1");
+            }
+        }
+    }
+    if (ok) {
+        ok = (producers == 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Exactly one GAM shall write to a MDSSegmentWriter (found %d)", producers);
+        }
+    }
+    if (ok) {
+        signals = new MDSSegmentWriterSignal[numberOfSignals];
+        signalOffsets = new uint32[numberOfSignals];
+        timeSignalIdx = numberOfSignals;
+        ok = data.MoveRelative("Signals");
+    }
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        MDSSegmentWriterSignal &signal = signals[i];
+        signal.nid = 0;
+        signal.dataType = 0u;
+        signal.segmentRows = 0u;
+        signal.period = 0.0;
+        signal.segments = NULL_PTR(char8 *);
+        signal.segmentStartTimes = NULL_PTR(float64 *);
+        signal.row = 0u;
+        signal.discarding = false;
+        signal.filled = 0u;
+        signal.stored = 0u;
+        StreamString signalName;
+        ok = GetSignalName(i, signalName);
+        if (ok) {
+            ok = data.MoveRelative(data.GetChildName(i));
+        }
+        uint32 byteSize = 0u;
+        if (ok) {
+            ok = GetSignalByteSize(i, byteSize);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(i, signal.numberOfElements);
+        }
+        if (ok) {
+            signal.rowSize = byteSize;
+            signal.elementSize = byteSize / signal.numberOfElements;
+            signalOffsets[i] = sampleSize;
+            //Keep the signals 64 bits aligned
+            sampleSize += (byteSize + 7u) & ~7u;
+            uint32 isTimeSignal = 0u;
+            (void) data.Read("TimeSignal", isTimeSignal);
+            if (isTimeSignal != 0u) {
+                TypeDescriptor type = GetSignalType(i);
+                ok = (timeSignalIdx == numberOfSignals);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Only one TimeSignal can be specified");
+                }
+                if (ok) {
+                    ok = ((signal.numberOfElements == 1u)
+                            && ((type == UnsignedInteger32Bit) || (type == SignedInteger32Bit) || (type == UnsignedInteger64Bit)
+                                    || (type == SignedInteger64Bit)));
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The TimeSignal %s shall be a scalar uint32, int32, uint64 or int64",
+                                     signalName.Buffer());
+                    }
+                }
+                if (ok) {
+                    timeSignalIdx = i;
+                    timeSignalType = type;
+                    (void) data.Read("TimeSignalMultiplier", timeSignalMultiplier);
+                }
+            }
+        }
+        if ((ok) && (data.Read("NodeName", signal.nodeName))) {
+            ok = GetMDSplusType(GetSignalType(i), signal.dataType);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The type of %s cannot be stored", signalName.Buffer());
+            }
+            if (ok) {
+                ok = data.Read("Period", signal.period);
+                if (ok) {
+                    ok = (signal.period > 0.0);
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "A Period > 0 shall be specified for %s", signalName.Buffer());
+                }
+            }
+            if (ok) {
+                ok = data.Read("MakeSegmentAfterNWrites", signal.segmentRows);
+                if (ok) {
+                    ok = (signal.segmentRows > 0u);
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "MakeSegmentAfterNWrites > 0 shall be specified for %s", signalName.Buffer());
+                }
+            }
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    if (ok) {
+        ok = data.MoveToAncestor(1u);
+    }
+    return ok;
+}
+
+bool MDSSegmentWriter::AllocateMemory() {
+    using namespace MARTe;
+    sample = new char8[sampleSize];
+    rowAddresses = new char8 *[GetNumberOfSignals()];
+    bool ok = MemoryOperationsHelper::Set(sample, '\0', sampleSize);
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfSignals()) && (ok); i++) {
+        MDSSegmentWriterSignal &signal = signals[i];
+        rowAddresses[i] = &sample[signalOffsets[i]];
+        if (signal.segmentRows > 0u) {
+            uint32 segmentsSize = numberOfSegmentBuffers * signal.segmentRows * signal.rowSize;
+            signal.segments = new char8[segmentsSize];
+            signal.segmentStartTimes = new float64[numberOfSegmentBuffers];
+            //Touch the buffers now rather than in the real-time thread
+            ok = MemoryOperationsHelper::Set(signal.segments, '\0', segmentsSize);
+        }
+    }
+    if (ok) {
+        executor.SetName(GetName());
+        executor.SetCPUMask(cpuMask);
+        executor.SetStackSize(stackSize);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start SingleThreadService");
+        }
+    }
+    return ok;
+}
+
+MARTe::uint32 MDSSegmentWriter::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool MDSSegmentWriter::GetSignalMemoryBuffer(const MARTe::uint32 signalIdx, const MARTe::uint32 bufferIdx, void *&signalAddress) {
+    using namespace MARTe;
+    bool ok = (sample != NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((signalIdx < GetNumberOfSignals()) && (bufferIdx == 0u));
+    }
+    if (ok) {
+        signalAddress = &sample[signalOffsets[signalIdx]];
+    }
+    return ok;
+}
+
+const MARTe::char8 *MDSSegmentWriter::GetBrokerName(MARTe::StructuredDataI &data, const MARTe::SignalDirection direction) {
+    using namespace MARTe;
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == OutputSignals) {
+        brokerName = "MDSSegmentWriterOutputBroker";
+    }
+    return brokerName;
+}
+
+bool MDSSegmentWriter::GetInputBrokers(MARTe::ReferenceContainer &inputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    return false;
+}
+
+bool MDSSegmentWriter::GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<MDSSegmentWriterOutputBroker> broker(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = broker.IsValid();
+    if (ok) {
+        ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+    }
+    if (ok) {
+        ok = outputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool MDSSegmentWriter::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    uint32 discarded = __atomic_exchange_n(&discardedSegments, 0u, __ATOMIC_RELAXED);
+    if (discarded > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d segments could not be stored in time and were discarded", discarded);
+    }
+    uint32 skipped = __atomic_exchange_n(&skippedWrites, 0u, __ATOMIC_RELAXED);
+    if (skipped > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d rows were skipped while OpenTree or FlushSegments was running", skipped);
+    }
+    return true;
+}
+
+void MDSSegmentWriter::BeginWrite() {
+    using namespace MARTe;
+    //Pairs with PauseWrites: either this thread sees paused or PauseWrites sees writing
+    __atomic_store_n(&writing, 1u, __ATOMIC_SEQ_CST);
+    skipping = (__atomic_load_n(&paused, __ATOMIC_SEQ_CST) != 0u);
+    uint32 i;
+    for (i = 0u; i < GetNumberOfSignals(); i++) {
+        MDSSegmentWriterSignal &signal = signals[i];
+        char8 *row = &sample[signalOffsets[i]];
+        if ((!skipping) && (signal.segments != NULL_PTR(char8 *))) {
+            if (signal.row == 0u) {
+                //A new segment: discard it if the writer still owns all the buffers
+                uint32 stored = __atomic_load_n(&signal.stored, __ATOMIC_ACQUIRE);
+                signal.discarding = ((signal.filled - stored) >= numberOfSegmentBuffers);
+                if (signal.discarding) {
+                    (void) __atomic_add_fetch(&discardedSegments, 1u, __ATOMIC_RELAXED);
+                }
+            }
+            if (!signal.discarding) {
+                uint32 bufferIdx = signal.filled % numberOfSegmentBuffers;
+                row = &signal.segments[((bufferIdx * signal.segmentRows) + signal.row) * signal.rowSize];
+            }
+        }
+        rowAddresses[i] = row;
+    }
+}
+
+MARTe::char8 *MDSSegmentWriter::GetRowAddress(const MARTe::uint32 signalIdx) const {
+    return rowAddresses[signalIdx];
+}
+
+bool MDSSegmentWriter::GetSignalOfAddress(const void * const address, MARTe::uint32 &signalIdx, MARTe::uint32 &offset) const {
+    using namespace MARTe;
+    const char8 *byteAddress = static_cast<const char8 *>(address);
+    bool found = false;
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfSignals()) && (!found); i++) {
+        const char8 *signalAddress = &sample[signalOffsets[i]];
+        found = ((byteAddress >= signalAddress) && (byteAddress < &signalAddress[signals[i].rowSize]));
+        if (found) {
+            signalIdx = i;
+            offset = static_cast<uint32>(byteAddress - signalAddress);
+        }
+    }
+    return found;
+}
+
+bool MDSSegmentWriter::Synchronise() {
+    using namespace MARTe;
+    if (skipping) {
+        (void) __atomic_add_fetch(&skippedWrites, 1u, __ATOMIC_RELAXED);
+        //A skipped row still takes a period, so that the next segments keep their time
+        (void) __atomic_add_fetch(&writes, 1u, __ATOMIC_RELAXED);
+    }
+    else {
+        float64 time = 0.0;
+        bool useTimeSignal = (timeSignalIdx < GetNumberOfSignals());
+        if (useTimeSignal) {
+            const char8 *value = rowAddresses[timeSignalIdx];
+            if (timeSignalType == UnsignedInteger32Bit) {
+                time = static_cast<float64>(*reinterpret_cast<const uint32 *>(value));
+            }
+            else if (timeSignalType == SignedInteger32Bit) {
+                time = static_cast<float64>(*reinterpret_cast<const int32 *>(value));
+            }
+            else if (timeSignalType == UnsignedInteger64Bit) {
+                time = static_cast<float64>(*reinterpret_cast<const uint64 *>(value));
+            }
+            else {
+                time = static_cast<float64>(*reinterpret_cast<const int64 *>(value));
+            }
+            time *= timeSignalMultiplier;
+        }
+        bool post = false;
+        uint32 i;
+        for (i = 0u; i < GetNumberOfSignals(); i++) {
+            MDSSegmentWriterSignal &signal = signals[i];
+            if (signal.segments != NULL_PTR(char8 *)) {
+                if ((signal.row == 0u) && (!signal.discarding)) {
+                    signal.segmentStartTimes[signal.filled % numberOfSegmentBuffers] =
+                            (useTimeSignal) ? (time) : (static_cast<float64>(writes) * signal.period);
+                }
+                signal.row++;
+                if (signal.row == signal.segmentRows) {
+                    signal.row = 0u;
+                    if (!signal.discarding) {
+                        __atomic_store_n(&signal.filled, signal.filled + 1u, __ATOMIC_RELEASE);
+                        post = true;
+                    }
+                }
+            }
+        }
+        writes++;
+        if (post) {
+            (void) segmentFull.Post();
+        }
+    }
+    __atomic_store_n(&writing, 0u, __ATOMIC_SEQ_CST);
+    return true;
+}
+
+MARTe::ErrorManagement::ErrorType MDSSegmentWriter::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        (void) segmentFull.Wait(TimeoutType(MDS_SEGMENT_WRITER_TIMEOUT));
+        //Reset before looking at the segments, so that no Post is lost
+        (void) segmentFull.Reset();
+        if (mux.Lock() == ErrorManagement::NoError) {
+            (void) StoreFullSegments();
+            (void) mux.UnLock();
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+MARTe::ErrorManagement::ErrorType MDSSegmentWriter::OpenTree(const MARTe::int32 pulseNumber) {
+    using namespace MARTe;
+    PauseWrites();
+    ErrorManagement::ErrorType err = mux.Lock();
+    if (err.ErrorsCleared()) {
+        (void) StoreFullSegments();
+        CloseTree();
+        int32 pulse = pulseNumber;
+        if (pulse == -1) {
+            pulse = TreeGetCurrentShotId(treeName.Buffer()) + 1;
+        }
+        //Create the pulse from the model
+        int32 status = _TreeOpen(&treeContext, treeName.Buffer(), -1, 1);
+        if (IsSuccess(status)) {
+            status = _TreeCreatePulseFile(treeContext, pulse, 0, NULL_PTR(int *));
+            (void) _TreeClose(&treeContext, treeName.Buffer(), -1);
+        }
+        if ((IsSuccess(status)) && (pulseNumber == -1)) {
+            status = TreeSetCurrentShotId(treeName.Buffer(), pulse);
+        }
+        if (IsSuccess(status)) {
+            status = _TreeOpen(&treeContext, treeName.Buffer(), pulse, 0);
+        }
+        err.fatalError = !IsSuccess(status);
+        if (err.ErrorsCleared()) {
+            this->pulseNumber = pulse;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not create and open the pulse %d of %s: %s", pulse, treeName.Buffer(), MdsGetMsg(status));
+            if (treeContext != NULL_PTR(void *)) {
+                TreeFreeDbid(treeContext);
+                treeContext = NULL_PTR(void *);
+            }
+        }
+        uint32 i;
+        for (i = 0u; i < GetNumberOfSignals(); i++) {
+            MDSSegmentWriterSignal &signal = signals[i];
+            signal.row = 0u;
+            signal.discarding = false;
+            signal.filled = 0u;
+            signal.stored = 0u;
+            if ((err.ErrorsCleared()) && (signal.segments != NULL_PTR(char8 *))) {
+                status = _TreeFindNode(treeContext, signal.nodeName.Buffer(), &signal.nid);
+                err.parametersError = !IsSuccess(status);
+                if (!err.ErrorsCleared()) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Could not find the node %s: %s", signal.nodeName.Buffer(), MdsGetMsg(status));
+                }
+            }
+        }
+        if (!err.ErrorsCleared()) {
+            CloseTree();
+        }
+        //The real-time thread may be skipping (and counting) rows meanwhile
+        __atomic_store_n(&writes, 0u, __ATOMIC_RELAXED);
+        (void) mux.UnLock();
+    }
+    ResumeWrites();
+    if (err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::Information, "Opened the pulse %d of %s", this->pulseNumber, treeName.Buffer());
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType MDSSegmentWriter::FlushSegments() {
+    using namespace MARTe;
+    PauseWrites();
+    ErrorManagement::ErrorType err = mux.Lock();
+    if (err.ErrorsCleared()) {
+        err.fatalError = !StoreFullSegments();
+        uint32 i;
+        for (i = 0u; i < GetNumberOfSignals(); i++) {
+            MDSSegmentWriterSignal &signal = signals[i];
+            if ((signal.row > 0u) && (!signal.discarding)) {
+                if (treeContext != NULL_PTR(void *)) {
+                    if (!StoreSegment(signal, signal.filled % numberOfSegmentBuffers, signal.row)) {
+                        err.fatalError = true;
+                    }
+                }
+                signal.filled++;
+                signal.stored = signal.filled;
+            }
+            signal.row = 0u;
+            signal.discarding = false;
+        }
+        err.illegalOperation = (treeContext == NULL_PTR(void *));
+        (void) mux.UnLock();
+    }
+    ResumeWrites();
+    if (err.illegalOperation) {
+        REPORT_ERROR(ErrorManagement::IllegalOperation, "The tree %s is not open", treeName.Buffer());
+    }
+    return err;
+}
+
+bool MDSSegmentWriter::StoreSegment(const MDSSegmentWriterSignal &signal, const MARTe::uint32 bufferIdx, const MARTe::uint32 rows) {
+    using namespace MARTe;
+    float64 start = signal.segmentStartTimes[bufferIdx];
+    float64 end = start + (static_cast<float64>(rows - 1u) * signal.period);
+    float64 delta = signal.period;
+    struct descriptor startDescriptor = { sizeof(float64), DTYPE_DOUBLE, CLASS_S, reinterpret_cast<char *>(&start) };
+    struct descriptor endDescriptor = { sizeof(float64), DTYPE_DOUBLE, CLASS_S, reinterpret_cast<char *>(&end) };
+    struct descriptor deltaDescriptor = { sizeof(float64), DTYPE_DOUBLE, CLASS_S, reinterpret_cast<char *>(&delta) };
+    //The timebase is the range start : end : delta, evaluated by MDSplus when read
+    DESCRIPTOR_RANGE(dimension, &startDescriptor, &endDescriptor, &deltaDescriptor);
+    //The data descriptors point at the segment buffer, which is not copied
+    char8 *data = &signal.segments[bufferIdx * signal.segmentRows * signal.rowSize];
+    uint32 arraySize = rows * signal.rowSize;
+    int32 status;
+    if (signal.numberOfElements == 1u) {
+        DESCRIPTOR_A(array, signal.elementSize, signal.dataType, data, arraySize);
+        status = _TreeMakeSegment(treeContext, signal.nid, &startDescriptor, &endDescriptor, reinterpret_cast<struct descriptor *>(&dimension),
+                                  reinterpret_cast<struct descriptor_a *>(&array), -1, static_cast<int32>(rows));
+    }
+    else {
+        DESCRIPTOR_A_COEFF(array, signal.elementSize, signal.dataType, data, 2, arraySize);
+        array.m[0] = signal.numberOfElements;
+        array.m[1] = rows;
+        status = _TreeMakeSegment(treeContext, signal.nid, &startDescriptor, &endDescriptor, reinterpret_cast<struct descriptor *>(&dimension),
+                                  reinterpret_cast<struct descriptor_a *>(&array), -1, static_cast<int32>(rows));
+    }
+    bool ok = IsSuccess(status);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not store a segment of %s: %s", signal.nodeName.Buffer(), MdsGetMsg(status));
+    }
+    return ok;
+}
+
+bool MDSSegmentWriter::StoreFullSegments() {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; i < GetNumberOfSignals(); i++) {
+        MDSSegmentWriterSignal &signal = signals[i];
+        uint32 filled = __atomic_load_n(&signal.filled, __ATOMIC_ACQUIRE);
+        while (signal.stored != filled) {
+            if (treeContext != NULL_PTR(void *)) {
+                if (!StoreSegment(signal, signal.stored % numberOfSegmentBuffers, signal.segmentRows)) {
+                    ok = false;
+                }
+            }
+            __atomic_store_n(&signal.stored, signal.stored + 1u, __ATOMIC_RELEASE);
+        }
+    }
+    return ok;
+}
+
+void MDSSegmentWriter::CloseTree() {
+    using namespace MARTe;
+    if (treeContext != NULL_PTR(void *)) {
+        (void) _TreeClose(&treeContext, treeName.Buffer(), pulseNumber);
+        TreeFreeDbid(treeContext);
+        treeContext = NULL_PTR(void *);
+    }
+}
+
+void MDSSegmentWriter::PauseWrites() {
+    using namespace MARTe;
+    __atomic_store_n(&paused, 1u, __ATOMIC_SEQ_CST);
+    //A cycle of the real-time thread is short, so polling is enough
+    while (__atomic_load_n(&writing, __ATOMIC_SEQ_CST) != 0u) {
+        Sleep::MSec(1u);
+    }
+}
+
+void MDSSegmentWriter::ResumeWrites() {
+    __atomic_store_n(&paused, 0u, __ATOMIC_SEQ_CST);
+}
+
+CLASS_REGISTER(MDSSegmentWriter, "")
+CLASS_METHOD_REGISTER(MDSSegmentWriter, OpenTree)
+CLASS_METHOD_REGISTER(MDSSegmentWriter, FlushSegments)
+} // namespace MARTe2Tutorial
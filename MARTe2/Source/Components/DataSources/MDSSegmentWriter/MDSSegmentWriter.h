@@ -0,0 +1,514 @@
+/**
+ * @file MDSSegmentWriter.h
+ * @brief Header file for class MDSSegmentWriter
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * MDSSegmentWriter with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef DATASOURCES_MDSSEGMENTWRITER_MDSSEGMENTWRITER_H_
+#define DATASOURCES_MDSSEGMENTWRITER_MDSSEGMENTWRITER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "MessageI.h"
+#include "MutexSem.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief The segments of a signal stored by the MDSSegmentWriter.
+ * @details The segment buffers are a ring of numberOfSegmentBuffers
+ * segments of segmentRows rows each. The real-time thread owns row,
+ * discarding and filled, the writer thread owns stored.
+ */
+struct MDSSegmentWriterSignal {
+    /**
+     * Path of the node in the tree.
+     */
+    MARTe::StreamString nodeName;
+
+    /**
+     * Node identifier in the open tree.
+     */
+    MARTe::int32 nid;
+
+    /**
+     * MDSplus data type of the elements.
+     */
+    MARTe::uint8 dataType;
+
+    /**
+     * Size in bytes of an element.
+     */
+    MARTe::uint32 elementSize;
+
+    /**
+     * Number of elements of a row.
+     */
+    MARTe::uint32 numberOfElements;
+
+    /**
+     * Size in bytes of a row (i.e. of a write).
+     */
+    MARTe::uint32 rowSize;
+
+    /**
+     * Rows of a segment (MakeSegmentAfterNWrites).
+     */
+    MARTe::uint32 segmentRows;
+
+    /**
+     * Time between two rows in seconds.
+     */
+    MARTe::float64 period;
+
+    /**
+     * The segment buffers.
+     */
+    MARTe::char8 *segments;
+
+    /**
+     * Time of the first row of each segment buffer.
+     */
+    MARTe::float64 *segmentStartTimes;
+
+    /**
+     * Next row to be written in the current segment.
+     */
+    MARTe::uint32 row;
+
+    /**
+     * True if the rows of the current segment are discarded.
+     */
+    bool discarding;
+
+    /**
+     * Number of segments filled by the real-time thread.
+     */
+    volatile MARTe::uint32 filled;
+
+    /**
+     * Number of segments stored (or discarded) by the writer thread.
+     */
+    volatile MARTe::uint32 stored;
+};
+
+/**
+ * @brief Stores the signals in an MDSplus tree as segments which are
+ * written, in place, in preallocated buffers.
+ *
+ * @details Each stored signal has a ring of NumberOfSegmentBuffers segment
+ * buffers of MakeSegmentAfterNWrites rows. The MDSSegmentWriterOutputBroker
+ * copies the signals of the GAM directly into the current row of the
+ * segment of each signal, so that the samples are copied once, from the GAM
+ * to the segment buffer. When a segment is full it is handed to the writer
+ * thread, which stores it
+ * with TreeMakeSegment using the segment buffer itself as the data
+ * descriptor, i.e. without converting or copying the samples into MDSplus
+ * arrays, and the buffer is then recycled.
+ *
+ * The timebase of a segment is not stored as an array: its dimension is the
+ * range start : end : Period, where start is the time of the first row and
+ * end = start + (rows - 1) * Period. The time of a row is either the value
+ * of the TimeSignal multiplied by TimeSignalMultiplier or, if there is no
+ * TimeSignal, the number of writes since OpenTree multiplied by the Period
+ * of the signal.
+ *
+ * The real-time thread never waits on the writer: if all the segment
+ * buffers of a signal are still to be stored when a new segment starts, the
+ * rows of that segment are written to a scratch row and the segment is
+ * discarded and counted; the discarded segments are reported at every state
+ * change.
+ *
+ * Compared with the MDSWriter of the MARTe2-components (NumberOfBuffers
+ * copies of the signals in the broker, then a copy into MDSplus arrays and a
+ * timebase array per segment), the memory is NumberOfSegmentBuffers
+ * segments per signal and the writer does no per-sample work.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +MDSWriter = {
+ *     Class = MDSSegmentWriter
+ *     TreeName = "wrrd" //Compulsory. The tree shall exist (see Trees/create_tree_from_cfg.py).
+ *     NumberOfSegmentBuffers = 4 //Optional. Segment buffers per signal. Default = 4.
+ *     CPUMask = 0x1 //Optional. CPU mask of the writer thread. Default = 0xff.
+ *     StackSize = 1048576 //Optional. Stack size of the writer thread. Default = THREADS_DEFAULT_STACKSIZE.
+ *     Signals = {
+ *         Time = {
+ *             Type = uint32
+ *             TimeSignal = 1 //Optional. Only one signal, of integer type. Default = 0.
+ *             TimeSignalMultiplier = 1e-6 //Optional. Seconds per unit of the TimeSignal. Default = 1e-6.
+ *         }
+ *         Sin = {
+ *             Type = float32
+ *             NodeName = "SIN" //Optional. The signals without NodeName are not stored.
+ *             Period = 1e-3 //Compulsory if NodeName is set. Time between two writes in seconds.
+ *             MakeSegmentAfterNWrites = 1000 //Compulsory if NodeName is set. Rows of a segment.
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * The tree is opened by the OpenTree message, which creates the pulse from
+ * the model (-1 = the current pulse + 1), and the last, partially filled,
+ * segments are stored by the FlushSegments message. They are meant to be
+ * sent in a state where no GAM writes to this DataSource, as done by the
+ * StateMachine of RTApp-Wr.cfg. If they are sent while the signals are
+ * written, the real-time thread does not wait: the rows written while the
+ * message is processed are skipped and counted, and reported at the next
+ * state change. The skipped rows still advance the time of the samples
+ * (when there is no TimeSignal), so that the rows written after them keep
+ * their time.
+ *
+ * All the signals shall be written, with Samples = 1, by one GAM.
+ */
+class MDSSegmentWriter : public MARTe::DataSourceI, public MARTe::EmbeddedServiceMethodBinderI, public MARTe::MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the message filter.
+     */
+    MDSSegmentWriter();
+
+    /**
+     * @brief Destructor. Stops the writer thread, closes the tree and frees
+     * the memory.
+     */
+    virtual ~MDSSegmentWriter();
+
+    /**
+     * @brief Stops the writer thread and removes the message filter.
+     * @param[in] purgeList see ReferenceContainer::Purge.
+     */
+    virtual void Purge(MARTe::ReferenceContainer &purgeList);
+
+    /**
+     * @brief Reads the parameters listed in the class description.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if the compulsory parameters are set and the optional ones
+     * are valid.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies that all the signals are only written, with
+     * Samples = 1, by one GAM, and reads the parameters of each signal.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if the constraints above are met and the types of the
+     * stored signals are supported.
+     */
+    virtual bool SetConfiguredDatabase(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Allocates the segment buffers and starts the writer thread.
+     * @return true if the writer thread can be started.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief The broker manages the rows, so only one buffer is exposed.
+     * @return 1u.
+     */
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief Gets the address of the signal in the scratch row.
+     * @details The broker only uses it to find the signal of each copy (see
+     * GetSignalOfAddress).
+     * @param[in] signalIdx the signal index.
+     * @param[in] bufferIdx shall be 0u.
+     * @param[out] signalAddress the signal address.
+     * @return true if signalIdx and bufferIdx are valid.
+     */
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief Gets the broker name.
+     * @return MDSSegmentWriterOutputBroker for OutputSignals, NULL
+     * otherwise.
+     */
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction);
+
+    /**
+     * @brief Input signals are not supported.
+     * @return false.
+     */
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Creates an MDSSegmentWriterOutputBroker.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief Reports (and clears) the discarded segments and the skipped
+     * rows.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Selects the current row of each signal, i.e. the next row of
+     * its segment or, if the segment is discarded or OpenTree or
+     * FlushSegments is running, the scratch row. Called by the broker
+     * before the copy.
+     */
+    void BeginWrite();
+
+    /**
+     * @brief Gets the current row of a signal (see BeginWrite).
+     * @param[in] signalIdx the signal index.
+     * @return the address of the row.
+     */
+    MARTe::char8 *GetRowAddress(const MARTe::uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the signal of an address returned by GetSignalMemoryBuffer
+     * (plus an offset).
+     * @param[in] address the address.
+     * @param[out] signalIdx the signal index.
+     * @param[out] offset the offset in bytes of the address in the row of
+     * the signal.
+     * @return true if the address is in the row of a signal.
+     */
+    bool GetSignalOfAddress(const void * const address,
+                            MARTe::uint32 &signalIdx,
+                            MARTe::uint32 &offset) const;
+
+    /**
+     * @brief Advances the row of each stored signal and wakes the writer
+     * thread when a segment is full. Called by the broker after the copy.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Stores the full segments. Called by the writer thread.
+     * @param[in] info see EmbeddedServiceMethodBinderI::Execute.
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+    /**
+     * @brief Creates a pulse of the tree from the model, opens it and
+     * restarts the segments and the time of all the signals.
+     * @param[in] pulseNumber the pulse. -1 = the current pulse + 1.
+     * @return ErrorManagement::NoError if the pulse can be created and
+     * opened and all the nodes exist.
+     */
+    MARTe::ErrorManagement::ErrorType OpenTree(const MARTe::int32 pulseNumber);
+
+    /**
+     * @brief Stores the full segments and the partially filled ones.
+     * @return ErrorManagement::NoError if the tree is open and all the
+     * segments could be stored.
+     */
+    MARTe::ErrorManagement::ErrorType FlushSegments();
+
+private:
+    /**
+     * @brief Stores the segment buffer bufferIdx of a signal.
+     * @param[in] signal the signal.
+     * @param[in] bufferIdx the segment buffer.
+     * @param[in] rows the rows written in the segment.
+     * @return true if the segment is stored.
+     * @pre the tree is open and mux is locked.
+     */
+    bool StoreSegment(const MDSSegmentWriterSignal &signal,
+                      const MARTe::uint32 bufferIdx,
+                      const MARTe::uint32 rows);
+
+    /**
+     * @brief Stores (or discards, if the tree is not open) all the full
+     * segments.
+     * @return true if all the segments are stored.
+     * @pre mux is locked.
+     */
+    bool StoreFullSegments();
+
+    /**
+     * @brief Closes the tree, if open.
+     * @pre mux is locked.
+     */
+    void CloseTree();
+
+    /**
+     * @brief Makes the real-time thread skip its rows and waits until it is
+     * not between BeginWrite and Synchronise, so that the rows of the
+     * signals can be changed.
+     */
+    void PauseWrites();
+
+    /**
+     * @brief Lets the real-time thread write its rows again.
+     */
+    void ResumeWrites();
+
+    /**
+     * Name of the tree.
+     */
+    MARTe::StreamString treeName;
+
+    /**
+     * The open pulse.
+     */
+    MARTe::int32 pulseNumber;
+
+    /**
+     * The MDSplus tree context. NULL if the tree is not open.
+     */
+    void *treeContext;
+
+    /**
+     * Segment buffers per signal.
+     */
+    MARTe::uint32 numberOfSegmentBuffers;
+
+    /**
+     * The signals, in the order of the DataSource.
+     */
+    MDSSegmentWriterSignal *signals;
+
+    /**
+     * Offset of each signal inside the current row.
+     */
+    MARTe::uint32 *signalOffsets;
+
+    /**
+     * Size in bytes of the current row.
+     */
+    MARTe::uint32 sampleSize;
+
+    /**
+     * The scratch row, written by the broker when a row is not stored.
+     */
+    MARTe::char8 *sample;
+
+    /**
+     * The current row of each signal.
+     */
+    MARTe::char8 **rowAddresses;
+
+    /**
+     * True if the rows of the current cycle are skipped.
+     */
+    bool skipping;
+
+    /**
+     * Set by PauseWrites.
+     */
+    volatile MARTe::uint32 paused;
+
+    /**
+     * Set by the real-time thread from BeginWrite to Synchronise.
+     */
+    volatile MARTe::uint32 writing;
+
+    /**
+     * Rows skipped since the last state change.
+     */
+    MARTe::uint32 skippedWrites;
+
+    /**
+     * Index of the TimeSignal. Equal to the number of signals if there is no
+     * TimeSignal.
+     */
+    MARTe::uint32 timeSignalIdx;
+
+    /**
+     * Type of the TimeSignal.
+     */
+    MARTe::TypeDescriptor timeSignalType;
+
+    /**
+     * Seconds per unit of the TimeSignal.
+     */
+    MARTe::float64 timeSignalMultiplier;
+
+    /**
+     * Writes (including the skipped ones) since OpenTree.
+     */
+    MARTe::uint64 writes;
+
+    /**
+     * Segments discarded since the last state change.
+     */
+    MARTe::uint32 discardedSegments;
+
+    /**
+     * Posted by the real-time thread when a segment is full.
+     */
+    MARTe::EventSem segmentFull;
+
+    /**
+     * Serialises the accesses to the tree.
+     */
+    MARTe::MutexSem mux;
+
+    /**
+     * The writer thread.
+     */
+    MARTe::SingleThreadService executor;
+
+    /**
+     * The CPU mask of the writer thread.
+     */
+    MARTe::uint32 cpuMask;
+
+    /**
+     * The stack size of the writer thread.
+     */
+    MARTe::uint32 stackSize;
+
+    /**
+     * Filter for the OpenTree and FlushSegments messages.
+     */
+    MARTe::ReferenceT<MARTe::RegisteredMethodsMessageFilter> filter;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_MDSSEGMENTWRITER_MDSSEGMENTWRITER_H_ */
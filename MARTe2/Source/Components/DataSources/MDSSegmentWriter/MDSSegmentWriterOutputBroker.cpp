@@ -0,0 +1,99 @@
+/**
+ * @file MDSSegmentWriterOutputBroker.cpp
+ * @brief Source file for class MDSSegmentWriterOutputBroker
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MDSSegmentWriterOutputBroker (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MDSSegmentWriterOutputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+MDSSegmentWriterOutputBroker::MDSSegmentWriterOutputBroker() :
+        MARTe::MemoryMapBroker() {
+    writer = NULL_PTR(MDSSegmentWriter *);
+    copySignals = NULL_PTR(MARTe::uint32 *);
+    copyOffsets = NULL_PTR(MARTe::uint32 *);
+}
+
+MDSSegmentWriterOutputBroker::~MDSSegmentWriterOutputBroker() {
+    if (copySignals != NULL_PTR(MARTe::uint32 *)) {
+        delete[] copySignals;
+    }
+    if (copyOffsets != NULL_PTR(MARTe::uint32 *)) {
+        delete[] copyOffsets;
+    }
+}
+
+bool MDSSegmentWriterOutputBroker::Init(const MARTe::SignalDirection direction, MARTe::DataSourceI &dataSourceIn, const MARTe::char8 * const functionName,
+                                        void * const gamMemoryAddress) {
+    using namespace MARTe;
+    bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
+    if (ok) {
+        writer = dynamic_cast<MDSSegmentWriter *>(&dataSourceIn);
+        ok = (writer != NULL_PTR(MDSSegmentWriter *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The DataSource shall be an MDSSegmentWriter");
+        }
+    }
+    uint32 numberOfCopies = GetNumberOfCopies();
+    if (ok) {
+        copySignals = new uint32[numberOfCopies];
+        copyOffsets = new uint32[numberOfCopies];
+    }
+    uint32 n;
+    for (n = 0u; (n < numberOfCopies) && (ok); n++) {
+        ok = writer->GetSignalOfAddress(copyTable[n].dataSourcePointer, copySignals[n], copyOffsets[n]);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not find the signal of a copy");
+        }
+    }
+    return ok;
+}
+
+bool MDSSegmentWriterOutputBroker::Execute() {
+    using namespace MARTe;
+    writer->BeginWrite();
+    uint32 numberOfCopies = GetNumberOfCopies();
+    uint32 n;
+    for (n = 0u; n < numberOfCopies; n++) {
+        char8 *row = writer->GetRowAddress(copySignals[n]);
+        (void) MemoryOperationsHelper::Copy(&row[copyOffsets[n]], copyTable[n].gamPointer, copyTable[n].copySize);
+    }
+    return writer->Synchronise();
+}
+
+CLASS_REGISTER(MDSSegmentWriterOutputBroker, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,104 @@
+/**
+ * @file MDSSegmentWriterOutputBroker.h
+ * @brief Header file for class MDSSegmentWriterOutputBroker
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * MDSSegmentWriterOutputBroker with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be visible
+ * to the compiler.
+ */
+
+
+#ifndef DATASOURCES_MDSSEGMENTWRITER_MDSSEGMENTWRITEROUTPUTBROKER_H_
+#define DATASOURCES_MDSSEGMENTWRITER_MDSSEGMENTWRITEROUTPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MDSSegmentWriter.h"
+#include "MemoryMapBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Copies the signals of the GAM directly into the current row of the
+ * segment buffers of an MDSSegmentWriter and synchronises it.
+ */
+class MDSSegmentWriterOutputBroker : public MARTe::MemoryMapBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MDSSegmentWriterOutputBroker();
+
+    /**
+     * @brief Destructor. Frees the copy signals.
+     */
+    virtual ~MDSSegmentWriterOutputBroker();
+
+    using MARTe::MemoryMapBroker::Init;
+
+    /**
+     * @brief Builds the copy table (see MemoryMapBroker::Init) and finds the
+     * signal, and the offset in its row, of each copy.
+     * @param[in] dataSourceIn shall be an MDSSegmentWriter.
+     * @return true if MemoryMapBroker::Init succeeds and dataSourceIn is an
+     * MDSSegmentWriter.
+     */
+    virtual bool Init(const MARTe::SignalDirection direction,
+                      MARTe::DataSourceI &dataSourceIn,
+                      const MARTe::char8 * const functionName,
+                      void * const gamMemoryAddress);
+
+    /**
+     * @brief Copies the GAM memory into the current rows (see
+     * MDSSegmentWriter::BeginWrite) and calls MDSSegmentWriter::Synchronise.
+     * @return the result of Synchronise.
+     */
+    virtual bool Execute();
+
+private:
+    /**
+     * The writer.
+     */
+    MDSSegmentWriter *writer;
+
+    /**
+     * The signal of each copy.
+     */
+    MARTe::uint32 *copySignals;
+
+    /**
+     * The offset in bytes of each copy in the row of its signal.
+     */
+    MARTe::uint32 *copyOffsets;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_MDSSEGMENTWRITER_MDSSEGMENTWRITEROUTPUTBROKER_H_ */
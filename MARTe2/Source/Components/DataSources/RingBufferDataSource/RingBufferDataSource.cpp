@@ -0,0 +1,435 @@
+/**
+ * @file RingBufferDataSource.cpp
+ * @brief Source file for class RingBufferDataSource
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RingBufferDataSource (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "RingBufferDataSource.h"
+#include "RingBufferInputBroker.h"
+#include "RingBufferOutputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Cache line size of the supported targets (x86-64 and armv8).
+ */
+const MARTe::uint32 RING_BUFFER_CACHE_LINE_SIZE = 64u;
+
+/**
+ * The sequence number is stored at the beginning of each slot. 8 bytes are
+ * reserved to keep the signals 64 bits aligned.
+ */
+const MARTe::uint32 RING_BUFFER_SLOT_HEADER_SIZE = 8u;
+
+/**
+ * Maximum attempts to find a slot which was not overwritten (Overwrite).
+ */
+const MARTe::uint32 RING_BUFFER_MAX_SEQUENCE_ATTEMPTS = 8u;
+
+/**
+ * @brief Hints the CPU that the thread is spinning.
+ */
+inline void RingBufferCPURelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#endif
+}
+
+/**
+ * @brief Rounds value up to a multiple of alignment (power of 2).
+ */
+inline MARTe::uint32 RingBufferAlign(const MARTe::uint32 value, const MARTe::uint32 alignment) {
+    return (value + (alignment - 1u)) & ~(alignment - 1u);
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+RingBufferDataSource::RingBufferDataSource() :
+        MARTe::DataSourceI() {
+    using namespace MARTe;
+    depth = 8u;
+    blocking = false;
+    timeoutTicks = 0u;
+    rawMemory = NULL_PTR(void *);
+    slots = NULL_PTR(char8 *);
+    producerLine = NULL_PTR(volatile uint32 *);
+    consumerLine = NULL_PTR(volatile uint32 *);
+    slotSize = 0u;
+    signalOffsets = NULL_PTR(uint32 *);
+}
+
+RingBufferDataSource::~RingBufferDataSource() {
+    using namespace MARTe;
+    if (rawMemory != NULL_PTR(void *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(rawMemory);
+    }
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+}
+
+bool RingBufferDataSource::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::Initialise(data);
+    if (ok) {
+        (void) data.Read("Depth", depth);
+        ok = ((depth >= 2u) && ((depth & (depth - 1u)) == 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Depth shall be a power of 2 >= 2");
+        }
+    }
+    if (ok) {
+        StreamString policy = "Overwrite";
+        (void) data.Read("Policy", policy);
+        if (policy == "Block") {
+            blocking = true;
+        }
+        else if (policy == "Overwrite") {
+            blocking = false;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "Policy %s is not supported. Use Block or Overwrite", policy.Buffer());
+        }
+    }
+    if (ok) {
+        uint32 timeout = 1000000u;
+        (void) data.Read("Timeout", timeout);
+        timeoutTicks = static_cast<uint64>(static_cast<float64>(timeout) * static_cast<float64>(HighResolutionTimer::Frequency()) * 1e-6);
+    }
+    return ok;
+}
+
+bool RingBufferDataSource::SetConfiguredDatabase(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 numberOfSignals = GetNumberOfSignals();
+    uint32 producers = 0u;
+    uint32 consumers = 0u;
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfFunctions()) && (ok); i++) {
+        uint32 nOfInputs = 0u;
+        uint32 nOfOutputs = 0u;
+        ok = GetFunctionNumberOfSignals(InputSignals, i, nOfInputs);
+        if (ok) {
+            ok = GetFunctionNumberOfSignals(OutputSignals, i, nOfOutputs);
+        }
+        if ((ok) && (nOfOutputs > 0u)) {
+            producers++;
+            ok = (nOfOutputs == numberOfSignals);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The producer shall write all the %d signals", numberOfSignals);
+            }
+        }
+        if ((ok) && (nOfInputs > 0u)) {
+            consumers++;
+        }
+        uint32 j;
+        for (j = 0u; (j < nOfInputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(InputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be read with Samples = 1");
+            }
+        }
+        for (j = 0u; (j < nOfOutputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(OutputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be written with Samples = 1");
+            }
+        }
+    }
+    if (ok) {
+        ok = (producers == 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Exactly one GAM shall write to a RingBufferDataSource (found %d)", producers);
+        }
+    }
+    if (ok) {
+        ok = (consumers <= 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At most one GAM can read from a RingBufferDataSource (found %d)", consumers);
+        }
+    }
+    if ((ok) && (blocking)) {
+        //Otherwise the producer would wait for the Timeout in every cycle once the ring is full
+        ok = (consumers == 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Policy = Block requires one GAM reading from the RingBufferDataSource");
+        }
+    }
+    if (ok) {
+        signalOffsets = new uint32[numberOfSignals];
+        uint32 offset = RING_BUFFER_SLOT_HEADER_SIZE;
+        for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+            uint32 byteSize = 0u;
+            ok = GetSignalByteSize(i, byteSize);
+            signalOffsets[i] = offset;
+            offset += RingBufferAlign(byteSize, 8u);
+        }
+        slotSize = RingBufferAlign(offset, RING_BUFFER_CACHE_LINE_SIZE);
+    }
+    return ok;
+}
+
+bool RingBufferDataSource::AllocateMemory() {
+    using namespace MARTe;
+    //Producer line + consumer line + slots + room for the alignment
+    uint32 memorySize = (3u * RING_BUFFER_CACHE_LINE_SIZE) + (depth * slotSize);
+    rawMemory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize);
+    bool ok = (rawMemory != NULL_PTR(void *));
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(rawMemory, '\0', memorySize);
+    }
+    if (ok) {
+        uintp aligned = reinterpret_cast<uintp>(rawMemory);
+        aligned = (aligned + (RING_BUFFER_CACHE_LINE_SIZE - 1u)) & ~static_cast<uintp>(RING_BUFFER_CACHE_LINE_SIZE - 1u);
+        producerLine = reinterpret_cast<volatile uint32 *>(aligned);
+        consumerLine = reinterpret_cast<volatile uint32 *>(aligned + RING_BUFFER_CACHE_LINE_SIZE);
+        slots = reinterpret_cast<char8 *>(aligned + (2u * RING_BUFFER_CACHE_LINE_SIZE));
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate %d bytes", memorySize);
+    }
+    return ok;
+}
+
+MARTe::uint32 RingBufferDataSource::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool RingBufferDataSource::GetSignalMemoryBuffer(const MARTe::uint32 signalIdx, const MARTe::uint32 bufferIdx, void *&signalAddress) {
+    using namespace MARTe;
+    bool ok = (slots != NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((signalIdx < GetNumberOfSignals()) && (bufferIdx == 0u));
+    }
+    if (ok) {
+        signalAddress = &slots[signalOffsets[signalIdx]];
+    }
+    return ok;
+}
+
+const MARTe::char8 *RingBufferDataSource::GetBrokerName(MARTe::StructuredDataI &data, const MARTe::SignalDirection direction) {
+    using namespace MARTe;
+    const char8 *brokerName = "RingBufferInputBroker";
+    if (direction == OutputSignals) {
+        brokerName = "RingBufferOutputBroker";
+    }
+    return brokerName;
+}
+
+bool RingBufferDataSource::GetInputBrokers(MARTe::ReferenceContainer &inputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<RingBufferInputBroker> broker(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+    if (ok) {
+        ok = inputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool RingBufferDataSource::GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<RingBufferOutputBroker> broker(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+    if (ok) {
+        ok = outputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool RingBufferDataSource::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    if (producerLine[1] > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d samples were dropped because the ring was full", producerLine[1]);
+        producerLine[1] = 0u;
+    }
+    if (consumerLine[1] > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d samples were overwritten before being read", consumerLine[1]);
+        consumerLine[1] = 0u;
+    }
+    if (consumerLine[2] > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "The consumer timed out %d times waiting for a sample", consumerLine[2]);
+        consumerLine[2] = 0u;
+    }
+    return true;
+}
+
+bool RingBufferDataSource::Synchronise() {
+    return true;
+}
+
+MARTe::uint32 RingBufferDataSource::GetSlotSize() const {
+    return slotSize;
+}
+
+volatile MARTe::uint32 *RingBufferDataSource::GetSlotSequence(const MARTe::uint32 slot) const {
+    return reinterpret_cast<volatile MARTe::uint32 *>(&slots[slot * slotSize]);
+}
+
+bool RingBufferDataSource::BeginWrite(MARTe::uint32 &slot) {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 written = producerLine[0];
+    if (blocking) {
+        bool waiting = false;
+        uint64 start = 0u;
+        while (((written - __atomic_load_n(&consumerLine[0], __ATOMIC_ACQUIRE)) >= depth) && (ok)) {
+            uint64 now = HighResolutionTimer::Counter();
+            if (!waiting) {
+                waiting = true;
+                start = now;
+            }
+            else if ((now - start) > timeoutTicks) {
+                producerLine[1]++;
+                ok = false;
+            }
+            else {
+                RingBufferCPURelax();
+            }
+        }
+    }
+    slot = written & (depth - 1u);
+    if ((ok) && (!blocking)) {
+        //Odd sequence: the slot is being written
+        __atomic_store_n(GetSlotSequence(slot), (written * 2u) + 1u, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+    }
+    return ok;
+}
+
+void RingBufferDataSource::EndWrite() {
+    using namespace MARTe;
+    uint32 written = producerLine[0];
+    if (!blocking) {
+        __atomic_store_n(GetSlotSequence(written & (depth - 1u)), (written * 2u) + 2u, __ATOMIC_RELEASE);
+    }
+    __atomic_store_n(&producerLine[0], written + 1u, __ATOMIC_RELEASE);
+}
+
+bool RingBufferDataSource::BeginRead(MARTe::uint32 &slot, MARTe::uint32 &sequence) {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 read = consumerLine[0];
+    if (blocking) {
+        bool waiting = false;
+        uint64 start = 0u;
+        while ((__atomic_load_n(&producerLine[0], __ATOMIC_ACQUIRE) == read) && (ok)) {
+            uint64 now = HighResolutionTimer::Counter();
+            if (!waiting) {
+                waiting = true;
+                start = now;
+            }
+            else if ((now - start) > timeoutTicks) {
+                consumerLine[2]++;
+                ok = false;
+            }
+            else {
+                RingBufferCPURelax();
+            }
+        }
+        slot = read & (depth - 1u);
+        sequence = read;
+    }
+    else {
+        bool found = false;
+        uint32 lost = 0u;
+        uint32 attempt;
+        for (attempt = 0u; (attempt < RING_BUFFER_MAX_SEQUENCE_ATTEMPTS) && (!found) && (ok); attempt++) {
+            uint32 written = __atomic_load_n(&producerLine[0], __ATOMIC_ACQUIRE);
+            if (written == 0u) {
+                //Nothing was ever written
+                ok = false;
+            }
+            else {
+                if (written == read) {
+                    //No new sample, read again the latest one
+                    read = written - 1u;
+                }
+                else if ((written - read) > (depth - 1u)) {
+                    //The slot being written by the producer is the oldest, skip it as well
+                    lost += (written - read) - (depth - 1u);
+                    read = written - (depth - 1u);
+                }
+                else {
+                    //NOOP
+                }
+                slot = read & (depth - 1u);
+                sequence = __atomic_load_n(GetSlotSequence(slot), __ATOMIC_ACQUIRE);
+                found = (sequence == ((read * 2u) + 2u));
+                if (!found) {
+                    RingBufferCPURelax();
+                }
+            }
+        }
+        ok = found;
+        if (ok) {
+            consumerLine[1] += lost;
+            consumerLine[3] = read;
+        }
+    }
+    return ok;
+}
+
+bool RingBufferDataSource::EndRead(const MARTe::uint32 sequence) {
+    using namespace MARTe;
+    bool ok = true;
+    if (blocking) {
+        __atomic_store_n(&consumerLine[0], sequence + 1u, __ATOMIC_RELEASE);
+    }
+    else {
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        uint32 read = consumerLine[3];
+        ok = (__atomic_load_n(GetSlotSequence(read & (depth - 1u)), __ATOMIC_RELAXED) == sequence);
+        if (ok) {
+            consumerLine[0] = read + 1u;
+        }
+    }
+    return ok;
+}
+
+CLASS_REGISTER(RingBufferDataSource, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,281 @@
+/**
+ * @file RingBufferDataSource.h
+ * @brief Header file for class RingBufferDataSource
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * RingBufferDataSource with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be visible
+ * to the compiler.
+ */
+
+#ifndef DATASOURCES_RINGBUFFERDATASOURCE_RINGBUFFERDATASOURCE_H_
+#define DATASOURCES_RINGBUFFERDATASOURCE_RINGBUFFERDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief A lock-free single-producer/single-consumer ring buffer which allows
+ * to exchange signals between two RealTimeThreads.
+ *
+ * @details Exactly one GAM (the producer) shall write all the signals of this
+ * DataSource and at most one GAM (the consumer), executed by another
+ * RealTimeThread, can read them. Each sample of the signal set is stored in a
+ * slot; slots are aligned to the cache line and the producer and consumer
+ * indexes live on different cache lines, so that the two threads never share
+ * a cache line while they are not working on the same slot. The brokers copy
+ * the GAM signals directly from/into the slot, i.e. there are no copies
+ * besides the one into (producer) and out of (consumer) the slot.
+ *
+ * Two policies are supported:
+ *  - Block: no sample is lost. The producer waits (spinning) for a free slot
+ *    and the consumer waits for a new sample, for at most Timeout
+ *    microseconds each. On timeout the producer drops the sample and the
+ *    consumer keeps the previous value.
+ *  - Overwrite: the producer never waits and overwrites the oldest samples
+ *    which were not read yet. Each slot is protected by a sequence number
+ *    (seqlock) so that the consumer retries if the slot was overwritten while
+ *    it was reading it. If no new sample is available the consumer reads
+ *    again the latest one.
+ *
+ * The number of dropped (Block), lost (Overwrite) and missing (consumer
+ * timeout) samples are reported at every state change.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +RingBuffer = {
+ *     Class = RingBufferDataSource
+ *     Depth = 16 //Optional. Number of slots. Shall be a power of 2 >= 2. Default = 8.
+ *     Policy = Overwrite //Optional. Block or Overwrite. Default = Overwrite.
+ *     Timeout = 1000 //Optional. Maximum wait (us) with Policy = Block. Default = 1000000.
+ *     Signals = {
+ *         Counter = {
+ *             Type = uint32
+ *         }
+ *         Samples = {
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Each signal shall be read and written with Samples = 1.
+ */
+class RingBufferDataSource : public MARTe::DataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    RingBufferDataSource();
+
+    /**
+     * @brief Destructor. Frees the ring memory.
+     */
+    virtual ~RingBufferDataSource();
+
+    /**
+     * @brief Reads the Depth, Policy and Timeout parameters.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if the parameters are valid.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies that there is one producer and at most one consumer
+     * (exactly one with Policy = Block),
+     * that all the signals are written by the producer and that Samples = 1.
+     * Computes the layout of a slot.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if the constraints above are met.
+     */
+    virtual bool SetConfiguredDatabase(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Allocates the cache line aligned ring.
+     * @return true if the memory can be allocated.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief The brokers manage the slots, so only one buffer is exposed.
+     * @return 1u.
+     */
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief Gets the address of the signal in the first slot.
+     * @details The brokers compute the address in the other slots by adding a
+     * multiple of GetSlotSize.
+     * @param[in] signalIdx the signal index.
+     * @param[in] bufferIdx shall be 0u.
+     * @param[out] signalAddress the signal address in the first slot.
+     * @return true if signalIdx and bufferIdx are valid.
+     */
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief Gets the broker name.
+     * @return RingBufferInputBroker for InputSignals and RingBufferOutputBroker
+     * for OutputSignals.
+     */
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction);
+
+    /**
+     * @brief Creates a RingBufferInputBroker for the consumer.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Creates a RingBufferOutputBroker for the producer.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief Reports (and clears) the dropped, lost and missing samples.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Not used, the brokers synchronise through the ring indexes.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Gets the distance in bytes between two consecutive slots.
+     * @return the slot size.
+     */
+    MARTe::uint32 GetSlotSize() const;
+
+    /**
+     * @brief Reserves the next slot for the producer.
+     * @details With Policy = Block waits for a free slot for at most Timeout.
+     * With Policy = Overwrite marks the slot as being written.
+     * @param[out] slot the slot to be written.
+     * @return false if the sample shall be dropped (Block timeout).
+     */
+    bool BeginWrite(MARTe::uint32 &slot);
+
+    /**
+     * @brief Publishes the slot reserved by BeginWrite to the consumer.
+     */
+    void EndWrite();
+
+    /**
+     * @brief Reserves the next slot to be read by the consumer.
+     * @details With Policy = Block waits for a new sample for at most Timeout.
+     * With Policy = Overwrite skips the samples which were overwritten and
+     * returns the latest sample if no new sample is available.
+     * @param[out] slot the slot to be read.
+     * @param[out] sequence the sequence number to be passed to EndRead.
+     * @return false if there is nothing to be read.
+     */
+    bool BeginRead(MARTe::uint32 &slot, MARTe::uint32 &sequence);
+
+    /**
+     * @brief Releases the slot reserved by BeginRead.
+     * @param[in] sequence the sequence returned by BeginRead.
+     * @return false if the slot was overwritten while being read (Policy =
+     * Overwrite), in which case the read shall be repeated.
+     */
+    bool EndRead(const MARTe::uint32 sequence);
+
+private:
+    /**
+     * @brief Gets the address of the sequence number of a slot.
+     * @param[in] slot the slot index.
+     * @return the address of the sequence number.
+     */
+    volatile MARTe::uint32 *GetSlotSequence(const MARTe::uint32 slot) const;
+
+    /**
+     * Number of slots (power of 2).
+     */
+    MARTe::uint32 depth;
+
+    /**
+     * True if Policy = Block.
+     */
+    bool blocking;
+
+    /**
+     * Maximum wait in HighResolutionTimer ticks (Policy = Block).
+     */
+    MARTe::uint64 timeoutTicks;
+
+    /**
+     * The raw memory (not aligned).
+     */
+    void *rawMemory;
+
+    /**
+     * The first slot (cache line aligned).
+     */
+    MARTe::char8 *slots;
+
+    /**
+     * Producer cache line: [0] samples published, [1] samples dropped.
+     */
+    volatile MARTe::uint32 *producerLine;
+
+    /**
+     * Consumer cache line: [0] samples consumed, [1] samples lost, [2]
+     * consumer timeouts, [3] index of the sample being read.
+     */
+    volatile MARTe::uint32 *consumerLine;
+
+    /**
+     * Distance in bytes between two consecutive slots.
+     */
+    MARTe::uint32 slotSize;
+
+    /**
+     * Offset of each signal inside a slot.
+     */
+    MARTe::uint32 *signalOffsets;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_RINGBUFFERDATASOURCE_RINGBUFFERDATASOURCE_H_ */
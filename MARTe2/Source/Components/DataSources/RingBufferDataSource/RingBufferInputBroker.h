@@ -0,0 +1,100 @@
+/**
+ * @file RingBufferInputBroker.h
+ * @brief Header file for class RingBufferInputBroker
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * RingBufferInputBroker with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be visible
+ * to the compiler.
+ */
+
+#ifndef DATASOURCES_RINGBUFFERDATASOURCE_RINGBUFFERINPUTBROKER_H_
+#define DATASOURCES_RINGBUFFERDATASOURCE_RINGBUFFERINPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapBroker.h"
+#include "RingBufferDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Copies the signals of the next available slot of a RingBufferDataSource
+ * into the memory of the consumer GAM.
+ */
+class RingBufferInputBroker : public MARTe::MemoryMapBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    RingBufferInputBroker();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~RingBufferInputBroker();
+
+    using MARTe::MemoryMapBroker::Init;
+
+    /**
+     * @brief Builds the copy table (see MemoryMapBroker::Init) against the
+     * first slot of the ring.
+     * @param[in] dataSourceIn shall be a RingBufferDataSource.
+     * @return true if MemoryMapBroker::Init succeeds and dataSourceIn is a
+     * RingBufferDataSource.
+     */
+    virtual bool Init(const MARTe::SignalDirection direction,
+                      MARTe::DataSourceI &dataSourceIn,
+                      const MARTe::char8 * const functionName,
+                      void * const gamMemoryAddress);
+
+    /**
+     * @brief Copies the next slot into the GAM memory.
+     * @details If the slot was overwritten while being copied (Policy = Overwrite)
+     * the copy is repeated.
+     * @return false if the copy could not be completed without the slot being
+     * overwritten.
+     */
+    virtual bool Execute();
+
+private:
+    /**
+     * The ring.
+     */
+    RingBufferDataSource *ring;
+
+    /**
+     * Distance in bytes between two consecutive slots.
+     */
+    MARTe::uint32 slotSize;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_RINGBUFFERDATASOURCE_RINGBUFFERINPUTBROKER_H_ */
@@ -0,0 +1,87 @@
+/**
+ * @file RingBufferOutputBroker.cpp
+ * @brief Source file for class RingBufferOutputBroker
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RingBufferOutputBroker (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "RingBufferOutputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+RingBufferOutputBroker::RingBufferOutputBroker() :
+        MARTe::MemoryMapBroker() {
+    ring = NULL_PTR(RingBufferDataSource *);
+    slotSize = 0u;
+}
+
+RingBufferOutputBroker::~RingBufferOutputBroker() {
+}
+
+bool RingBufferOutputBroker::Init(const MARTe::SignalDirection direction, MARTe::DataSourceI &dataSourceIn, const MARTe::char8 * const functionName,
+                  void * const gamMemoryAddress) {
+    using namespace MARTe;
+    bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
+    if (ok) {
+        ring = dynamic_cast<RingBufferDataSource *>(&dataSourceIn);
+        ok = (ring != NULL_PTR(RingBufferDataSource *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The DataSource shall be a RingBufferDataSource");
+        }
+    }
+    if (ok) {
+        slotSize = ring->GetSlotSize();
+    }
+    return ok;
+}
+
+bool RingBufferOutputBroker::Execute() {
+    using namespace MARTe;
+    uint32 slot = 0u;
+    if (ring->BeginWrite(slot)) {
+        uint32 numberOfCopies = GetNumberOfCopies();
+        uint32 offset = slot * slotSize;
+        uint32 n;
+        for (n = 0u; n < numberOfCopies; n++) {
+            char8 *destination = static_cast<char8 *>(copyTable[n].dataSourcePointer);
+            (void) MemoryOperationsHelper::Copy(&destination[offset], copyTable[n].gamPointer, copyTable[n].copySize);
+        }
+        ring->EndWrite();
+    }
+    return true;
+}
+
+CLASS_REGISTER(RingBufferOutputBroker, "")
+} // namespace MARTe2Tutorial
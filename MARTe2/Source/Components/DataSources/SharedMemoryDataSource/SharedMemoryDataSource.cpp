@@ -0,0 +1,428 @@
+/**
+ * @file SharedMemoryDataSource.cpp
+ * @brief Source file for class SharedMemoryDataSource
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSource (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "SharedMemoryDataSource.h"
+#include "SharedMemoryInputBroker.h"
+#include "SharedMemoryOutputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Cache line size of the supported targets (x86-64 and armv8).
+ */
+const MARTe::uint32 SHARED_MEMORY_CACHE_LINE_SIZE = 64u;
+
+/**
+ * The sequence number is stored at the beginning of each buffer. 8 bytes are
+ * reserved to keep the signals 64 bits aligned.
+ */
+const MARTe::uint32 SHARED_MEMORY_BUFFER_HEADER_SIZE = 8u;
+
+/**
+ * Number of buffers in the segment.
+ */
+const MARTe::uint32 SHARED_MEMORY_NUMBER_OF_BUFFERS = 2u;
+
+/**
+ * @brief Hints the CPU that the thread is spinning.
+ */
+inline void SharedMemoryCPURelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#endif
+}
+
+/**
+ * @brief Rounds value up to a multiple of alignment (power of 2).
+ */
+inline MARTe::uint32 SharedMemoryAlign(const MARTe::uint32 value, const MARTe::uint32 alignment) {
+    return (value + (alignment - 1u)) & ~(alignment - 1u);
+}
+
+/**
+ * @brief Adds a string to a FNV-1a hash.
+ */
+MARTe::uint32 SharedMemoryHash(MARTe::uint32 hash, const MARTe::char8 *value) {
+    using namespace MARTe;
+    if (value != NULL_PTR(const char8 *)) {
+        while (*value != '\0') {
+            hash ^= static_cast<uint8>(*value);
+            hash *= 16777619u;
+            value++;
+        }
+    }
+    //Separator, so that {"ab", "c"} and {"a", "bc"} differ
+    hash ^= 0xFFu;
+    hash *= 16777619u;
+    return hash;
+}
+
+/**
+ * @brief Adds a word (little endian) to a FNV-1a hash.
+ */
+MARTe::uint32 SharedMemoryHash(MARTe::uint32 hash, MARTe::uint32 value) {
+    using namespace MARTe;
+    uint32 i;
+    for (i = 0u; i < 4u; i++) {
+        hash ^= (value & 0xFFu);
+        hash *= 16777619u;
+        value >>= 8u;
+    }
+    return hash;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+SharedMemoryDataSource::SharedMemoryDataSource() :
+        MARTe::DataSourceI() {
+    using namespace MARTe;
+    timeoutTicks = 0u;
+    fd = -1;
+    segment = NULL_PTR(void *);
+    segmentSize = 0u;
+    header = NULL_PTR(volatile uint32 *);
+    buffers = NULL_PTR(char8 *);
+    bufferSize = 0u;
+    signalOffsets = NULL_PTR(uint32 *);
+    timeouts = 0u;
+    failedReads = 0u;
+}
+
+SharedMemoryDataSource::~SharedMemoryDataSource() {
+    using namespace MARTe;
+    if (segment != NULL_PTR(void *)) {
+        (void) munmap(segment, segmentSize);
+    }
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+}
+
+bool SharedMemoryDataSource::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::Initialise(data);
+    if (ok) {
+        ok = data.Read("SharedMemoryName", sharedMemoryName);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SharedMemoryName shall be specified");
+        }
+    }
+    if (ok) {
+        //POSIX requires the name to start with a / for portable behaviour
+        if (sharedMemoryName.Buffer()[0] != '/') {
+            StreamString name = "/";
+            name += sharedMemoryName;
+            sharedMemoryName = name;
+        }
+        uint32 timeout = 0u;
+        (void) data.Read("Timeout", timeout);
+        timeoutTicks = static_cast<uint64>(static_cast<float64>(timeout) * static_cast<float64>(HighResolutionTimer::Frequency()) * 1e-6);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::SetConfiguredDatabase(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 numberOfSignals = GetNumberOfSignals();
+    uint32 writers = 0u;
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfFunctions()) && (ok); i++) {
+        uint32 nOfInputs = 0u;
+        uint32 nOfOutputs = 0u;
+        ok = GetFunctionNumberOfSignals(InputSignals, i, nOfInputs);
+        if (ok) {
+            ok = GetFunctionNumberOfSignals(OutputSignals, i, nOfOutputs);
+        }
+        if ((ok) && (nOfOutputs > 0u)) {
+            writers++;
+            ok = (nOfOutputs == numberOfSignals);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The writer shall write all the %d signals", numberOfSignals);
+            }
+        }
+        uint32 j;
+        for (j = 0u; (j < nOfInputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(InputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be read with Samples = 1");
+            }
+        }
+        for (j = 0u; (j < nOfOutputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(OutputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be written with Samples = 1");
+            }
+        }
+    }
+    if (ok) {
+        ok = (writers <= 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At most one GAM can write to a SharedMemoryDataSource (found %d)", writers);
+        }
+    }
+    if (ok) {
+        signalOffsets = new uint32[numberOfSignals];
+        uint32 offset = SHARED_MEMORY_BUFFER_HEADER_SIZE;
+        for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+            uint32 byteSize = 0u;
+            ok = GetSignalByteSize(i, byteSize);
+            signalOffsets[i] = offset;
+            offset += SharedMemoryAlign(byteSize, 8u);
+        }
+        bufferSize = SharedMemoryAlign(offset, SHARED_MEMORY_CACHE_LINE_SIZE);
+        //Header line + buffers
+        segmentSize = SHARED_MEMORY_CACHE_LINE_SIZE + (SHARED_MEMORY_NUMBER_OF_BUFFERS * bufferSize);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::AllocateMemory() {
+    using namespace MARTe;
+    fd = shm_open(sharedMemoryName.Buffer(), O_RDWR | O_CREAT, 0660);
+    bool ok = (fd >= 0);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::OSError, "Could not open the shared memory %s", sharedMemoryName.Buffer());
+    }
+    struct stat status;
+    if (ok) {
+        ok = (fstat(fd, &status) == 0);
+    }
+    if (ok) {
+        //If another application is creating the segment, both truncate to the same size
+        if (status.st_size == 0) {
+            ok = (ftruncate(fd, static_cast<off_t>(segmentSize)) == 0);
+        }
+        else {
+            ok = (status.st_size == static_cast<off_t>(segmentSize));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::OSError, "The shared memory %s exists with a size different from %d bytes", sharedMemoryName.Buffer(), segmentSize);
+        }
+    }
+    if (ok) {
+        segment = mmap(NULL_PTR(void *), segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ok = (segment != MAP_FAILED);
+        if (!ok) {
+            segment = NULL_PTR(void *);
+            REPORT_ERROR(ErrorManagement::OSError, "Could not map the shared memory %s", sharedMemoryName.Buffer());
+        }
+    }
+    if (ok) {
+        //mmap returns page aligned memory
+        header = static_cast<volatile uint32 *>(segment);
+        buffers = &(static_cast<char8 *>(segment)[SHARED_MEMORY_CACHE_LINE_SIZE]);
+        uint32 signature = ComputeSignature();
+        uint32 expected = 0u;
+        //The first application which attaches stores the layout signature
+        if (!__atomic_compare_exchange_n(&header[0], &expected, signature, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            ok = (expected == signature);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The signals of %s do not match the ones declared by the other application", sharedMemoryName.Buffer());
+            }
+        }
+        else {
+            header[1] = segmentSize;
+        }
+    }
+    return ok;
+}
+
+MARTe::uint32 SharedMemoryDataSource::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool SharedMemoryDataSource::GetSignalMemoryBuffer(const MARTe::uint32 signalIdx, const MARTe::uint32 bufferIdx, void *&signalAddress) {
+    using namespace MARTe;
+    bool ok = (buffers != NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((signalIdx < GetNumberOfSignals()) && (bufferIdx == 0u));
+    }
+    if (ok) {
+        signalAddress = &buffers[signalOffsets[signalIdx]];
+    }
+    return ok;
+}
+
+const MARTe::char8 *SharedMemoryDataSource::GetBrokerName(MARTe::StructuredDataI &data, const MARTe::SignalDirection direction) {
+    using namespace MARTe;
+    const char8 *brokerName = "SharedMemoryInputBroker";
+    if (direction == OutputSignals) {
+        brokerName = "SharedMemoryOutputBroker";
+    }
+    return brokerName;
+}
+
+bool SharedMemoryDataSource::GetInputBrokers(MARTe::ReferenceContainer &inputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<SharedMemoryInputBroker> broker(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+    if (ok) {
+        ok = inputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<SharedMemoryOutputBroker> broker(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+    if (ok) {
+        ok = outputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    if (timeouts > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "The readers of %s timed out %d times waiting for a sample", sharedMemoryName.Buffer(), timeouts);
+        timeouts = 0u;
+    }
+    if (failedReads > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d reads of %s were overwritten by the writer", failedReads, sharedMemoryName.Buffer());
+        failedReads = 0u;
+    }
+    return true;
+}
+
+bool SharedMemoryDataSource::Synchronise() {
+    return true;
+}
+
+MARTe::uint32 SharedMemoryDataSource::GetBufferSize() const {
+    return bufferSize;
+}
+
+MARTe::uint32 SharedMemoryDataSource::ComputeSignature() {
+    using namespace MARTe;
+    uint32 signature = 2166136261u;
+    uint32 i;
+    for (i = 0u; i < GetNumberOfSignals(); i++) {
+        StreamString signalName;
+        (void) GetSignalName(i, signalName);
+        signature = SharedMemoryHash(signature, signalName.Buffer());
+        signature = SharedMemoryHash(signature, TypeDescriptor::GetTypeNameFromTypeDescriptor(GetSignalType(i)));
+        uint32 numberOfElements = 0u;
+        (void) GetSignalNumberOfElements(i, numberOfElements);
+        signature = SharedMemoryHash(signature, numberOfElements);
+    }
+    if (signature == 0u) {
+        signature = 1u;
+    }
+    return signature;
+}
+
+volatile MARTe::uint32 *SharedMemoryDataSource::GetBufferSequence(const MARTe::uint32 buffer) const {
+    return reinterpret_cast<volatile MARTe::uint32 *>(&buffers[buffer * bufferSize]);
+}
+
+void SharedMemoryDataSource::BeginWrite(MARTe::uint32 &buffer) {
+    using namespace MARTe;
+    //Single writer: the published counter is only modified by this thread
+    uint32 published = header[2];
+    buffer = published & (SHARED_MEMORY_NUMBER_OF_BUFFERS - 1u);
+    //Odd sequence: the buffer is being written
+    __atomic_store_n(GetBufferSequence(buffer), (published * 2u) + 1u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+void SharedMemoryDataSource::EndWrite() {
+    using namespace MARTe;
+    uint32 published = header[2];
+    __atomic_store_n(GetBufferSequence(published & (SHARED_MEMORY_NUMBER_OF_BUFFERS - 1u)), (published * 2u) + 2u, __ATOMIC_RELEASE);
+    __atomic_store_n(&header[2], published + 1u, __ATOMIC_RELEASE);
+}
+
+bool SharedMemoryDataSource::BeginRead(const MARTe::uint32 lastSample, MARTe::uint32 &sample, MARTe::uint32 &buffer, MARTe::uint32 &sequence) {
+    using namespace MARTe;
+    sample = __atomic_load_n(&header[2], __ATOMIC_ACQUIRE);
+    if ((timeoutTicks > 0u) && (sample == lastSample)) {
+        uint64 start = HighResolutionTimer::Counter();
+        bool waiting = true;
+        while (waiting) {
+            SharedMemoryCPURelax();
+            sample = __atomic_load_n(&header[2], __ATOMIC_ACQUIRE);
+            waiting = (sample == lastSample);
+            if ((waiting) && ((HighResolutionTimer::Counter() - start) > timeoutTicks)) {
+                (void) __atomic_add_fetch(&timeouts, 1u, __ATOMIC_RELAXED);
+                waiting = false;
+            }
+        }
+    }
+    bool ok = (sample > 0u);
+    if (ok) {
+        uint32 last = sample - 1u;
+        buffer = last & (SHARED_MEMORY_NUMBER_OF_BUFFERS - 1u);
+        sequence = __atomic_load_n(GetBufferSequence(buffer), __ATOMIC_ACQUIRE);
+        //The writer already moved to the next sample in this buffer
+        ok = (sequence == ((last * 2u) + 2u));
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::EndRead(const MARTe::uint32 buffer, const MARTe::uint32 sequence) {
+    using namespace MARTe;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return (__atomic_load_n(GetBufferSequence(buffer), __ATOMIC_RELAXED) == sequence);
+}
+
+void SharedMemoryDataSource::ReadFailed() {
+    (void) __atomic_add_fetch(&failedReads, 1u, __ATOMIC_RELAXED);
+}
+
+CLASS_REGISTER(SharedMemoryDataSource, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,313 @@
+/**
+ * @file SharedMemoryDataSource.h
+ * @brief Header file for class SharedMemoryDataSource
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * SharedMemoryDataSource with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef DATASOURCES_SHAREDMEMORYDATASOURCE_SHAREDMEMORYDATASOURCE_H_
+#define DATASOURCES_SHAREDMEMORYDATASOURCE_SHAREDMEMORYDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Exchanges signals between MARTe applications running on the same
+ * node through a POSIX shared memory segment.
+ *
+ * @details The segment is created (or attached, if it already exists) by
+ * every application which declares a SharedMemoryDataSource with the same
+ * SharedMemoryName, so the writer and the reader applications can be started
+ * in any order. The layout of the segment follows the order of the Signals
+ * declaration: each application shall declare the same signals, with the same
+ * names, types and number of elements, otherwise the attach fails.
+ *
+ * The segment holds two buffers of the signal set. The writer fills the
+ * buffer which is not published, while the readers copy the published one.
+ * Each buffer is protected by a sequence number (seqlock): the writer marks
+ * it odd while writing, so that a reader which was preempted for longer than
+ * a writer cycle detects the overwrite and repeats the copy. The writer never
+ * waits for the readers.
+ *
+ * The brokers copy the signals directly between the GAM memory and the
+ * segment, i.e. there are no copies besides the one into (writer) and out of
+ * (reader) the segment.
+ *
+ * Within an application exactly one GAM can write to the DataSource and it
+ * shall write all the signals. Any number of GAMs can read from it. Only one
+ * application shall write to a given segment.
+ *
+ * If Timeout is set the readers wait (spinning) for a new sample for at most
+ * Timeout microseconds, otherwise they read the latest published sample.
+ * Before the first sample is published the readers keep the default values.
+ *
+ * The segment persists when the applications terminate (so that either one
+ * can be restarted); remove /dev/shm/SharedMemoryName to reset it.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +SharedMemory = {
+ *     Class = SharedMemoryDataSource
+ *     SharedMemoryName = "/wrrd" //Compulsory. Name of the POSIX shared memory segment.
+ *     Timeout = 0 //Optional. Maximum wait (us) of the readers for a new sample. Default = 0 (no wait).
+ *     Signals = {
+ *         Time = {
+ *             Type = uint32
+ *         }
+ *         Sin = {
+ *             Type = float32
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Each signal shall be read and written with Samples = 1.
+ */
+class SharedMemoryDataSource : public MARTe::DataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SharedMemoryDataSource();
+
+    /**
+     * @brief Destructor. Unmaps the shared memory segment.
+     */
+    virtual ~SharedMemoryDataSource();
+
+    /**
+     * @brief Reads the SharedMemoryName and Timeout parameters.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if SharedMemoryName is set.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies that there is at most one writer, that it writes all
+     * the signals and that Samples = 1. Computes the layout of the segment.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if the constraints above are met.
+     */
+    virtual bool SetConfiguredDatabase(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Creates or attaches the shared memory segment.
+     * @return true if the segment can be mapped and its layout matches the
+     * signals declared by this DataSource.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief The brokers manage the two buffers, so only one is exposed.
+     * @return 1u.
+     */
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief Gets the address of the signal in the first buffer.
+     * @details The brokers compute the address in the second buffer by adding
+     * GetBufferSize.
+     * @param[in] signalIdx the signal index.
+     * @param[in] bufferIdx shall be 0u.
+     * @param[out] signalAddress the signal address in the first buffer.
+     * @return true if signalIdx and bufferIdx are valid.
+     */
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief Gets the broker name.
+     * @return SharedMemoryInputBroker for InputSignals and
+     * SharedMemoryOutputBroker for OutputSignals.
+     */
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction);
+
+    /**
+     * @brief Creates a SharedMemoryInputBroker for each reader.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Creates a SharedMemoryOutputBroker for the writer.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief Reports (and clears) the reader timeouts and the failed reads.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Not used, the brokers synchronise through the sequence numbers.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Gets the distance in bytes between the two buffers.
+     * @return the buffer size.
+     */
+    MARTe::uint32 GetBufferSize() const;
+
+    /**
+     * @brief Marks the buffer which is not published as being written.
+     * @param[out] buffer the buffer to be written (0 or 1).
+     */
+    void BeginWrite(MARTe::uint32 &buffer);
+
+    /**
+     * @brief Publishes the buffer reserved by BeginWrite.
+     */
+    void EndWrite();
+
+    /**
+     * @brief Selects the published buffer.
+     * @details If Timeout is set waits until a sample newer than lastSample
+     * is published.
+     * @param[in] lastSample the number of the last sample read by the caller.
+     * @param[out] sample the number of the sample to be read.
+     * @param[out] buffer the buffer to be read (0 or 1).
+     * @param[out] sequence the sequence number to be passed to EndRead.
+     * @return false if nothing was published yet or if the buffer is being
+     * overwritten.
+     */
+    bool BeginRead(const MARTe::uint32 lastSample,
+                   MARTe::uint32 &sample,
+                   MARTe::uint32 &buffer,
+                   MARTe::uint32 &sequence);
+
+    /**
+     * @brief Verifies that the buffer selected by BeginRead was not
+     * overwritten while being copied.
+     * @param[in] buffer the buffer returned by BeginRead.
+     * @param[in] sequence the sequence returned by BeginRead.
+     * @return false if the copy shall be repeated.
+     */
+    bool EndRead(const MARTe::uint32 buffer,
+                 const MARTe::uint32 sequence);
+
+    /**
+     * @brief Counts a read which could not be completed after the maximum
+     * number of attempts.
+     */
+    void ReadFailed();
+
+private:
+    /**
+     * @brief Computes a signature of the signals name, type and number of
+     * elements.
+     * @return the signature (never 0).
+     */
+    MARTe::uint32 ComputeSignature();
+
+    /**
+     * @brief Gets the address of the sequence number of a buffer.
+     * @param[in] buffer the buffer index.
+     * @return the address of the sequence number.
+     */
+    volatile MARTe::uint32 *GetBufferSequence(const MARTe::uint32 buffer) const;
+
+    /**
+     * Name of the shared memory segment.
+     */
+    MARTe::StreamString sharedMemoryName;
+
+    /**
+     * Maximum wait of the readers in HighResolutionTimer ticks.
+     */
+    MARTe::uint64 timeoutTicks;
+
+    /**
+     * The shared memory file descriptor.
+     */
+    MARTe::int32 fd;
+
+    /**
+     * The mapped segment.
+     */
+    void *segment;
+
+    /**
+     * Size of the mapped segment.
+     */
+    MARTe::uint32 segmentSize;
+
+    /**
+     * Header of the segment: [0] signature, [1] segment size, [2] samples
+     * published.
+     */
+    volatile MARTe::uint32 *header;
+
+    /**
+     * The first buffer (cache line aligned).
+     */
+    MARTe::char8 *buffers;
+
+    /**
+     * Distance in bytes between the two buffers.
+     */
+    MARTe::uint32 bufferSize;
+
+    /**
+     * Offset of each signal inside a buffer.
+     */
+    MARTe::uint32 *signalOffsets;
+
+    /**
+     * Reads which timed out waiting for a new sample.
+     */
+    MARTe::uint32 timeouts;
+
+    /**
+     * Reads which could not be completed because the buffer was being
+     * overwritten.
+     */
+    MARTe::uint32 failedReads;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_SHAREDMEMORYDATASOURCE_SHAREDMEMORYDATASOURCE_H_ */
@@ -0,0 +1,104 @@
+/**
+ * @file SharedMemoryInputBroker.h
+ * @brief Header file for class SharedMemoryInputBroker
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * SharedMemoryInputBroker with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be visible
+ * to the compiler.
+ */
+
+#ifndef DATASOURCES_SHAREDMEMORYDATASOURCE_SHAREDMEMORYINPUTBROKER_H_
+#define DATASOURCES_SHAREDMEMORYDATASOURCE_SHAREDMEMORYINPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapBroker.h"
+#include "SharedMemoryDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Copies the signals of the published buffer of a
+ * SharedMemoryDataSource into the memory of the reader GAM.
+ */
+class SharedMemoryInputBroker : public MARTe::MemoryMapBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SharedMemoryInputBroker();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~SharedMemoryInputBroker();
+
+    using MARTe::MemoryMapBroker::Init;
+
+    /**
+     * @brief Builds the copy table (see MemoryMapBroker::Init) against the
+     * first buffer of the shared memory.
+     * @param[in] dataSourceIn shall be a SharedMemoryDataSource.
+     * @return true if MemoryMapBroker::Init succeeds and dataSourceIn is a
+     * SharedMemoryDataSource.
+     */
+    virtual bool Init(const MARTe::SignalDirection direction,
+                      MARTe::DataSourceI &dataSourceIn,
+                      const MARTe::char8 * const functionName,
+                      void * const gamMemoryAddress);
+
+    /**
+     * @brief Copies the published buffer into the GAM memory.
+     * @details If the buffer was overwritten while being copied the copy is
+     * repeated. If nothing was published yet the GAM keeps its values.
+     * @return true.
+     */
+    virtual bool Execute();
+
+private:
+    /**
+     * The shared memory.
+     */
+    SharedMemoryDataSource *sharedMemory;
+
+    /**
+     * Distance in bytes between the two buffers.
+     */
+    MARTe::uint32 bufferSize;
+
+    /**
+     * Number of the last sample read.
+     */
+    MARTe::uint32 lastSample;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_SHAREDMEMORYDATASOURCE_SHAREDMEMORYINPUTBROKER_H_ */
@@ -0,0 +1,290 @@
+/**
+ * @file UDPMulticastPublisher.cpp
+ * @brief Source file for class UDPMulticastPublisher
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class UDPMulticastPublisher (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "MemoryMapSynchronisedOutputBroker.h"
+#include "UDPMulticastPublisher.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Largest datagram which is not fragmented on a standard Ethernet MTU.
+ */
+const MARTe::uint32 UDP_MULTICAST_ETHERNET_PAYLOAD = 1472u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+UDPMulticastPublisher::UDPMulticastPublisher() :
+        MARTe::DataSourceI() {
+    using namespace MARTe;
+    topicId = 0u;
+    ttl = 1u;
+    loopback = true;
+    samplesPerDatagram = 1u;
+    datagramsPerBatch = 1u;
+    sampleSize = 0u;
+    signalOffsets = NULL_PTR(uint32 *);
+    sample = NULL_PTR(char8 *);
+    datagramSize = 0u;
+    datagrams = NULL_PTR(char8 *);
+    vectors = NULL_PTR(struct iovec *);
+    messages = NULL_PTR(struct mmsghdr *);
+    sequence = 0u;
+    epoch = 0u;
+    currentDatagram = 0u;
+    currentSample = 0u;
+    failedDatagrams = 0u;
+}
+
+UDPMulticastPublisher::~UDPMulticastPublisher() {
+    using namespace MARTe;
+    socket.Close();
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+    if (sample != NULL_PTR(char8 *)) {
+        delete[] sample;
+    }
+    if (datagrams != NULL_PTR(char8 *)) {
+        delete[] datagrams;
+    }
+    if (vectors != NULL_PTR(struct iovec *)) {
+        delete[] vectors;
+    }
+    if (messages != NULL_PTR(struct mmsghdr *)) {
+        delete[] messages;
+    }
+}
+
+bool UDPMulticastPublisher::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::Initialise(data);
+    StreamString topic;
+    if (ok) {
+        ok = data.Read("Topic", topic);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Topic shall be specified");
+        }
+    }
+    if (ok) {
+        topicId = UDPMulticastSocket::GetTopicId(topic.Buffer());
+        ok = data.Read("Address", address);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Address shall be specified");
+        }
+    }
+    if (ok) {
+        (void) data.Read("Interface", interfaceName);
+        (void) data.Read("TTL", ttl);
+        uint32 loopbackValue = 1u;
+        (void) data.Read("Loopback", loopbackValue);
+        loopback = (loopbackValue != 0u);
+        (void) data.Read("SamplesPerDatagram", samplesPerDatagram);
+        (void) data.Read("DatagramsPerBatch", datagramsPerBatch);
+        ok = ((samplesPerDatagram > 0u) && (datagramsPerBatch > 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SamplesPerDatagram and DatagramsPerBatch shall be > 0");
+        }
+    }
+    return ok;
+}
+
+bool UDPMulticastPublisher::SetConfiguredDatabase(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfFunctions()) && (ok); i++) {
+        uint32 nOfInputs = 0u;
+        uint32 nOfOutputs = 0u;
+        ok = GetFunctionNumberOfSignals(InputSignals, i, nOfInputs);
+        if (ok) {
+            ok = GetFunctionNumberOfSignals(OutputSignals, i, nOfOutputs);
+        }
+        if ((ok) && (nOfInputs > 0u)) {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "The signals of a UDPMulticastPublisher cannot be read");
+        }
+        uint32 j;
+        for (j = 0u; (j < nOfOutputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(OutputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be written with Samples = 1");
+            }
+        }
+    }
+    if (ok) {
+        uint32 numberOfSignals = GetNumberOfSignals();
+        signalOffsets = new uint32[numberOfSignals];
+        sampleSize = 0u;
+        for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+            uint32 byteSize = 0u;
+            ok = GetSignalByteSize(i, byteSize);
+            signalOffsets[i] = sampleSize;
+            //Keep the signals 64 bits aligned
+            sampleSize += (byteSize + 7u) & ~7u;
+        }
+    }
+    if (ok) {
+        datagramSize = static_cast<uint32>(sizeof(UDPMulticastHeader)) + (samplesPerDatagram * sampleSize);
+        ok = (datagramSize <= UDP_MULTICAST_MAX_DATAGRAM_SIZE);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Datagrams of %d bytes exceed the UDP limit. Reduce SamplesPerDatagram", datagramSize);
+        }
+        else if (datagramSize > UDP_MULTICAST_ETHERNET_PAYLOAD) {
+            REPORT_ERROR(ErrorManagement::Warning, "Datagrams of %d bytes will be fragmented on a standard Ethernet MTU", datagramSize);
+        }
+        else {
+            //NOOP
+        }
+    }
+    return ok;
+}
+
+bool UDPMulticastPublisher::AllocateMemory() {
+    using namespace MARTe;
+    sample = new char8[sampleSize];
+    bool ok = MemoryOperationsHelper::Set(sample, '\0', sampleSize);
+    if (ok) {
+        datagrams = new char8[datagramsPerBatch * datagramSize];
+        vectors = new struct iovec[datagramsPerBatch];
+        messages = new struct mmsghdr[datagramsPerBatch];
+        ok = MemoryOperationsHelper::Set(messages, '\0', static_cast<uint32>(sizeof(struct mmsghdr) * datagramsPerBatch));
+    }
+    uint32 i;
+    for (i = 0u; (i < datagramsPerBatch) && (ok); i++) {
+        vectors[i].iov_base = &datagrams[i * datagramSize];
+        vectors[i].iov_len = datagramSize;
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1u;
+    }
+    if (ok) {
+        //Differs from the epoch of any previous run of the publisher
+        uint64 counter = HighResolutionTimer::Counter();
+        epoch = static_cast<uint32>(counter ^ (counter >> 32u));
+        ok = socket.OpenPublisher(address.Buffer(), interfaceName.Buffer(), ttl, loopback);
+    }
+    return ok;
+}
+
+MARTe::uint32 UDPMulticastPublisher::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool UDPMulticastPublisher::GetSignalMemoryBuffer(const MARTe::uint32 signalIdx, const MARTe::uint32 bufferIdx, void *&signalAddress) {
+    using namespace MARTe;
+    bool ok = (sample != NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((signalIdx < GetNumberOfSignals()) && (bufferIdx == 0u));
+    }
+    if (ok) {
+        signalAddress = &sample[signalOffsets[signalIdx]];
+    }
+    return ok;
+}
+
+const MARTe::char8 *UDPMulticastPublisher::GetBrokerName(MARTe::StructuredDataI &data, const MARTe::SignalDirection direction) {
+    using namespace MARTe;
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == OutputSignals) {
+        brokerName = "MemoryMapSynchronisedOutputBroker";
+    }
+    return brokerName;
+}
+
+bool UDPMulticastPublisher::GetInputBrokers(MARTe::ReferenceContainer &inputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    return false;
+}
+
+bool UDPMulticastPublisher::GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<MemoryMapSynchronisedOutputBroker> broker("MemoryMapSynchronisedOutputBroker");
+    bool ok = broker.IsValid();
+    if (ok) {
+        ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+    }
+    if (ok) {
+        ok = outputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool UDPMulticastPublisher::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    uint32 failed = __atomic_exchange_n(&failedDatagrams, 0u, __ATOMIC_RELAXED);
+    if (failed > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d datagrams could not be sent to %s", failed, address.Buffer());
+    }
+    return true;
+}
+
+bool UDPMulticastPublisher::Synchronise() {
+    using namespace MARTe;
+    char8 *datagram = &datagrams[currentDatagram * datagramSize];
+    UDPMulticastHeader *header = reinterpret_cast<UDPMulticastHeader *>(datagram);
+    if (currentSample == 0u) {
+        header->magic = UDP_MULTICAST_MAGIC;
+        header->topic = topicId;
+        header->sequence = sequence;
+        header->sampleSize = sampleSize;
+        header->epoch = epoch;
+    }
+    uint32 offset = static_cast<uint32>(sizeof(UDPMulticastHeader)) + (currentSample * sampleSize);
+    (void) MemoryOperationsHelper::Copy(&datagram[offset], sample, sampleSize);
+    sequence++;
+    currentSample++;
+    if (currentSample == samplesPerDatagram) {
+        header->numberOfSamples = currentSample;
+        currentSample = 0u;
+        currentDatagram++;
+    }
+    if (currentDatagram == datagramsPerBatch) {
+        uint32 sent = socket.Send(messages, datagramsPerBatch);
+        if (sent < datagramsPerBatch) {
+            (void) __atomic_add_fetch(&failedDatagrams, datagramsPerBatch - sent, __ATOMIC_RELAXED);
+        }
+        currentDatagram = 0u;
+    }
+    return true;
+}
+
+CLASS_REGISTER(UDPMulticastPublisher, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,291 @@
+/**
+ * @file UDPMulticastPublisher.h
+ * @brief Header file for class UDPMulticastPublisher
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * UDPMulticastPublisher with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef DATASOURCES_UDPMULTICAST_UDPMULTICASTPUBLISHER_H_
+#define DATASOURCES_UDPMULTICAST_UDPMULTICASTPUBLISHER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <sys/uio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+#include "StreamString.h"
+#include "UDPMulticastSocket.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Publishes the signals on an IPv4 multicast group, packing several
+ * samples of the topic in each datagram and several datagrams in each
+ * system call.
+ *
+ * @details At every Synchronise the current value of the signals (a sample
+ * of the topic) is appended to the datagram being filled and is given a
+ * sequence number. When SamplesPerDatagram samples have been packed the
+ * datagram is queued and, when DatagramsPerBatch datagrams have been queued,
+ * they are all sent with a single non-blocking sendmmsg. With the default
+ * values (1 and 1) each sample is sent as soon as it is written, as done by
+ * the SDN::SDNPublisher.
+ *
+ * Packing amortises the per-packet cost of the network stack and of the
+ * receivers, allowing publish rates which are not sustainable with one
+ * sample per packet, at the price of SamplesPerDatagram *
+ * DatagramsPerBatch - 1 cycles of latency for the first sample of a batch.
+ * A datagram only carries consecutive samples of one topic; the
+ * UDPMulticastSubscriber receives them in bursts and, by default, reads the
+ * newest one.
+ *
+ * Each datagram starts with a UDPMulticastHeader, whose epoch is drawn when
+ * the memory is allocated, so that the subscribers can tell a restart of the
+ * publisher from late samples. Datagrams which cannot be
+ * sent (e.g. full socket buffer) are dropped and reported at every state
+ * change; the UDPMulticastSubscriber detects the missing sequence numbers.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +UDPPub = {
+ *     Class = UDPMulticastPublisher
+ *     Topic = "pubsub" //Compulsory. Only the subscribers of this topic accept the datagrams.
+ *     Address = "225.168.255.255:1927" //Compulsory. Multicast group and port.
+ *     Interface = "eth0" //Optional. Outgoing interface. Default = the one chosen by the kernel.
+ *     TTL = 1 //Optional. Multicast time to live. Default = 1.
+ *     Loopback = 1 //Optional. Deliver to the subscribers on the same node. Default = 1.
+ *     SamplesPerDatagram = 10 //Optional. Default = 1.
+ *     DatagramsPerBatch = 4 //Optional. Default = 1.
+ *     Signals = {
+ *         Counter = {
+ *             Type = uint32
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Each signal shall be written with Samples = 1 and the subscribers shall
+ * declare the same signals.
+ */
+class UDPMulticastPublisher : public MARTe::DataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    UDPMulticastPublisher();
+
+    /**
+     * @brief Destructor. Frees the memory and closes the socket.
+     */
+    virtual ~UDPMulticastPublisher();
+
+    /**
+     * @brief Reads the parameters listed in the class description.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if the compulsory parameters are set and the optional ones
+     * are valid.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies that the signals are only written, with Samples = 1,
+     * and computes the layout of a sample.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if the constraints above are met and a datagram fits in
+     * UDP_MULTICAST_MAX_DATAGRAM_SIZE.
+     */
+    virtual bool SetConfiguredDatabase(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Allocates the sample and the datagrams and opens the socket.
+     * @return true if the memory can be allocated and the socket opened.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief The signals are packed into the datagrams at Synchronise.
+     * @return 1u.
+     */
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief Gets the address of the signal in the current sample.
+     * @param[in] signalIdx the signal index.
+     * @param[in] bufferIdx shall be 0u.
+     * @param[out] signalAddress the signal address.
+     * @return true if signalIdx and bufferIdx are valid.
+     */
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief Gets the broker name.
+     * @return MemoryMapSynchronisedOutputBroker for OutputSignals, NULL
+     * otherwise.
+     */
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction);
+
+    /**
+     * @brief Input signals are not supported.
+     * @return false.
+     */
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Creates a MemoryMapSynchronisedOutputBroker.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief Reports (and clears) the datagrams which could not be sent.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Packs the current sample and sends the batch when full.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+private:
+    /**
+     * The socket.
+     */
+    UDPMulticastSocket socket;
+
+    /**
+     * The multicast group (address:port).
+     */
+    MARTe::StreamString address;
+
+    /**
+     * The outgoing interface.
+     */
+    MARTe::StreamString interfaceName;
+
+    /**
+     * Identifier of the topic.
+     */
+    MARTe::uint32 topicId;
+
+    /**
+     * The multicast time to live.
+     */
+    MARTe::uint8 ttl;
+
+    /**
+     * True if the datagrams are delivered to the same node.
+     */
+    bool loopback;
+
+    /**
+     * Samples packed in each datagram.
+     */
+    MARTe::uint32 samplesPerDatagram;
+
+    /**
+     * Datagrams sent with each sendmmsg.
+     */
+    MARTe::uint32 datagramsPerBatch;
+
+    /**
+     * Size in bytes of a sample.
+     */
+    MARTe::uint32 sampleSize;
+
+    /**
+     * Offset of each signal inside a sample.
+     */
+    MARTe::uint32 *signalOffsets;
+
+    /**
+     * The current sample, written by the broker.
+     */
+    MARTe::char8 *sample;
+
+    /**
+     * Size in bytes of a full datagram.
+     */
+    MARTe::uint32 datagramSize;
+
+    /**
+     * The datagrams of a batch.
+     */
+    MARTe::char8 *datagrams;
+
+    /**
+     * The I/O vector of each datagram.
+     */
+    struct iovec *vectors;
+
+    /**
+     * The sendmmsg messages.
+     */
+    struct mmsghdr *messages;
+
+    /**
+     * Sequence number of the next sample.
+     */
+    MARTe::uint32 sequence;
+
+    /**
+     * The epoch written in the headers.
+     */
+    MARTe::uint32 epoch;
+
+    /**
+     * Datagram being filled.
+     */
+    MARTe::uint32 currentDatagram;
+
+    /**
+     * Samples in the datagram being filled.
+     */
+    MARTe::uint32 currentSample;
+
+    /**
+     * Datagrams which could not be sent.
+     */
+    MARTe::uint32 failedDatagrams;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_UDPMULTICAST_UDPMULTICASTPUBLISHER_H_ */
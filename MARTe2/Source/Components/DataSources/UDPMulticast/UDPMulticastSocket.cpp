@@ -0,0 +1,207 @@
+/**
+ * @file UDPMulticastSocket.cpp
+ * @brief Source file for class UDPMulticastSocket
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class UDPMulticastSocket (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "StreamString.h"
+#include "UDPMulticastSocket.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+UDPMulticastSocket::UDPMulticastSocket() {
+    fd = -1;
+    interfaceIndex = 0;
+    (void) memset(&group, 0, sizeof(group));
+}
+
+UDPMulticastSocket::~UDPMulticastSocket() {
+    Close();
+}
+
+bool UDPMulticastSocket::SetGroup(const MARTe::char8 * const address, const MARTe::char8 * const interfaceName) {
+    using namespace MARTe;
+    StreamString addressString = address;
+    StreamString host;
+    StreamString port;
+    char8 terminator;
+    bool ok = addressString.Seek(0LLU);
+    if (ok) {
+        ok = addressString.GetToken(host, ":", terminator);
+    }
+    if (ok) {
+        ok = addressString.GetToken(port, ":", terminator);
+    }
+    if (ok) {
+        group.sin_family = AF_INET;
+        group.sin_port = htons(static_cast<uint16>(atoi(port.Buffer())));
+        ok = (inet_pton(AF_INET, host.Buffer(), &group.sin_addr) == 1);
+    }
+    if (ok) {
+        ok = IN_MULTICAST(ntohl(group.sin_addr.s_addr));
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s is not a valid multicast address:port", address);
+    }
+    if ((ok) && (interfaceName != NULL_PTR(const char8 *))) {
+        if (interfaceName[0] != '\0') {
+            interfaceIndex = static_cast<int32>(if_nametoindex(interfaceName));
+            ok = (interfaceIndex > 0);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Interface %s does not exist", interfaceName);
+            }
+        }
+    }
+    return ok;
+}
+
+bool UDPMulticastSocket::OpenPublisher(const MARTe::char8 * const address, const MARTe::char8 * const interfaceName, const MARTe::uint8 ttl,
+                                       const bool loopback) {
+    using namespace MARTe;
+    bool ok = SetGroup(address, interfaceName);
+    if (ok) {
+        fd = socket(AF_INET, SOCK_DGRAM, 0);
+        ok = (fd >= 0);
+    }
+    if (ok) {
+        struct ip_mreqn request;
+        (void) memset(&request, 0, sizeof(request));
+        request.imr_ifindex = interfaceIndex;
+        ok = (setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF, &request, sizeof(request)) == 0);
+    }
+    if (ok) {
+        uint8 value = ttl;
+        ok = (setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &value, sizeof(value)) == 0);
+    }
+    if (ok) {
+        uint8 value = loopback ? 1u : 0u;
+        ok = (setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &value, sizeof(value)) == 0);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not open the publisher socket for %s", address);
+    }
+    return ok;
+}
+
+bool UDPMulticastSocket::OpenSubscriber(const MARTe::char8 * const address, const MARTe::char8 * const interfaceName, const MARTe::uint32 receiveTimeout,
+                                        const MARTe::uint32 busyPoll) {
+    using namespace MARTe;
+    bool ok = SetGroup(address, interfaceName);
+    if (ok) {
+        fd = socket(AF_INET, SOCK_DGRAM, 0);
+        ok = (fd >= 0);
+    }
+    if (ok) {
+        //More than one subscriber per node
+        int32 value = 1;
+        ok = (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &value, sizeof(value)) == 0);
+    }
+    if (ok) {
+        //Binding to the group only delivers the datagrams of the group
+        struct sockaddr_in local = group;
+        ok = (bind(fd, reinterpret_cast<struct sockaddr *>(&local), sizeof(local)) == 0);
+    }
+    if (ok) {
+        struct ip_mreqn request;
+        (void) memset(&request, 0, sizeof(request));
+        request.imr_multiaddr = group.sin_addr;
+        request.imr_ifindex = interfaceIndex;
+        ok = (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &request, sizeof(request)) == 0);
+    }
+    if (ok) {
+        struct timeval timeout;
+        timeout.tv_sec = static_cast<time_t>(receiveTimeout / 1000000u);
+        timeout.tv_usec = static_cast<suseconds_t>(receiveTimeout % 1000000u);
+        ok = (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not open the subscriber socket for %s", address);
+    }
+    if ((ok) && (busyPoll > 0u)) {
+#ifdef SO_BUSY_POLL
+        int32 value = static_cast<int32>(busyPoll);
+        if (setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &value, sizeof(value)) != 0) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not set SO_BUSY_POLL (CAP_NET_ADMIN may be required)");
+        }
+#else
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "SO_BUSY_POLL is not supported");
+#endif
+    }
+    return ok;
+}
+
+MARTe::uint32 UDPMulticastSocket::Send(struct mmsghdr * const messages, const MARTe::uint32 numberOfMessages) {
+    using namespace MARTe;
+    uint32 i;
+    for (i = 0u; i < numberOfMessages; i++) {
+        messages[i].msg_hdr.msg_name = &group;
+        messages[i].msg_hdr.msg_namelen = sizeof(group);
+    }
+    int32 sent = sendmmsg(fd, messages, numberOfMessages, MSG_DONTWAIT);
+    return (sent > 0) ? static_cast<uint32>(sent) : 0u;
+}
+
+MARTe::uint32 UDPMulticastSocket::Receive(struct mmsghdr * const messages, const MARTe::uint32 numberOfMessages) {
+    using namespace MARTe;
+    int32 received = recvmmsg(fd, messages, numberOfMessages, MSG_WAITFORONE, NULL_PTR(struct timespec *));
+    return (received > 0) ? static_cast<uint32>(received) : 0u;
+}
+
+void UDPMulticastSocket::Close() {
+    if (fd >= 0) {
+        (void) close(fd);
+        fd = -1;
+    }
+}
+
+MARTe::uint32 UDPMulticastSocket::GetTopicId(const MARTe::char8 * const topic) {
+    using namespace MARTe;
+    uint32 hash = 2166136261u;
+    const char8 *c = topic;
+    while (*c != '\0') {
+        hash ^= static_cast<uint8>(*c);
+        hash *= 16777619u;
+        c++;
+    }
+    return hash;
+}
+
+} // namespace MARTe2Tutorial
@@ -0,0 +1,199 @@
+/**
+ * @file UDPMulticastSocket.h
+ * @brief Header file for class UDPMulticastSocket
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * UDPMulticastSocket with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be visible
+ * to the compiler.
+ */
+
+#ifndef DATASOURCES_UDPMULTICAST_UDPMULTICASTSOCKET_H_
+#define DATASOURCES_UDPMULTICAST_UDPMULTICASTSOCKET_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * Identifies the datagrams of the UDPMulticastPublisher.
+ */
+const MARTe::uint32 UDP_MULTICAST_MAGIC = 0x4D55504Du;
+
+/**
+ * Maximum size of a UDP datagram over IPv4.
+ */
+const MARTe::uint32 UDP_MULTICAST_MAX_DATAGRAM_SIZE = 65507u;
+
+/**
+ * @brief Header of each datagram, followed by numberOfSamples samples of
+ * sampleSize bytes. The fields are in the host byte order (publisher and
+ * subscribers are expected to run on the same architecture).
+ */
+struct UDPMulticastHeader {
+    /**
+     * UDP_MULTICAST_MAGIC.
+     */
+    MARTe::uint32 magic;
+
+    /**
+     * Identifier of the topic (hash of the Topic name).
+     */
+    MARTe::uint32 topic;
+
+    /**
+     * Sequence number of the first sample of the datagram.
+     */
+    MARTe::uint32 sequence;
+
+    /**
+     * Number of samples in the datagram.
+     */
+    MARTe::uint32 numberOfSamples;
+
+    /**
+     * Size in bytes of each sample.
+     */
+    MARTe::uint32 sampleSize;
+
+    /**
+     * Identifier of the run of the publisher, which changes when the
+     * publisher is restarted (also keeps the samples 64 bits aligned).
+     */
+    MARTe::uint32 epoch;
+};
+
+/**
+ * @brief Thin wrapper of an IPv4 multicast UDP socket with batched
+ * (sendmmsg/recvmmsg) transmission and reception.
+ */
+class UDPMulticastSocket {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    UDPMulticastSocket();
+
+    /**
+     * @brief Destructor. Closes the socket.
+     */
+    ~UDPMulticastSocket();
+
+    /**
+     * @brief Opens a socket which sends to a multicast group.
+     * @param[in] address the group, in the form "225.168.255.255:1927".
+     * @param[in] interfaceName the name of the outgoing interface (empty for
+     * the default one).
+     * @param[in] ttl the multicast time to live.
+     * @param[in] loopback true if the datagrams shall be delivered to the
+     * subscribers of the same node.
+     * @return true if the socket can be opened and configured.
+     */
+    bool OpenPublisher(const MARTe::char8 * const address,
+                       const MARTe::char8 * const interfaceName,
+                       const MARTe::uint8 ttl,
+                       const bool loopback);
+
+    /**
+     * @brief Opens a socket which joins a multicast group.
+     * @param[in] address the group, in the form "225.168.255.255:1927".
+     * @param[in] interfaceName the name of the interface which joins the
+     * group (empty for the default one).
+     * @param[in] receiveTimeout maximum time (us) Receive waits for a datagram.
+     * @param[in] busyPoll SO_BUSY_POLL time (us), 0 to leave it disabled.
+     * @return true if the socket can be opened and configured. Failing to set
+     * SO_BUSY_POLL (it may require CAP_NET_ADMIN) is only reported.
+     */
+    bool OpenSubscriber(const MARTe::char8 * const address,
+                        const MARTe::char8 * const interfaceName,
+                        const MARTe::uint32 receiveTimeout,
+                        const MARTe::uint32 busyPoll);
+
+    /**
+     * @brief Sends a batch of datagrams with a single system call.
+     * @param[in] messages the datagrams. The destination is set by this method.
+     * @param[in] numberOfMessages the number of datagrams.
+     * @return the number of datagrams sent (the call does not block).
+     */
+    MARTe::uint32 Send(struct mmsghdr * const messages,
+                       const MARTe::uint32 numberOfMessages);
+
+    /**
+     * @brief Receives a batch of datagrams with a single system call.
+     * @details Waits for the first datagram for at most the receive timeout
+     * and then returns all the datagrams which are already available.
+     * @param[in,out] messages the receive buffers. The msg_len of each message
+     * is set to the number of bytes received.
+     * @param[in] numberOfMessages the number of buffers.
+     * @return the number of datagrams received (0 on timeout).
+     */
+    MARTe::uint32 Receive(struct mmsghdr * const messages,
+                          const MARTe::uint32 numberOfMessages);
+
+    /**
+     * @brief Closes the socket.
+     */
+    void Close();
+
+    /**
+     * @brief Computes the identifier of a topic.
+     * @param[in] topic the topic name.
+     * @return the FNV-1a hash of the name.
+     */
+    static MARTe::uint32 GetTopicId(const MARTe::char8 * const topic);
+
+private:
+    /**
+     * @brief Parses the address and the interface name.
+     * @return true if the address is a valid IPv4 address followed by a port.
+     */
+    bool SetGroup(const MARTe::char8 * const address,
+                  const MARTe::char8 * const interfaceName);
+
+    /**
+     * The socket file descriptor.
+     */
+    MARTe::int32 fd;
+
+    /**
+     * The multicast group.
+     */
+    struct sockaddr_in group;
+
+    /**
+     * Index of the interface (0 for the default one).
+     */
+    MARTe::int32 interfaceIndex;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_UDPMULTICAST_UDPMULTICASTSOCKET_H_ */
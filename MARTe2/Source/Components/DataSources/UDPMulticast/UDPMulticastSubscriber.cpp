@@ -0,0 +1,487 @@
+/**
+ * @file UDPMulticastSubscriber.cpp
+ * @brief Source file for class UDPMulticastSubscriber
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class UDPMulticastSubscriber (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryMapSynchronisedInputBroker.h"
+#include "UDPMulticastSubscriber.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * @brief Checks that value is a power of 2 >= 2.
+ */
+inline bool UDPMulticastIsPowerOf2(const MARTe::uint32 value) {
+    return ((value >= 2u) && ((value & (value - 1u)) == 0u));
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+UDPMulticastSubscriber::UDPMulticastSubscriber() :
+        MARTe::DataSourceI(), MARTe::EmbeddedServiceMethodBinderI(), executor(*this) {
+    using namespace MARTe;
+    topicId = 0u;
+    batchSize = 16u;
+    busyPoll = 0u;
+    reorderWindow = 16u;
+    reorderTimeout = 100000u;
+    queueDepth = 64u;
+    drain = false;
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    sampleSize = 0u;
+    signalOffsets = NULL_PTR(uint32 *);
+    sample = NULL_PTR(char8 *);
+    datagrams = NULL_PTR(char8 *);
+    vectors = NULL_PTR(struct iovec *);
+    messages = NULL_PTR(struct mmsghdr *);
+    windowSamples = NULL_PTR(char8 *);
+    windowSequences = NULL_PTR(uint32 *);
+    windowValid = NULL_PTR(bool *);
+    started = false;
+    expected = 0u;
+    highest = 0u;
+    epoch = 0u;
+    queue = NULL_PTR(char8 *);
+    queueWritten = 0u;
+    queueRead = 0u;
+    lostSamples = 0u;
+    reorderedSamples = 0u;
+    lateSamples = 0u;
+    droppedSamples = 0u;
+    invalidDatagrams = 0u;
+}
+
+UDPMulticastSubscriber::~UDPMulticastSubscriber() {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    socket.Close();
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+    if (sample != NULL_PTR(char8 *)) {
+        delete[] sample;
+    }
+    if (datagrams != NULL_PTR(char8 *)) {
+        delete[] datagrams;
+    }
+    if (vectors != NULL_PTR(struct iovec *)) {
+        delete[] vectors;
+    }
+    if (messages != NULL_PTR(struct mmsghdr *)) {
+        delete[] messages;
+    }
+    if (windowSamples != NULL_PTR(char8 *)) {
+        delete[] windowSamples;
+    }
+    if (windowSequences != NULL_PTR(uint32 *)) {
+        delete[] windowSequences;
+    }
+    if (windowValid != NULL_PTR(bool *)) {
+        delete[] windowValid;
+    }
+    if (queue != NULL_PTR(char8 *)) {
+        delete[] queue;
+    }
+}
+
+bool UDPMulticastSubscriber::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::Initialise(data);
+    StreamString topic;
+    if (ok) {
+        ok = data.Read("Topic", topic);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Topic shall be specified");
+        }
+    }
+    if (ok) {
+        topicId = UDPMulticastSocket::GetTopicId(topic.Buffer());
+        ok = data.Read("Address", address);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Address shall be specified");
+        }
+    }
+    if (ok) {
+        (void) data.Read("Interface", interfaceName);
+        (void) data.Read("BatchSize", batchSize);
+        (void) data.Read("BusyPoll", busyPoll);
+        (void) data.Read("ReorderWindow", reorderWindow);
+        (void) data.Read("ReorderTimeout", reorderTimeout);
+        (void) data.Read("QueueDepth", queueDepth);
+        uint32 drainIn = 0u;
+        (void) data.Read("Drain", drainIn);
+        drain = (drainIn != 0u);
+        (void) data.Read("CPUs", cpuMask);
+        (void) data.Read("StackSize", stackSize);
+        ok = (batchSize > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "BatchSize shall be > 0");
+        }
+    }
+    if (ok) {
+        ok = (UDPMulticastIsPowerOf2(reorderWindow) && UDPMulticastIsPowerOf2(queueDepth));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "ReorderWindow and QueueDepth shall be powers of 2 >= 2");
+        }
+    }
+    if (ok) {
+        ok = (reorderTimeout > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "ReorderTimeout shall be > 0");
+        }
+    }
+    return ok;
+}
+
+bool UDPMulticastSubscriber::SetConfiguredDatabase(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 i;
+    for (i = 0u; (i < GetNumberOfFunctions()) && (ok); i++) {
+        uint32 nOfInputs = 0u;
+        uint32 nOfOutputs = 0u;
+        ok = GetFunctionNumberOfSignals(InputSignals, i, nOfInputs);
+        if (ok) {
+            ok = GetFunctionNumberOfSignals(OutputSignals, i, nOfOutputs);
+        }
+        if ((ok) && (nOfOutputs > 0u)) {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "The signals of a UDPMulticastSubscriber cannot be written");
+        }
+        uint32 j;
+        for (j = 0u; (j < nOfInputs) && (ok); j++) {
+            uint32 samples = 0u;
+            ok = GetFunctionSignalSamples(InputSignals, i, j, samples);
+            if (ok) {
+                ok = (samples == 1u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signals shall be read with Samples = 1");
+            }
+        }
+    }
+    if (ok) {
+        uint32 numberOfSignals = GetNumberOfSignals();
+        signalOffsets = new uint32[numberOfSignals];
+        sampleSize = 0u;
+        for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+            uint32 byteSize = 0u;
+            ok = GetSignalByteSize(i, byteSize);
+            signalOffsets[i] = sampleSize;
+            //Same layout of the UDPMulticastPublisher
+            sampleSize += (byteSize + 7u) & ~7u;
+        }
+    }
+    return ok;
+}
+
+bool UDPMulticastSubscriber::AllocateMemory() {
+    using namespace MARTe;
+    sample = new char8[sampleSize];
+    bool ok = MemoryOperationsHelper::Set(sample, '\0', sampleSize);
+    if (ok) {
+        datagrams = new char8[batchSize * UDP_MULTICAST_MAX_DATAGRAM_SIZE];
+        vectors = new struct iovec[batchSize];
+        messages = new struct mmsghdr[batchSize];
+        ok = MemoryOperationsHelper::Set(messages, '\0', static_cast<uint32>(sizeof(struct mmsghdr) * batchSize));
+    }
+    uint32 i;
+    for (i = 0u; (i < batchSize) && (ok); i++) {
+        vectors[i].iov_base = &datagrams[i * UDP_MULTICAST_MAX_DATAGRAM_SIZE];
+        vectors[i].iov_len = UDP_MULTICAST_MAX_DATAGRAM_SIZE;
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1u;
+    }
+    if (ok) {
+        windowSamples = new char8[reorderWindow * sampleSize];
+        windowSequences = new uint32[reorderWindow];
+        windowValid = new bool[reorderWindow];
+        for (i = 0u; i < reorderWindow; i++) {
+            windowSequences[i] = 0u;
+            windowValid[i] = false;
+        }
+        queue = new char8[queueDepth * sampleSize];
+    }
+    if (ok) {
+        ok = socket.OpenSubscriber(address.Buffer(), interfaceName.Buffer(), reorderTimeout, busyPoll);
+    }
+    return ok;
+}
+
+MARTe::uint32 UDPMulticastSubscriber::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool UDPMulticastSubscriber::GetSignalMemoryBuffer(const MARTe::uint32 signalIdx, const MARTe::uint32 bufferIdx, void *&signalAddress) {
+    using namespace MARTe;
+    bool ok = (sample != NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((signalIdx < GetNumberOfSignals()) && (bufferIdx == 0u));
+    }
+    if (ok) {
+        signalAddress = &sample[signalOffsets[signalIdx]];
+    }
+    return ok;
+}
+
+const MARTe::char8 *UDPMulticastSubscriber::GetBrokerName(MARTe::StructuredDataI &data, const MARTe::SignalDirection direction) {
+    using namespace MARTe;
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        brokerName = "MemoryMapSynchronisedInputBroker";
+    }
+    return brokerName;
+}
+
+bool UDPMulticastSubscriber::GetInputBrokers(MARTe::ReferenceContainer &inputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    using namespace MARTe;
+    ReferenceT<MemoryMapSynchronisedInputBroker> broker("MemoryMapSynchronisedInputBroker");
+    bool ok = broker.IsValid();
+    if (ok) {
+        ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+    }
+    if (ok) {
+        ok = inputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+bool UDPMulticastSubscriber::GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers, const MARTe::char8 * const functionName, void * const gamMemPtr) {
+    return false;
+}
+
+bool UDPMulticastSubscriber::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    bool ok = true;
+    if (executor.GetStatus() == EmbeddedThreadI::OffState) {
+        executor.SetName(GetName());
+        executor.SetCPUMask(cpuMask);
+        executor.SetStackSize(stackSize);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the receiver thread");
+        }
+    }
+    uint32 value = __atomic_exchange_n(&lostSamples, 0u, __ATOMIC_RELAXED);
+    if (value > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d samples of %s were lost", value, address.Buffer());
+    }
+    value = __atomic_exchange_n(&reorderedSamples, 0u, __ATOMIC_RELAXED);
+    if (value > 0u) {
+        REPORT_ERROR(ErrorManagement::Information, "%d samples of %s were received out of order", value, address.Buffer());
+    }
+    value = __atomic_exchange_n(&lateSamples, 0u, __ATOMIC_RELAXED);
+    if (value > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d samples of %s were duplicated or too late", value, address.Buffer());
+    }
+    value = __atomic_exchange_n(&droppedSamples, 0u, __ATOMIC_RELAXED);
+    if (value > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d samples of %s were dropped because the queue was full", value, address.Buffer());
+    }
+    value = __atomic_exchange_n(&invalidDatagrams, 0u, __ATOMIC_RELAXED);
+    if (value > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d datagrams received on %s were not valid for this topic", value, address.Buffer());
+    }
+    return ok;
+}
+
+bool UDPMulticastSubscriber::Synchronise() {
+    using namespace MARTe;
+    uint32 read = queueRead;
+    uint32 written = __atomic_load_n(&queueWritten, __ATOMIC_ACQUIRE);
+    if (written != read) {
+        if (drain) {
+            //Skip the older samples of the burst
+            uint32 skipped = static_cast<uint32>(written - read) - 1u;
+            if (skipped > 0u) {
+                Count(lostSamples, skipped);
+                read += skipped;
+            }
+        }
+        (void) MemoryOperationsHelper::Copy(sample, &queue[(read & (queueDepth - 1u)) * sampleSize], sampleSize);
+        __atomic_store_n(&queueRead, read + 1u, __ATOMIC_RELEASE);
+    }
+    return true;
+}
+
+MARTe::ErrorManagement::ErrorType UDPMulticastSubscriber::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint32 received = socket.Receive(messages, batchSize);
+        if (received == 0u) {
+            //ReorderTimeout without datagrams: the holes will not be filled
+            Flush();
+        }
+        uint32 i;
+        for (i = 0u; i < received; i++) {
+            ProcessDatagram(static_cast<const char8 *>(vectors[i].iov_base), messages[i].msg_len);
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+void UDPMulticastSubscriber::ProcessDatagram(const MARTe::char8 * const datagram, const MARTe::uint32 length) {
+    using namespace MARTe;
+    const uint32 headerSize = static_cast<uint32>(sizeof(UDPMulticastHeader));
+    bool ok = (length >= headerSize);
+    UDPMulticastHeader header;
+    if (ok) {
+        (void) MemoryOperationsHelper::Copy(&header, datagram, headerSize);
+        ok = ((header.magic == UDP_MULTICAST_MAGIC) && (header.topic == topicId) && (header.sampleSize == sampleSize) && (sampleSize > 0u));
+    }
+    if (ok) {
+        //Bound the numberOfSamples before the product, which could otherwise wrap
+        ok = (header.numberOfSamples <= ((length - headerSize) / sampleSize));
+    }
+    if (ok) {
+        ok = (length == (headerSize + (header.numberOfSamples * sampleSize)));
+    }
+    if (ok) {
+        if ((started) && (header.epoch != epoch)) {
+            //The publisher was restarted
+            Flush();
+            started = false;
+        }
+        epoch = header.epoch;
+        uint32 n;
+        for (n = 0u; n < header.numberOfSamples; n++) {
+            InsertSample(header.sequence + n, &datagram[headerSize + (n * sampleSize)]);
+        }
+    }
+    else {
+        Count(invalidDatagrams, 1u);
+    }
+}
+
+void UDPMulticastSubscriber::InsertSample(const MARTe::uint32 sequence, const MARTe::char8 * const data) {
+    using namespace MARTe;
+    if (!started) {
+        started = true;
+        expected = sequence;
+        highest = sequence;
+    }
+    int32 distance = static_cast<int32>(sequence - expected);
+    bool insert = (distance >= 0);
+    if (insert) {
+        if (static_cast<uint32>(distance) >= reorderWindow) {
+            //Make room: the samples which are still missing are lost
+            ReleaseUntil(sequence - reorderWindow + 1u);
+        }
+        uint32 position = sequence & (reorderWindow - 1u);
+        insert = !((windowValid[position]) && (windowSequences[position] == sequence));
+    }
+    if (insert) {
+        uint32 position = sequence & (reorderWindow - 1u);
+        (void) MemoryOperationsHelper::Copy(&windowSamples[position * sampleSize], data, sampleSize);
+        windowSequences[position] = sequence;
+        windowValid[position] = true;
+        if (static_cast<int32>(sequence - highest) < 0) {
+            Count(reorderedSamples, 1u);
+        }
+        else {
+            highest = sequence;
+        }
+        ReleaseContiguous();
+    }
+    else {
+        Count(lateSamples, 1u);
+    }
+}
+
+void UDPMulticastSubscriber::ReleaseUntil(const MARTe::uint32 until) {
+    using namespace MARTe;
+    uint32 missing = static_cast<uint32>(until - expected);
+    //Only the samples in the window can have been received
+    uint32 steps = (missing < reorderWindow) ? missing : reorderWindow;
+    uint32 i;
+    for (i = 0u; i < steps; i++) {
+        uint32 position = expected & (reorderWindow - 1u);
+        if ((windowValid[position]) && (windowSequences[position] == expected)) {
+            Enqueue(&windowSamples[position * sampleSize]);
+        }
+        else {
+            Count(lostSamples, 1u);
+        }
+        windowValid[position] = false;
+        expected++;
+    }
+    if (missing > steps) {
+        Count(lostSamples, missing - steps);
+        expected = until;
+    }
+}
+
+void UDPMulticastSubscriber::ReleaseContiguous() {
+    using namespace MARTe;
+    uint32 position = expected & (reorderWindow - 1u);
+    while ((windowValid[position]) && (windowSequences[position] == expected)) {
+        Enqueue(&windowSamples[position * sampleSize]);
+        windowValid[position] = false;
+        expected++;
+        position = expected & (reorderWindow - 1u);
+    }
+}
+
+void UDPMulticastSubscriber::Flush() {
+    using namespace MARTe;
+    if ((started) && (static_cast<int32>(highest - expected) >= 0)) {
+        ReleaseUntil(highest + 1u);
+    }
+}
+
+void UDPMulticastSubscriber::Enqueue(const MARTe::char8 * const data) {
+    using namespace MARTe;
+    uint32 written = queueWritten;
+    if ((written - __atomic_load_n(&queueRead, __ATOMIC_ACQUIRE)) < queueDepth) {
+        (void) MemoryOperationsHelper::Copy(&queue[(written & (queueDepth - 1u)) * sampleSize], data, sampleSize);
+        __atomic_store_n(&queueWritten, written + 1u, __ATOMIC_RELEASE);
+    }
+    else {
+        Count(droppedSamples, 1u);
+    }
+}
+
+void UDPMulticastSubscriber::Count(MARTe::uint32 &counter, const MARTe::uint32 value) {
+    (void) __atomic_add_fetch(&counter, value, __ATOMIC_RELAXED);
+}
+
+CLASS_REGISTER(UDPMulticastSubscriber, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,428 @@
+/**
+ * @file UDPMulticastSubscriber.h
+ * @brief Header file for class UDPMulticastSubscriber
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * UDPMulticastSubscriber with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef DATASOURCES_UDPMULTICAST_UDPMULTICASTSUBSCRIBER_H_
+#define DATASOURCES_UDPMULTICAST_UDPMULTICASTSUBSCRIBER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <sys/uio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+#include "UDPMulticastSocket.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Receives the samples published by an UDPMulticastPublisher,
+ * restoring their order and detecting the missing ones.
+ *
+ * @details A dedicated thread receives up to BatchSize datagrams with each
+ * recvmmsg (optionally with SO_BUSY_POLL) and unpacks their samples into a
+ * reorder window of ReorderWindow samples, indexed by sequence number.
+ * Samples are released in sequence order as soon as they are contiguous:
+ *  - a sample which arrives after a later one is put back in order;
+ *  - a missing sample is declared lost when a sample ReorderWindow positions
+ *    later arrives, or when no datagram is received for ReorderTimeout
+ *    microseconds;
+ *  - duplicated samples and samples older than the window are discarded.
+ * A datagram with a different epoch comes from a restarted publisher: the
+ * window is then flushed and restarted from its sequence number.
+ *
+ * The released samples are queued (lock-free, QueueDepth samples) to the
+ * real-time thread: at every Synchronise the oldest queued sample is copied
+ * into the signals, so that every sample is read once and in order. As a
+ * publisher with SamplesPerDatagram > 1 delivers its samples in bursts, the
+ * real-time thread may lag behind it: with Drain = 1 the newest queued
+ * sample is copied instead and the older ones are counted as lost. If no
+ * sample is queued the signals keep their values. If the queue is full the
+ * newest samples are dropped.
+ *
+ * Lost (including those skipped with Drain = 1), reordered,
+ * duplicated/late, dropped and invalid samples are reported at every state
+ * change.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +UDPSub = {
+ *     Class = UDPMulticastSubscriber
+ *     Topic = "pubsub" //Compulsory. Datagrams of other topics are ignored.
+ *     Address = "225.168.255.255:1927" //Compulsory. Multicast group and port.
+ *     Interface = "eth0" //Optional. Interface which joins the group. Default = the one chosen by the kernel.
+ *     BatchSize = 16 //Optional. Datagrams received with each recvmmsg. Default = 16.
+ *     BusyPoll = 50 //Optional. SO_BUSY_POLL (us). Default = 0 (disabled).
+ *     ReorderWindow = 16 //Optional. Power of 2. Default = 16.
+ *     ReorderTimeout = 100000 //Optional. Time (us) after which the holes in the window are declared lost. Default = 100000.
+ *     QueueDepth = 64 //Optional. Power of 2. Default = 64.
+ *     Drain = 1 //Optional. Read the newest queued sample at every Synchronise. Default = 0.
+ *     CPUs = 0x1 //Optional. Affinity of the receiver thread. Default = 0xff.
+ *     StackSize = 1048576 //Optional. Stack size of the receiver thread. Default = THREADS_DEFAULT_STACKSIZE.
+ *     Signals = {
+ *         Counter = {
+ *             Type = uint32
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Each signal shall be read with Samples = 1 and the signals shall be the same
+ * declared by the publisher.
+ */
+class UDPMulticastSubscriber : public MARTe::DataSourceI, public MARTe::EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    UDPMulticastSubscriber();
+
+    /**
+     * @brief Destructor. Stops the receiver thread and frees the memory.
+     */
+    virtual ~UDPMulticastSubscriber();
+
+    /**
+     * @brief Reads the parameters listed in the class description.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if the compulsory parameters are set and the optional ones
+     * are valid.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies that the signals are only read, with Samples = 1, and
+     * computes the layout of a sample.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if the constraints above are met.
+     */
+    virtual bool SetConfiguredDatabase(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Allocates the receive buffers, the reorder window and the queue
+     * and joins the multicast group.
+     * @return true if the memory can be allocated and the group joined.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief The queued samples are copied into the signals at Synchronise.
+     * @return 1u.
+     */
+    virtual MARTe::uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief Gets the address of the signal in the current sample.
+     * @param[in] signalIdx the signal index.
+     * @param[in] bufferIdx shall be 0u.
+     * @param[out] signalAddress the signal address.
+     * @return true if signalIdx and bufferIdx are valid.
+     */
+    virtual bool GetSignalMemoryBuffer(const MARTe::uint32 signalIdx,
+                                       const MARTe::uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief Gets the broker name.
+     * @return MemoryMapSynchronisedInputBroker for InputSignals, NULL
+     * otherwise.
+     */
+    virtual const MARTe::char8 *GetBrokerName(MARTe::StructuredDataI &data,
+                                              const MARTe::SignalDirection direction);
+
+    /**
+     * @brief Creates a MemoryMapSynchronisedInputBroker.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetInputBrokers(MARTe::ReferenceContainer &inputBrokers,
+                                 const MARTe::char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Output signals are not supported.
+     * @return false.
+     */
+    virtual bool GetOutputBrokers(MARTe::ReferenceContainer &outputBrokers,
+                                  const MARTe::char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief Starts the receiver thread (the first time) and reports (and
+     * clears) the statistics.
+     * @return true if the receiver thread is running.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Copies the oldest (or, if Drain = 1, the newest) queued sample
+     * into the signals.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Callback function for the receiver thread. Receives a batch of
+     * datagrams and releases the samples in order.
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+private:
+    /**
+     * @brief Validates a datagram and inserts its samples in the window.
+     * @param[in] datagram the datagram.
+     * @param[in] length the number of bytes received.
+     */
+    void ProcessDatagram(const MARTe::char8 * const datagram,
+                         const MARTe::uint32 length);
+
+    /**
+     * @brief Inserts a sample in the reorder window and releases the
+     * contiguous samples.
+     * @param[in] sequence the sample sequence number.
+     * @param[in] data the sample.
+     */
+    void InsertSample(const MARTe::uint32 sequence,
+                      const MARTe::char8 * const data);
+
+    /**
+     * @brief Releases (or declares lost) the samples of the window up to
+     * (excluded) the given sequence number.
+     * @param[in] until the first sequence number which is not released.
+     */
+    void ReleaseUntil(const MARTe::uint32 until);
+
+    /**
+     * @brief Releases the samples of the window which are contiguous to the
+     * last released one.
+     */
+    void ReleaseContiguous();
+
+    /**
+     * @brief Releases all the samples of the window, declaring the holes lost.
+     */
+    void Flush();
+
+    /**
+     * @brief Queues a sample for the real-time thread.
+     * @param[in] data the sample.
+     */
+    void Enqueue(const MARTe::char8 * const data);
+
+    /**
+     * @brief Atomically increments a statistic.
+     * @param[in,out] counter the statistic.
+     * @param[in] value the increment.
+     */
+    static void Count(MARTe::uint32 &counter,
+                      const MARTe::uint32 value);
+
+    /**
+     * The receiver thread.
+     */
+    MARTe::SingleThreadService executor;
+
+    /**
+     * The socket.
+     */
+    UDPMulticastSocket socket;
+
+    /**
+     * The multicast group (address:port).
+     */
+    MARTe::StreamString address;
+
+    /**
+     * The interface which joins the group.
+     */
+    MARTe::StreamString interfaceName;
+
+    /**
+     * Identifier of the topic.
+     */
+    MARTe::uint32 topicId;
+
+    /**
+     * Datagrams received with each recvmmsg.
+     */
+    MARTe::uint32 batchSize;
+
+    /**
+     * SO_BUSY_POLL (us).
+     */
+    MARTe::uint32 busyPoll;
+
+    /**
+     * Samples in the reorder window (power of 2).
+     */
+    MARTe::uint32 reorderWindow;
+
+    /**
+     * Time (us) without datagrams after which the window is flushed.
+     */
+    MARTe::uint32 reorderTimeout;
+
+    /**
+     * Samples in the queue (power of 2).
+     */
+    MARTe::uint32 queueDepth;
+
+    /**
+     * Read the newest queued sample at every Synchronise.
+     */
+    bool drain;
+
+    /**
+     * The CPU mask for the executor.
+     */
+    MARTe::uint32 cpuMask;
+
+    /**
+     * The stack size for the executor.
+     */
+    MARTe::uint32 stackSize;
+
+    /**
+     * Size in bytes of a sample.
+     */
+    MARTe::uint32 sampleSize;
+
+    /**
+     * Offset of each signal inside a sample.
+     */
+    MARTe::uint32 *signalOffsets;
+
+    /**
+     * The current sample, read by the broker.
+     */
+    MARTe::char8 *sample;
+
+    /**
+     * The receive buffers.
+     */
+    MARTe::char8 *datagrams;
+
+    /**
+     * The I/O vector of each receive buffer.
+     */
+    struct iovec *vectors;
+
+    /**
+     * The recvmmsg messages.
+     */
+    struct mmsghdr *messages;
+
+    /**
+     * The samples in the reorder window.
+     */
+    MARTe::char8 *windowSamples;
+
+    /**
+     * Sequence number of each sample in the reorder window.
+     */
+    MARTe::uint32 *windowSequences;
+
+    /**
+     * True if the corresponding window position holds a sample.
+     */
+    bool *windowValid;
+
+    /**
+     * True once the first sample was received.
+     */
+    bool started;
+
+    /**
+     * Sequence number of the next sample to be released.
+     */
+    MARTe::uint32 expected;
+
+    /**
+     * Highest sequence number received.
+     */
+    MARTe::uint32 highest;
+
+    /**
+     * Epoch of the publisher.
+     */
+    MARTe::uint32 epoch;
+
+    /**
+     * The queued samples.
+     */
+    MARTe::char8 *queue;
+
+    /**
+     * Samples queued by the receiver thread.
+     */
+    volatile MARTe::uint32 queueWritten;
+
+    /**
+     * Samples consumed by the real-time thread.
+     */
+    volatile MARTe::uint32 queueRead;
+
+    /**
+     * Samples never received or skipped.
+     */
+    MARTe::uint32 lostSamples;
+
+    /**
+     * Samples received after a later one.
+     */
+    MARTe::uint32 reorderedSamples;
+
+    /**
+     * Duplicated samples and samples older than the window.
+     */
+    MARTe::uint32 lateSamples;
+
+    /**
+     * Samples dropped because the queue was full.
+     */
+    MARTe::uint32 droppedSamples;
+
+    /**
+     * Datagrams which are not valid for this topic.
+     */
+    MARTe::uint32 invalidDatagrams;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DATASOURCES_UDPMULTICAST_UDPMULTICASTSUBSCRIBER_H_ */
@@ -0,0 +1,247 @@
+/**
+ * @file BatchStateSpaceGAM.cpp
+ * @brief Source file for class BatchStateSpaceGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BatchStateSpaceGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BatchStateSpaceGAM.h"
+#include "ControlGAMsHelper.h"
+#include "ControlKernels.h"
+#include "HotPathTrace.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+BatchStateSpaceGAM::BatchStateSpaceGAM() :
+        MARTe::GAM(),
+        MARTe::StatefulI() {
+    using namespace MARTe;
+    numberOfInstances = 0u;
+    numberOfStates = 0u;
+    numberOfInputs = 0u;
+    numberOfOutputs = 0u;
+    hasFeedthrough = false;
+    A = NULL_PTR(float64 *);
+    B = NULL_PTR(float64 *);
+    C = NULL_PTR(float64 *);
+    D = NULL_PTR(float64 *);
+    x0 = NULL_PTR(float64 *);
+    x = NULL_PTR(float64 *);
+    xNext = NULL_PTR(float64 *);
+    u = NULL_PTR(float64 *);
+    y = NULL_PTR(float64 *);
+}
+
+BatchStateSpaceGAM::~BatchStateSpaceGAM() {
+    using namespace MARTe;
+    if (A != NULL_PTR(float64 *)) {
+        delete[] A;
+    }
+    if (B != NULL_PTR(float64 *)) {
+        delete[] B;
+    }
+    if (C != NULL_PTR(float64 *)) {
+        delete[] C;
+    }
+    if (D != NULL_PTR(float64 *)) {
+        delete[] D;
+    }
+    if (x0 != NULL_PTR(float64 *)) {
+        delete[] x0;
+    }
+    if (x != NULL_PTR(float64 *)) {
+        delete[] x;
+    }
+    if (xNext != NULL_PTR(float64 *)) {
+        delete[] xNext;
+    }
+}
+
+bool BatchStateSpaceGAM::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        ok = data.Read("NumberOfInstances", numberOfInstances);
+        if (ok) {
+            ok = data.Read("NumberOfStates", numberOfStates);
+        }
+        if (ok) {
+            ok = data.Read("NumberOfInputs", numberOfInputs);
+        }
+        if (ok) {
+            ok = data.Read("NumberOfOutputs", numberOfOutputs);
+        }
+        if (ok) {
+            ok = ((numberOfInstances > 0u) && (numberOfStates > 0u) && (numberOfInputs > 0u) && (numberOfOutputs > 0u));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfInstances, NumberOfStates, NumberOfInputs and NumberOfOutputs shall be specified and shall be > 0");
+        }
+    }
+    if (ok) {
+        ok = data.MoveRelative("Parameters");
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Parameters shall be specified");
+        }
+    }
+    if (ok) {
+        ok = ReadParameter(data, "A", numberOfStates, numberOfStates, false, A);
+        if (ok) {
+            ok = ReadParameter(data, "B", numberOfStates, numberOfInputs, false, B);
+        }
+        if (ok) {
+            ok = ReadParameter(data, "C", numberOfOutputs, numberOfStates, false, C);
+        }
+        if (ok) {
+            hasFeedthrough = !data.GetType("D").IsVoid();
+            ok = ReadParameter(data, "D", numberOfOutputs, numberOfInputs, true, D);
+        }
+        if (ok) {
+            ok = ReadParameter(data, "x0", numberOfStates, 1u, true, x0);
+        }
+        (void) data.MoveToAncestor(1u);
+    }
+    return ok;
+}
+
+bool BatchStateSpaceGAM::ReadParameter(MARTe::StructuredDataI &data, const MARTe::char8 * const name, const MARTe::uint32 numberOfRows,
+                                       const MARTe::uint32 numberOfColumns, const bool optional, MARTe::float64 *&soa) const {
+    using namespace MARTe;
+    uint32 numberOfMatrixElements = numberOfRows * numberOfColumns;
+    soa = new float64[numberOfMatrixElements * numberOfInstances];
+    bool ok = true;
+    if ((optional) && (data.GetType(name).IsVoid())) {
+        ok = MemoryOperationsHelper::Set(soa, '\0', static_cast<uint32>(numberOfMatrixElements * numberOfInstances * sizeof(float64)));
+    }
+    else {
+        float64 *values = NULL_PTR(float64 *);
+        uint32 rows = 0u;
+        uint32 columns = 0u;
+        ok = ControlGAMsHelper::ReadMatrix(data, name, values, rows, columns);
+        bool perInstance = false;
+        if (ok) {
+            perInstance = ((rows == numberOfInstances) && (columns == numberOfMatrixElements));
+            ok = ((perInstance) || ((rows * columns) == numberOfMatrixElements));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError,
+                             "%s shall be a %d x %d matrix or have %d rows (one per instance) of %d elements", name, numberOfRows, numberOfColumns,
+                             numberOfInstances, numberOfMatrixElements);
+            }
+        }
+        if (ok) {
+            uint32 e;
+            for (e = 0u; e < numberOfMatrixElements; e++) {
+                uint32 n;
+                for (n = 0u; n < numberOfInstances; n++) {
+                    soa[(e * numberOfInstances) + n] = (perInstance) ? (values[(n * numberOfMatrixElements) + e]) : (values[e]);
+                }
+            }
+        }
+        if (values != NULL_PTR(float64 *)) {
+            delete[] values;
+        }
+    }
+    return ok;
+}
+
+bool BatchStateSpaceGAM::Setup() {
+    using namespace MARTe;
+    uint32 inputElements = 0u;
+    uint32 outputElements = 0u;
+    bool ok = ControlGAMsHelper::GetFloat64Elements(*this, InputSignals, inputElements);
+    if (ok) {
+        ok = ControlGAMsHelper::GetFloat64Elements(*this, OutputSignals, outputElements);
+    }
+    if (ok) {
+        ok = (inputElements == (numberOfInputs * numberOfInstances));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The input signals shall have %d elements in total", numberOfInputs * numberOfInstances);
+        }
+    }
+    if (ok) {
+        ok = (outputElements == (numberOfOutputs * numberOfInstances));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The output signals shall have %d elements in total", numberOfOutputs * numberOfInstances);
+        }
+    }
+    if (ok) {
+        u = static_cast<float64 *>(GetInputSignalsMemory());
+        y = static_cast<float64 *>(GetOutputSignalsMemory());
+        x = new float64[numberOfStates * numberOfInstances];
+        xNext = new float64[numberOfStates * numberOfInstances];
+        ok = PrepareNextState("", "");
+    }
+    return ok;
+}
+
+bool BatchStateSpaceGAM::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    return MemoryOperationsHelper::Copy(x, x0, static_cast<uint32>(numberOfStates * numberOfInstances * sizeof(float64)));
+}
+
+void BatchStateSpaceGAM::MultiplyAdd(MARTe::float64 * const out, const MARTe::float64 * const matrix, const MARTe::float64 * const in,
+                                     const MARTe::uint32 numberOfRows, const MARTe::uint32 numberOfColumns) const {
+    using namespace MARTe;
+    uint32 i;
+    for (i = 0u; i < numberOfRows; i++) {
+        uint32 j;
+        for (j = 0u; j < numberOfColumns; j++) {
+            ControlKernels::MultiplyAdd(&out[i * numberOfInstances], &matrix[((i * numberOfColumns) + j) * numberOfInstances], &in[j * numberOfInstances],
+                                        numberOfInstances);
+        }
+    }
+}
+
+bool BatchStateSpaceGAM::Execute() {
+    using namespace MARTe;
+    HOT_PATH_TRACE_BEGIN("BatchStateSpaceGAM::Execute");
+    (void) MemoryOperationsHelper::Set(y, '\0', static_cast<uint32>(numberOfOutputs * numberOfInstances * sizeof(float64)));
+    MultiplyAdd(y, C, x, numberOfOutputs, numberOfStates);
+    if (hasFeedthrough) {
+        MultiplyAdd(y, D, u, numberOfOutputs, numberOfInputs);
+    }
+    (void) MemoryOperationsHelper::Set(xNext, '\0', static_cast<uint32>(numberOfStates * numberOfInstances * sizeof(float64)));
+    MultiplyAdd(xNext, A, x, numberOfStates, numberOfStates);
+    MultiplyAdd(xNext, B, u, numberOfStates, numberOfInputs);
+    float64 *swap = x;
+    x = xNext;
+    xNext = swap;
+    HOT_PATH_TRACE_END("BatchStateSpaceGAM::Execute");
+    return true;
+}
+
+CLASS_REGISTER(BatchStateSpaceGAM, "")
+} // namespace MARTe2Tutorial
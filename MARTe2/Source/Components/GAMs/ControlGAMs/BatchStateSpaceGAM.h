@@ -0,0 +1,258 @@
+/**
+ * @file BatchStateSpaceGAM.h
+ * @brief Header file for class BatchStateSpaceGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * BatchStateSpaceGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_CONTROLGAMS_BATCHSTATESPACEGAM_H_
+#define GAMS_CONTROLGAMS_BATCHSTATESPACEGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "StatefulI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Advances NumberOfInstances independent discrete-time state-space
+ * systems with the same dimensions in a single step.
+ *
+ * @details For every instance n:
+ * y_n[k] = C_n x_n[k] + D_n u_n[k]
+ * x_n[k+1] = A_n x_n[k] + B_n u_n[k]
+ *
+ * The matrices and the states are stored as structure of arrays: the
+ * element (i, j) of A of all the instances is a contiguous array of
+ * NumberOfInstances values (and likewise for B, C, D and x). The step is
+ * thus a sequence of element-wise multiply-accumulate operations over the
+ * instances, which are vectorised (4 instances per instruction with AVX,
+ * 2 with SSE2 and NEON).
+ *
+ * Each matrix parameter can be given either as a single matrix, shared by
+ * all the instances, or as a matrix with NumberOfInstances rows where the
+ * row n holds the matrix of the instance n flattened by rows.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +GAMPlants = {
+ *     Class = BatchStateSpaceGAM
+ *     NumberOfInstances = 3 //Compulsory.
+ *     NumberOfStates = 2 //Compulsory.
+ *     NumberOfInputs = 1 //Compulsory.
+ *     NumberOfOutputs = 1 //Compulsory.
+ *     InputSignals = {
+ *         u = { //u[n] is the input of the instance n.
+ *             DataSource = DDB1
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         y = { //y[n] is the output of the instance n.
+ *             DataSource = DDB1
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ *     Parameters = {
+ *         A = (float64) {{0.9999, 0.0099, -0.0099, 0.9979}, {0.9998, 0.0099, -0.0099, 0.9969}, {0.9997, 0.0099, -0.0099, 0.9959}} //Compulsory. Per instance.
+ *         B = (float64) {{0.00005},{0.00999}} //Compulsory. Shared.
+ *         C = (float64) {{1.0, 0.0}} //Compulsory. Shared.
+ *         D = (float64) 0.0 //Optional. Default = zeros.
+ *         x0 = (float64) {{0.0, 0.0}, {0.1, 0.0}, {0.2, 0.0}} //Optional. Per instance or shared. Default = zeros.
+ *     }
+ * }
+ * </pre>
+ *
+ * All the signals shall be float64. The input signals, concatenated, shall
+ * have NumberOfInputs * NumberOfInstances elements, the element
+ * k * NumberOfInstances + n being the input k of the instance n (e.g. one
+ * signal per input, with one element per instance). The output signals
+ * follow the same layout with NumberOfOutputs.
+ *
+ * The states are set to x0 at every state change.
+ */
+class BatchStateSpaceGAM : public MARTe::GAM, public MARTe::StatefulI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BatchStateSpaceGAM();
+
+    /**
+     * @brief Destructor. Frees the matrices and the states.
+     */
+    virtual ~BatchStateSpaceGAM();
+
+    /**
+     * @brief Reads the dimensions and the matrices and stores them as
+     * structure of arrays.
+     * @param[in] data see GAM::Initialise.
+     * @return true if the dimensions are > 0 and the matrices are shared or
+     * per instance with consistent dimensions.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals against the dimensions.
+     * @return true if all the signals are float64 with the number of
+     * elements described in the class description.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Sets the states to x0.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Computes the outputs and advances the states of all the
+     * instances.
+     * @return true.
+     */
+    virtual bool Execute();
+
+private:
+    /**
+     * @brief Reads a matrix parameter and stores it as structure of arrays.
+     * @param[in] data the Parameters node.
+     * @param[in] name the parameter name.
+     * @param[in] numberOfRows the number of rows of the matrix of an
+     * instance.
+     * @param[in] numberOfColumns the number of columns of the matrix of an
+     * instance.
+     * @param[in] optional if true and the parameter does not exist the
+     * matrices are set to zero.
+     * @param[out] soa numberOfRows * numberOfColumns arrays of
+     * numberOfInstances elements, allocated with new[].
+     * @return true if the parameter is shared or per instance with the
+     * given dimensions.
+     */
+    bool ReadParameter(MARTe::StructuredDataI &data,
+                       const MARTe::char8 * const name,
+                       const MARTe::uint32 numberOfRows,
+                       const MARTe::uint32 numberOfColumns,
+                       const bool optional,
+                       MARTe::float64 *&soa) const;
+
+    /**
+     * @brief Computes out_i = sum_j M_ij .* in_j for all the instances.
+     * @param[out] out numberOfRows arrays of numberOfInstances elements.
+     * @param[in] matrix the matrix as structure of arrays.
+     * @param[in] in numberOfColumns arrays of numberOfInstances elements.
+     * @param[in] numberOfRows the number of rows of the matrix.
+     * @param[in] numberOfColumns the number of columns of the matrix.
+     */
+    void MultiplyAdd(MARTe::float64 * const out,
+                     const MARTe::float64 * const matrix,
+                     const MARTe::float64 * const in,
+                     const MARTe::uint32 numberOfRows,
+                     const MARTe::uint32 numberOfColumns) const;
+
+    /**
+     * The number of systems.
+     */
+    MARTe::uint32 numberOfInstances;
+
+    /**
+     * The number of states of each system.
+     */
+    MARTe::uint32 numberOfStates;
+
+    /**
+     * The number of inputs of each system.
+     */
+    MARTe::uint32 numberOfInputs;
+
+    /**
+     * The number of outputs of each system.
+     */
+    MARTe::uint32 numberOfOutputs;
+
+    /**
+     * False if D is not set (i.e. is zero).
+     */
+    bool hasFeedthrough;
+
+    /**
+     * A as structure of arrays.
+     */
+    MARTe::float64 *A;
+
+    /**
+     * B as structure of arrays.
+     */
+    MARTe::float64 *B;
+
+    /**
+     * C as structure of arrays.
+     */
+    MARTe::float64 *C;
+
+    /**
+     * D as structure of arrays.
+     */
+    MARTe::float64 *D;
+
+    /**
+     * The initial states as structure of arrays.
+     */
+    MARTe::float64 *x0;
+
+    /**
+     * The current states as structure of arrays.
+     */
+    MARTe::float64 *x;
+
+    /**
+     * The next states as structure of arrays.
+     */
+    MARTe::float64 *xNext;
+
+    /**
+     * The inputs (input memory).
+     */
+    MARTe::float64 *u;
+
+    /**
+     * The outputs (output memory).
+     */
+    MARTe::float64 *y;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_CONTROLGAMS_BATCHSTATESPACEGAM_H_ */
@@ -0,0 +1,107 @@
+/**
+ * @file ControlGAMsHelper.cpp
+ * @brief Source file for the ControlGAMsHelper functions
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the functions
+ * shared by the control GAMs.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ControlGAMsHelper.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+namespace ControlGAMsHelper {
+
+bool GetFloat64Elements(MARTe::GAM &gam, const MARTe::SignalDirection direction, MARTe::uint32 &numberOfElements) {
+    using namespace MARTe;
+    uint32 numberOfSignals = (direction == InputSignals) ? gam.GetNumberOfInputSignals() : gam.GetNumberOfOutputSignals();
+    bool ok = true;
+    numberOfElements = 0u;
+    uint32 i;
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        ok = (gam.GetSignalType(direction, i) == Float64Bit);
+        uint32 samples = 0u;
+        if (ok) {
+            ok = gam.GetSignalNumberOfSamples(direction, i, samples);
+        }
+        if (ok) {
+            ok = (samples == 1u);
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s: the signals shall be float64 with Samples = 1", gam.GetName());
+        }
+        uint32 elements = 0u;
+        if (ok) {
+            ok = gam.GetSignalNumberOfElements(direction, i, elements);
+        }
+        if (ok) {
+            numberOfElements += elements;
+        }
+    }
+    return ok;
+}
+
+bool ReadMatrix(MARTe::StructuredDataI &data, const MARTe::char8 * const name, MARTe::float64 *&values, MARTe::uint32 &numberOfRows,
+                MARTe::uint32 &numberOfColumns) {
+    using namespace MARTe;
+    AnyType matrixDescription = data.GetType(name);
+    bool ok = !matrixDescription.IsVoid();
+    uint8 numberOfDimensions = 0u;
+    if (ok) {
+        numberOfDimensions = matrixDescription.GetNumberOfDimensions();
+        numberOfColumns = matrixDescription.GetNumberOfElements(0u);
+        numberOfRows = (numberOfDimensions > 1u) ? matrixDescription.GetNumberOfElements(1u) : 1u;
+        ok = ((numberOfDimensions < 3u) && (numberOfColumns > 0u) && (numberOfRows > 0u));
+    }
+    if (ok) {
+        values = new float64[numberOfRows * numberOfColumns];
+        if (numberOfDimensions == 0u) {
+            ok = data.Read(name, values[0]);
+        }
+        else if (numberOfDimensions == 1u) {
+            Vector<float64> valuesVector(values, numberOfColumns);
+            ok = data.Read(name, valuesVector);
+        }
+        else {
+            Matrix<float64> valuesMatrix(values, numberOfRows, numberOfColumns);
+            ok = data.Read(name, valuesMatrix);
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s shall be specified as a float64 matrix", name);
+    }
+    return ok;
+}
+
+}
+}
@@ -0,0 +1,82 @@
+/**
+ * @file ControlGAMsHelper.h
+ * @brief Header file for the ControlGAMsHelper functions
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the functions
+ * shared by the control GAMs.
+ */
+
+#ifndef GAMS_CONTROLGAMS_CONTROLGAMSHELPER_H_
+#define GAMS_CONTROLGAMS_CONTROLGAMSHELPER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+namespace ControlGAMsHelper {
+
+/**
+ * @brief Verifies that all the signals of a GAM in a given direction are
+ * float64 with one sample and counts their elements.
+ * @details The signals of a GAM are contiguous in its memory, so that the
+ * signals can be accessed as a single float64 array of numberOfElements
+ * elements starting at GetInputSignalsMemory (or GetOutputSignalsMemory).
+ * @param[in] gam the GAM.
+ * @param[in] direction InputSignals or OutputSignals.
+ * @param[out] numberOfElements the sum of the elements of all the signals.
+ * @return true if all the signals are float64 with Samples = 1.
+ */
+bool GetFloat64Elements(MARTe::GAM &gam,
+                        const MARTe::SignalDirection direction,
+                        MARTe::uint32 &numberOfElements);
+
+/**
+ * @brief Reads a float64 matrix parameter, stored by rows.
+ * @details A scalar is read as a 1x1 matrix and a vector as a 1xn matrix.
+ * @param[in] data the configuration, pointing at the node which contains
+ * the parameter.
+ * @param[in] name the name of the parameter.
+ * @param[out] values the matrix, allocated with new[]. Shall be NULL.
+ * @param[out] numberOfRows the number of rows.
+ * @param[out] numberOfColumns the number of columns.
+ * @return true if the parameter exists and can be read as a float64
+ * matrix.
+ */
+bool ReadMatrix(MARTe::StructuredDataI &data,
+                const MARTe::char8 * const name,
+                MARTe::float64 *&values,
+                MARTe::uint32 &numberOfRows,
+                MARTe::uint32 &numberOfColumns);
+
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_CONTROLGAMS_CONTROLGAMSHELPER_H_ */
@@ -0,0 +1,99 @@
+/**
+ * @file ControlKernels.h
+ * @brief Header file for the control kernels
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the vectorised float64 kernels used by
+ * the control GAMs which process many instances at once. The instruction
+ * set is selected at compile time: AVX (when compiled with -mavx), SSE2
+ * (always available on x86-64) or NEON (armv8), with a portable fallback.
+ */
+
+#ifndef GAMS_CONTROLGAMS_CONTROLKERNELS_H_
+#define GAMS_CONTROLGAMS_CONTROLKERNELS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CONTROL_KERNELS_AVX
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define CONTROL_KERNELS_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CONTROL_KERNELS_NEON
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+namespace ControlKernels {
+
+/**
+ * @brief Computes y[i] += a[i] * b[i].
+ * @param[in,out] y the accumulator.
+ * @param[in] a the first array.
+ * @param[in] b the second array.
+ * @param[in] n the number of elements.
+ */
+inline void MultiplyAdd(MARTe::float64 * const y,
+                        const MARTe::float64 * const a,
+                        const MARTe::float64 * const b,
+                        const MARTe::uint32 n);
+
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+namespace ControlKernels {
+
+inline void MultiplyAdd(MARTe::float64 * const y, const MARTe::float64 * const a, const MARTe::float64 * const b, const MARTe::uint32 n) {
+    using namespace MARTe;
+    uint32 i = 0u;
+#if defined(CONTROL_KERNELS_AVX)
+    for (; (i + 4u) <= n; i += 4u) {
+        _mm256_storeu_pd(&y[i], _mm256_add_pd(_mm256_loadu_pd(&y[i]), _mm256_mul_pd(_mm256_loadu_pd(&a[i]), _mm256_loadu_pd(&b[i]))));
+    }
+#elif defined(CONTROL_KERNELS_SSE2)
+    for (; (i + 2u) <= n; i += 2u) {
+        _mm_storeu_pd(&y[i], _mm_add_pd(_mm_loadu_pd(&y[i]), _mm_mul_pd(_mm_loadu_pd(&a[i]), _mm_loadu_pd(&b[i]))));
+    }
+#elif defined(CONTROL_KERNELS_NEON)
+    for (; (i + 2u) <= n; i += 2u) {
+        vst1q_f64(&y[i], vfmaq_f64(vld1q_f64(&y[i]), vld1q_f64(&a[i]), vld1q_f64(&b[i])));
+    }
+#endif
+    for (; i < n; i++) {
+        y[i] += a[i] * b[i];
+    }
+}
+
+}
+}
+
+#endif /* GAMS_CONTROLGAMS_CONTROLKERNELS_H_ */
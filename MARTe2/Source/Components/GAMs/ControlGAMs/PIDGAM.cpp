@@ -0,0 +1,239 @@
+/**
+ * @file PIDGAM.cpp
+ * @brief Source file for class PIDGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PIDGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ControlGAMsHelper.h"
+#include "GlobalObjectsDatabase.h"
+#include "HotPathTrace.h"
+#include "MemoryOperationsHelper.h"
+#include "PIDGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+PIDGAM::PIDGAM() :
+        MARTe::GAM(),
+        MARTe::StatefulI(),
+        MARTe::MessageI() {
+    using namespace MARTe;
+    dt = 0.0;
+    numberOfChannels = 0u;
+    numberOfSamples = 1u;
+    errors = NULL_PTR(float64 *);
+    commands = NULL_PTR(float64 *);
+    integrals = NULL_PTR(float64 *);
+    previousErrors = NULL_PTR(float64 *);
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    (void) MessageI::InstallMessageFilter(filter);
+}
+
+PIDGAM::~PIDGAM() {
+    using namespace MARTe;
+    if (integrals != NULL_PTR(float64 *)) {
+        delete[] integrals;
+    }
+    if (previousErrors != NULL_PTR(float64 *)) {
+        delete[] previousErrors;
+    }
+}
+
+bool PIDGAM::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        if (!data.Read("NumberOfSamples", numberOfSamples)) {
+            numberOfSamples = 1u;
+        }
+        ok = (numberOfSamples > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfSamples shall be > 0");
+        }
+    }
+    if (ok) {
+        ok = data.MoveRelative("Parameters");
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Parameters shall be specified");
+        }
+    }
+    if (ok) {
+        PIDParameters initial;
+        float64 ki = 0.0;
+        float64 kd = 0.0;
+        ok = data.Read("Kp", initial.kp);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Kp shall be specified");
+        }
+        if (ok) {
+            ok = data.Read("dt", dt);
+            if (ok) {
+                ok = (dt > 0.0);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "dt shall be specified and shall be > 0");
+            }
+        }
+        if (ok) {
+            (void) data.Read("Ki", ki);
+            (void) data.Read("Kd", kd);
+            initial.kiDt = ki * dt;
+            initial.kdOverDt = kd / dt;
+            parameters.Reset(initial);
+        }
+        (void) data.MoveToAncestor(1u);
+    }
+    return ok;
+}
+
+bool PIDGAM::Setup() {
+    using namespace MARTe;
+    uint32 numberOfInputs = 0u;
+    uint32 numberOfOutputs = 0u;
+    bool ok = ControlGAMsHelper::GetFloat64Elements(*this, InputSignals, numberOfInputs);
+    if (ok) {
+        ok = ControlGAMsHelper::GetFloat64Elements(*this, OutputSignals, numberOfOutputs);
+    }
+    if (ok) {
+        ok = ((numberOfInputs > 0u) && (numberOfInputs == numberOfOutputs) && ((numberOfInputs % numberOfSamples) == 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError,
+                         "The number of input and output elements shall be the same, > 0 and a multiple of NumberOfSamples (%d)", numberOfSamples);
+        }
+    }
+    if (ok) {
+        numberOfChannels = numberOfInputs / numberOfSamples;
+    }
+    if (ok) {
+        errors = static_cast<float64 *>(GetInputSignalsMemory());
+        commands = static_cast<float64 *>(GetOutputSignalsMemory());
+        integrals = new float64[numberOfChannels];
+        previousErrors = new float64[numberOfChannels];
+        ok = PrepareNextState("", "");
+    }
+    return ok;
+}
+
+bool PIDGAM::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    uint32 size = static_cast<uint32>(numberOfChannels * sizeof(float64));
+    bool ok = MemoryOperationsHelper::Set(integrals, '\0', size);
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(previousErrors, '\0', size);
+    }
+    return ok;
+}
+
+bool PIDGAM::Execute() {
+    using namespace MARTe;
+    HOT_PATH_TRACE_BEGIN("PIDGAM::Execute");
+    const PIDParameters &gains = parameters.Acquire();
+    uint32 s;
+    for (s = 0u; s < numberOfSamples; s++) {
+        const float64 * const e = &errors[s * numberOfChannels];
+        float64 * const u = &commands[s * numberOfChannels];
+        uint32 i;
+        for (i = 0u; i < numberOfChannels; i++) {
+            u[i] = (gains.kp * e[i]) + integrals[i] + (gains.kdOverDt * (e[i] - previousErrors[i]));
+            integrals[i] += gains.kiDt * e[i];
+            previousErrors[i] = e[i];
+        }
+    }
+    HOT_PATH_TRACE_END("PIDGAM::Execute");
+    return true;
+}
+
+void PIDGAM::Purge(MARTe::ReferenceContainer &purgeList) {
+    RemoveMessageFilter(filter);
+    GAM::Purge(purgeList);
+}
+
+MARTe::ErrorManagement::ErrorType PIDGAM::SetParameters(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    float64 kp = 0.0;
+    float64 ki = 0.0;
+    float64 kd = 0.0;
+    bool hasKp = data.Read("Kp", kp);
+    bool hasKi = data.Read("Ki", ki);
+    bool hasKd = data.Read("Kd", kd);
+    ErrorManagement::ErrorType err;
+    err.parametersError = !((hasKp) || (hasKi) || (hasKd));
+    if (err.ErrorsCleared()) {
+        PIDParameters &next = parameters.BeginUpdate();
+        if (hasKp) {
+            next.kp = kp;
+        }
+        if (hasKi) {
+            next.kiDt = ki * dt;
+        }
+        if (hasKd) {
+            next.kdOverDt = kd / dt;
+        }
+        parameters.EndUpdate(true);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "At least one of Kp, Ki and Kd shall be specified");
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType PIDGAM::SetParameter(MARTe::StreamString name, MARTe::float64 value) {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    if ((name == "Kp") || (name == "Ki") || (name == "Kd")) {
+        PIDParameters &next = parameters.BeginUpdate();
+        if (name == "Kp") {
+            next.kp = value;
+        }
+        else if (name == "Ki") {
+            next.kiDt = value * dt;
+        }
+        else {
+            next.kdOverDt = value / dt;
+        }
+        parameters.EndUpdate(true);
+    }
+    else {
+        err.parametersError = true;
+        REPORT_ERROR(ErrorManagement::ParametersError, "Unknown gain %s. Shall be Kp, Ki or Kd", name.Buffer());
+    }
+    return err;
+}
+
+CLASS_REGISTER(PIDGAM, "")
+CLASS_METHOD_REGISTER(PIDGAM, SetParameters)
+CLASS_METHOD_REGISTER(PIDGAM, SetParameter)
+} // namespace MARTe2Tutorial
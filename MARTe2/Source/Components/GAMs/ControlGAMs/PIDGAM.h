@@ -0,0 +1,264 @@
+/**
+ * @file PIDGAM.h
+ * @brief Header file for class PIDGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * PIDGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_CONTROLGAMS_PIDGAM_H_
+#define GAMS_CONTROLGAMS_PIDGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "MessageI.h"
+#include "ParameterBuffer.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "StatefulI.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief The gains of a PIDGAM, pre-scaled by the sampling period.
+ */
+struct PIDParameters {
+    /**
+     * Proportional gain.
+     */
+    MARTe::float64 kp;
+
+    /**
+     * Integral gain multiplied by dt.
+     */
+    MARTe::float64 kiDt;
+
+    /**
+     * Derivative gain divided by dt.
+     */
+    MARTe::float64 kdOverDt;
+};
+
+/**
+ * @brief Discrete PID controller compiled in the framework, equivalent to
+ * the PID model executed by the SimulinkWrapperGAM.
+ *
+ * @details For each error sample e[k]:
+ * u[k] = Kp e[k] + I[k] + Kd (e[k] - e[k-1]) / dt
+ * I[k+1] = I[k] + Ki dt e[k]
+ * i.e. a parallel PID with a forward Euler integrator and a backward
+ * difference derivative. The integrator and the previous error are
+ * cleared at every state change.
+ *
+ * Every input element is an independent error channel (with the same
+ * gains) and the output element with the same index receives its command,
+ * so that many loops can be closed by a single GAM.
+ *
+ * With NumberOfSamples = N > 1 the GAM processes a block of N consecutive
+ * samples of every channel in each cycle (e.g. a 10 kHz loop executed by a
+ * 1 kHz thread with N = 10, dt being the period of the samples), so that
+ * the cost of the scheduler is paid once per block. The input elements are
+ * then the N samples one after the other, each with all the channels (i.e.
+ * the element s * numberOfChannels + c is the sample s of the channel c)
+ * and the outputs are written likewise. Gain updates are applied at the
+ * block boundaries.
+ *
+ * The parameters are read from the Parameters node, as for the
+ * SimulinkWrapperGAM, so that the two classes can be swapped in a
+ * configuration. The configuration syntax is (names are only given as an
+ * example):
+ * <pre>
+ * +GAMPID = {
+ *     Class = PIDGAM
+ *     NumberOfSamples = 1 //Optional. Default = 1. Number of samples of each channel processed in each cycle.
+ *     InputSignals = {
+ *         e = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         u = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *         }
+ *     }
+ *     Parameters = {
+ *         Kp = (float64) 10.93 //Compulsory.
+ *         Ki = (float64) 2.88 //Optional. Default = 0.
+ *         Kd = (float64) 4.29 //Optional. Default = 0.
+ *         dt = (float64) 0.01 //Compulsory. Sampling period in seconds.
+ *     }
+ * }
+ * </pre>
+ *
+ * All the signals shall be float64 and the total number of input and output
+ * elements shall be the same.
+ *
+ * The gains Kp, Ki and Kd can be changed online, without a state change,
+ * by sending a Message to the GAM (e.g. through the TCPSocketMessageProxy):
+ * <pre>
+ * +UpdateGainsMsg = {
+ *     Class = Message
+ *     Destination = RTApp.Functions.GAMPID
+ *     Function = SetParameters
+ *     Mode = ExpectsReply
+ *     +Parameters = {
+ *         Class = ConfigurationDatabase
+ *         Kp = 12.0 //At least one of Kp, Ki and Kd shall be set.
+ *         Ki = 3.0
+ *     }
+ * }
+ * </pre>
+ * or, one gain at a time, by an OPCUAVariable named as the gain, with the
+ * Event PVValue = ParameterName and Function = SetParameter.
+ *
+ * The new gains are written to the shadow block of a ParameterBuffer and
+ * take effect at the beginning of the next cycle, all at once. The
+ * real-time thread never blocks on an update. The integrators keep their
+ * value, so that a change of Ki does not cause a bump in the command.
+ */
+class PIDGAM : public MARTe::GAM, public MARTe::StatefulI, public MARTe::MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the filter of the registered methods.
+     */
+    PIDGAM();
+
+    /**
+     * @brief Destructor. Frees the state.
+     */
+    virtual ~PIDGAM();
+
+    /**
+     * @brief Reads NumberOfSamples and the gains from the Parameters node.
+     * @param[in] data see GAM::Initialise.
+     * @return true if NumberOfSamples > 0 and Kp and dt are set and dt > 0.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals and allocates the state of each channel.
+     * @return true if all the signals are float64 and the number of input
+     * and output elements is the same and a multiple of NumberOfSamples.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Clears the integrators and the previous errors.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Applies any pending update of the gains and computes the
+     * command of every channel.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Removes the message filter.
+     * @param[in] purgeList see ReferenceContainer::Purge.
+     */
+    virtual void Purge(MARTe::ReferenceContainer &purgeList);
+
+    /**
+     * @brief Updates one or more gains.
+     * @details Registered with CLASS_METHOD_REGISTER.
+     * @param[in] data holds the new Kp, Ki and/or Kd.
+     * @return ErrorManagement::NoError if at least one of the gains is set.
+     */
+    MARTe::ErrorManagement::ErrorType SetParameters(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Updates a gain.
+     * @details Registered with CLASS_METHOD_REGISTER. Matches the Message
+     * sent by an OPCUAVariable with PVValue = ParameterName.
+     * @param[in] name Kp, Ki or Kd.
+     * @param[in] value the new gain.
+     * @return ErrorManagement::NoError if the name is a gain.
+     */
+    MARTe::ErrorManagement::ErrorType SetParameter(MARTe::StreamString name,
+                                                   MARTe::float64 value);
+
+private:
+    /**
+     * The gains, updated by the messages and read by Execute.
+     */
+    ParameterBuffer<PIDParameters> parameters;
+
+    /**
+     * The sampling period.
+     */
+    MARTe::float64 dt;
+
+    /**
+     * Filter of the registered methods.
+     */
+    MARTe::ReferenceT<MARTe::RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * The number of channels.
+     */
+    MARTe::uint32 numberOfChannels;
+
+    /**
+     * The number of samples of each channel processed in each cycle.
+     */
+    MARTe::uint32 numberOfSamples;
+
+    /**
+     * The errors (input memory).
+     */
+    MARTe::float64 *errors;
+
+    /**
+     * The commands (output memory).
+     */
+    MARTe::float64 *commands;
+
+    /**
+     * The integrator of each channel.
+     */
+    MARTe::float64 *integrals;
+
+    /**
+     * The error of each channel in the previous cycle.
+     */
+    MARTe::float64 *previousErrors;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_CONTROLGAMS_PIDGAM_H_ */
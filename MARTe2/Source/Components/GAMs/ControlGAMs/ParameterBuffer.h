@@ -0,0 +1,230 @@
+/**
+ * @file ParameterBuffer.h
+ * @brief Header file for class ParameterBuffer
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * ParameterBuffer with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_CONTROLGAMS_PARAMETERBUFFER_H_
+#define GAMS_CONTROLGAMS_PARAMETERBUFFER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Double-buffered parameter block shared between a real-time thread,
+ * which reads the parameters every cycle, and any number of non real-time
+ * threads, which update them.
+ *
+ * @details The real-time thread reads the active block, while the updates
+ * are written in the shadow block. An update is published by marking the
+ * shadow block as pending and the real-time thread swaps the two blocks on
+ * its next call to Acquire (i.e. at the next cycle boundary), so that a
+ * cycle always sees a consistent set of parameters.
+ *
+ * The real-time side is wait-free: Acquire is an atomic compare-and-swap
+ * and never blocks. Updates are serialised among themselves by the same
+ * state word. An update published before the previous one was applied
+ * replaces it (the shadow block is edited in place).
+ *
+ * Usage (non real-time side):
+ * <pre>
+ * ParametersT &next = buffer.BeginUpdate(); //Holds the latest parameters.
+ * next.gain = 2.0;
+ * buffer.EndUpdate(true);
+ * </pre>
+ * and (real-time side, once per cycle):
+ * <pre>
+ * const ParametersT &parameters = buffer.Acquire();
+ * </pre>
+ *
+ * ParametersT shall be copy assignable.
+ */
+template<typename ParametersT>
+class ParameterBuffer {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ParameterBuffer();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~ParameterBuffer();
+
+    /**
+     * @brief Sets both blocks and discards any pending update.
+     * @param[in] initial the parameters.
+     * @warning Not thread safe. To be called before the real-time thread
+     * starts.
+     */
+    void Reset(const ParametersT &initial);
+
+    /**
+     * @brief Swaps to the pending block, if any, and returns the active
+     * block. Called by the real-time thread at the beginning of each cycle.
+     * @return the parameters to be used until the next call.
+     */
+    inline const ParametersT &Acquire();
+
+    /**
+     * @brief Starts an update.
+     * @details Waits (sleeping) for any other update in progress or any
+     * swap being performed by the real-time thread, which are both short.
+     * @return the shadow block, holding the latest parameters (either
+     * those of the pending update or those of the active block).
+     */
+    ParametersT &BeginUpdate();
+
+    /**
+     * @brief Ends an update.
+     * @param[in] commit if true the shadow block is published and will be
+     * swapped at the next cycle. If false the update is discarded, and the
+     * shadow block shall not have been changed.
+     */
+    void EndUpdate(const bool commit);
+
+private:
+    /**
+     * No update in progress or pending.
+     */
+    static const MARTe::uint32 IDLE = 0u;
+
+    /**
+     * The shadow block is pending to be swapped.
+     */
+    static const MARTe::uint32 PENDING = 1u;
+
+    /**
+     * An update is being written in the shadow block.
+     */
+    static const MARTe::uint32 WRITING = 2u;
+
+    /**
+     * The real-time thread is swapping the blocks.
+     */
+    static const MARTe::uint32 SWAPPING = 3u;
+
+    /**
+     * The two blocks.
+     */
+    ParametersT blocks[2];
+
+    /**
+     * Index of the active block. Only changed by the real-time thread.
+     */
+    MARTe::uint32 active;
+
+    /**
+     * IDLE, PENDING, WRITING or SWAPPING.
+     */
+    volatile MARTe::uint32 state;
+
+    /**
+     * The state before the update in progress.
+     */
+    MARTe::uint32 stateBeforeUpdate;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+template<typename ParametersT>
+ParameterBuffer<ParametersT>::ParameterBuffer() {
+    active = 0u;
+    state = IDLE;
+    stateBeforeUpdate = IDLE;
+}
+
+template<typename ParametersT>
+ParameterBuffer<ParametersT>::~ParameterBuffer() {
+}
+
+template<typename ParametersT>
+void ParameterBuffer<ParametersT>::Reset(const ParametersT &initial) {
+    blocks[0u] = initial;
+    blocks[1u] = initial;
+    active = 0u;
+    __atomic_store_n(&state, IDLE, __ATOMIC_RELEASE);
+}
+
+template<typename ParametersT>
+inline const ParametersT &ParameterBuffer<ParametersT>::Acquire() {
+    using namespace MARTe;
+    uint32 expected = PENDING;
+    if (__atomic_compare_exchange_n(&state, &expected, SWAPPING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        active = 1u - active;
+        __atomic_store_n(&state, IDLE, __ATOMIC_RELEASE);
+    }
+    return blocks[active];
+}
+
+template<typename ParametersT>
+ParametersT &ParameterBuffer<ParametersT>::BeginUpdate() {
+    using namespace MARTe;
+    bool acquired = false;
+    while (!acquired) {
+        uint32 expected = __atomic_load_n(&state, __ATOMIC_ACQUIRE);
+        if ((expected == IDLE) || (expected == PENDING)) {
+            acquired = __atomic_compare_exchange_n(&state, &expected, WRITING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+            if (acquired) {
+                stateBeforeUpdate = expected;
+            }
+        }
+        if (!acquired) {
+            Sleep::MSec(1u);
+        }
+    }
+    uint32 shadow = 1u - active;
+    if (stateBeforeUpdate == IDLE) {
+        blocks[shadow] = blocks[active];
+    }
+    return blocks[shadow];
+}
+
+template<typename ParametersT>
+void ParameterBuffer<ParametersT>::EndUpdate(const bool commit) {
+    if (commit) {
+        __atomic_store_n(&state, PENDING, __ATOMIC_RELEASE);
+    }
+    else {
+        __atomic_store_n(&state, stateBeforeUpdate, __ATOMIC_RELEASE);
+    }
+}
+
+}
+
+#endif /* GAMS_CONTROLGAMS_PARAMETERBUFFER_H_ */
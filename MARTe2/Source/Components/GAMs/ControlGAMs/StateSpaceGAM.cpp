@@ -0,0 +1,270 @@
+/**
+ * @file StateSpaceGAM.cpp
+ * @brief Source file for class StateSpaceGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StateSpaceGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ControlGAMsHelper.h"
+#include "HotPathTrace.h"
+#include "MemoryOperationsHelper.h"
+#include "StateSpaceGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+StateSpaceGAM::StateSpaceGAM() :
+        MARTe::GAM(),
+        MARTe::StatefulI() {
+    using namespace MARTe;
+    parameters.A = NULL_PTR(float64 *);
+    parameters.B = NULL_PTR(float64 *);
+    parameters.C = NULL_PTR(float64 *);
+    parameters.D = NULL_PTR(float64 *);
+    x0 = NULL_PTR(float64 *);
+    x = NULL_PTR(float64 *);
+    xNext = NULL_PTR(float64 *);
+    numberOfStates = 0u;
+    numberOfInputs = 0u;
+    numberOfOutputs = 0u;
+    numberOfSamples = 1u;
+    u = NULL_PTR(float64 *);
+    y = NULL_PTR(float64 *);
+}
+
+StateSpaceGAM::~StateSpaceGAM() {
+    using namespace MARTe;
+    if (parameters.A != NULL_PTR(float64 *)) {
+        delete[] parameters.A;
+    }
+    if (parameters.B != NULL_PTR(float64 *)) {
+        delete[] parameters.B;
+    }
+    if (parameters.C != NULL_PTR(float64 *)) {
+        delete[] parameters.C;
+    }
+    if (parameters.D != NULL_PTR(float64 *)) {
+        delete[] parameters.D;
+    }
+    if (x0 != NULL_PTR(float64 *)) {
+        delete[] x0;
+    }
+    if (x != NULL_PTR(float64 *)) {
+        delete[] x;
+    }
+    if (xNext != NULL_PTR(float64 *)) {
+        delete[] xNext;
+    }
+}
+
+bool StateSpaceGAM::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        if (!data.Read("NumberOfSamples", numberOfSamples)) {
+            numberOfSamples = 1u;
+        }
+        ok = (numberOfSamples > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfSamples shall be > 0");
+        }
+    }
+    if (ok) {
+        ok = data.MoveRelative("Parameters");
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Parameters shall be specified");
+        }
+    }
+    if (ok) {
+        uint32 rows = 0u;
+        uint32 columns = 0u;
+        ok = ControlGAMsHelper::ReadMatrix(data, "A", parameters.A, numberOfStates, columns);
+        if (ok) {
+            ok = (columns == numberOfStates);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "A shall be square");
+            }
+        }
+        if (ok) {
+            ok = ControlGAMsHelper::ReadMatrix(data, "B", parameters.B, rows, numberOfInputs);
+        }
+        if (ok) {
+            ok = (rows == numberOfStates);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "B shall have %d rows", numberOfStates);
+            }
+        }
+        if (ok) {
+            ok = ControlGAMsHelper::ReadMatrix(data, "C", parameters.C, numberOfOutputs, columns);
+        }
+        if (ok) {
+            ok = (columns == numberOfStates);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "C shall have %d columns", numberOfStates);
+            }
+        }
+        if (ok) {
+            if (data.GetType("D").IsVoid()) {
+                parameters.D = new float64[numberOfOutputs * numberOfInputs];
+                ok = MemoryOperationsHelper::Set(parameters.D, '\0', static_cast<uint32>(numberOfOutputs * numberOfInputs * sizeof(float64)));
+            }
+            else {
+                ok = ControlGAMsHelper::ReadMatrix(data, "D", parameters.D, rows, columns);
+                if (ok) {
+                    ok = ((rows == numberOfOutputs) && (columns == numberOfInputs));
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "D shall be a %d x %d matrix", numberOfOutputs, numberOfInputs);
+                    }
+                }
+            }
+        }
+        if (ok) {
+            if (data.GetType("x0").IsVoid()) {
+                x0 = new float64[numberOfStates];
+                ok = MemoryOperationsHelper::Set(x0, '\0', static_cast<uint32>(numberOfStates * sizeof(float64)));
+            }
+            else {
+                ok = ControlGAMsHelper::ReadMatrix(data, "x0", x0, rows, columns);
+                if (ok) {
+                    ok = ((rows * columns) == numberOfStates);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "x0 shall have %d elements", numberOfStates);
+                    }
+                }
+            }
+        }
+        (void) data.MoveToAncestor(1u);
+    }
+    return ok;
+}
+
+bool StateSpaceGAM::Setup() {
+    using namespace MARTe;
+    uint32 inputElements = 0u;
+    uint32 outputElements = 0u;
+    bool ok = ControlGAMsHelper::GetFloat64Elements(*this, InputSignals, inputElements);
+    if (ok) {
+        ok = ControlGAMsHelper::GetFloat64Elements(*this, OutputSignals, outputElements);
+    }
+    if (ok) {
+        ok = (inputElements == (numberOfInputs * numberOfSamples));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The input signals shall have %d elements in total", numberOfInputs * numberOfSamples);
+        }
+    }
+    if (ok) {
+        ok = (outputElements == (numberOfOutputs * numberOfSamples));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The output signals shall have %d elements in total", numberOfOutputs * numberOfSamples);
+        }
+    }
+    if (ok) {
+        u = static_cast<float64 *>(GetInputSignalsMemory());
+        y = static_cast<float64 *>(GetOutputSignalsMemory());
+        x = new float64[numberOfStates];
+        xNext = new float64[numberOfStates];
+        ok = PrepareNextState("", "");
+    }
+    return ok;
+}
+
+bool StateSpaceGAM::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    using namespace MARTe;
+    return MemoryOperationsHelper::Copy(x, x0, static_cast<uint32>(numberOfStates * sizeof(float64)));
+}
+
+void StateSpaceGAM::StepGeneric(const MARTe::float64 * const in, MARTe::float64 * const out) {
+    using namespace MARTe;
+    const float64 * const A = parameters.A;
+    const float64 * const B = parameters.B;
+    const float64 * const C = parameters.C;
+    const float64 * const D = parameters.D;
+    uint32 i;
+    uint32 j;
+    for (i = 0u; i < numberOfOutputs; i++) {
+        float64 value = 0.0;
+        for (j = 0u; j < numberOfStates; j++) {
+            value += C[(i * numberOfStates) + j] * x[j];
+        }
+        for (j = 0u; j < numberOfInputs; j++) {
+            value += D[(i * numberOfInputs) + j] * in[j];
+        }
+        out[i] = value;
+    }
+    for (i = 0u; i < numberOfStates; i++) {
+        float64 value = 0.0;
+        for (j = 0u; j < numberOfStates; j++) {
+            value += A[(i * numberOfStates) + j] * x[j];
+        }
+        for (j = 0u; j < numberOfInputs; j++) {
+            value += B[(i * numberOfInputs) + j] * in[j];
+        }
+        xNext[i] = value;
+    }
+    float64 *swap = x;
+    x = xNext;
+    xNext = swap;
+}
+
+bool StateSpaceGAM::Execute() {
+    using namespace MARTe;
+    HOT_PATH_TRACE_BEGIN("StateSpaceGAM::Execute");
+    uint32 s;
+    for (s = 0u; s < numberOfSamples; s++) {
+        const float64 * const in = &u[s * numberOfInputs];
+        float64 * const out = &y[s * numberOfOutputs];
+        switch (numberOfStates) {
+        case 1u:
+            Step<1u>(in, out);
+            break;
+        case 2u:
+            Step<2u>(in, out);
+            break;
+        case 3u:
+            Step<3u>(in, out);
+            break;
+        case 4u:
+            Step<4u>(in, out);
+            break;
+        default:
+            StepGeneric(in, out);
+            break;
+        }
+    }
+    HOT_PATH_TRACE_END("StateSpaceGAM::Execute");
+    return true;
+}
+
+CLASS_REGISTER(StateSpaceGAM, "")
+} // namespace MARTe2Tutorial
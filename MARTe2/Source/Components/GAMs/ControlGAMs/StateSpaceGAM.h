@@ -0,0 +1,282 @@
+/**
+ * @file StateSpaceGAM.h
+ * @brief Header file for class StateSpaceGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * StateSpaceGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_CONTROLGAMS_STATESPACEGAM_H_
+#define GAMS_CONTROLGAMS_STATESPACEGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "StatefulI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief The matrices of a StateSpaceGAM, stored by rows.
+ */
+struct StateSpaceParameters {
+    /**
+     * The state matrix (numberOfStates x numberOfStates).
+     */
+    MARTe::float64 *A;
+
+    /**
+     * The input matrix (numberOfStates x numberOfInputs).
+     */
+    MARTe::float64 *B;
+
+    /**
+     * The output matrix (numberOfOutputs x numberOfStates).
+     */
+    MARTe::float64 *C;
+
+    /**
+     * The feedthrough matrix (numberOfOutputs x numberOfInputs).
+     */
+    MARTe::float64 *D;
+};
+
+/**
+ * @brief Discrete-time state-space system compiled in the framework,
+ * equivalent to the StateSpace model executed by the SimulinkWrapperGAM.
+ *
+ * @details At every cycle:
+ * y[k] = C x[k] + D u[k]
+ * x[k+1] = A x[k] + B u[k]
+ * The state is set to x0 at every state change.
+ *
+ * Systems with up to 4 states are computed by a version of the step
+ * specialised on the number of states, whose loops are fully unrolled by
+ * the compiler; larger systems use a generic version. The selection is a switch on a value which does not
+ * change after Setup, so that there are no indirect calls in the real-time
+ * cycle.
+ *
+ * The parameters are read from the Parameters node, as for the
+ * SimulinkWrapperGAM, so that the two classes can be swapped in a
+ * configuration. The configuration syntax is (names are only given as an
+ * example):
+ * <pre>
+ * +GAMPlant = {
+ *     Class = StateSpaceGAM
+ *     NumberOfSamples = 1 //Optional. Default = 1. Number of samples processed in each cycle.
+ *     InputSignals = {
+ *         u = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         y = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *         }
+ *     }
+ *     Parameters = {
+ *         A = (float64) {{0.99995, 0.00999},{-0.00999, 0.99795}} //Compulsory.
+ *         B = (float64) {{0.00005},{0.00999}} //Compulsory.
+ *         C = (float64) {{1.0, 0.0}} //Compulsory.
+ *         D = (float64) 0.0 //Optional. Default = zeros.
+ *         x0 = (float64) {{0.0}, {0.0}} //Optional. Default = zeros.
+ *         dt = (float64) 0.01 //Optional. Ignored, A and B are already discrete.
+ *     }
+ * }
+ * </pre>
+ *
+ * All the signals shall be float64. The input signals, concatenated, form
+ * u (as many elements as the columns of B) and the output signals,
+ * concatenated, form y (as many elements as the rows of C).
+ *
+ * With NumberOfSamples = N > 1 the GAM processes a block of N consecutive
+ * samples in each cycle (e.g. a 10 kHz system executed by a 1 kHz thread
+ * with N = 10), so that the cost of the scheduler is paid once per block.
+ * The input signals, concatenated, shall then hold the N input vectors one
+ * after the other (i.e. u of the sample s starts at the element
+ * s * columns of B) and the outputs are written likewise.
+ */
+class StateSpaceGAM : public MARTe::GAM, public MARTe::StatefulI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    StateSpaceGAM();
+
+    /**
+     * @brief Destructor. Frees the matrices and the state.
+     */
+    virtual ~StateSpaceGAM();
+
+    /**
+     * @brief Reads the matrices from the Parameters node.
+     * @param[in] data see GAM::Initialise.
+     * @return true if the matrices are specified and their dimensions are
+     * consistent.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals against the dimensions of the matrices.
+     * @return true if all the signals are float64 and the number of input
+     * (output) elements is NumberOfSamples times the number of columns of B
+     * (rows of C).
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Sets the state to x0.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Computes the output and advances the state, for each sample
+     * of the block.
+     * @return true.
+     */
+    virtual bool Execute();
+
+private:
+    /**
+     * @brief Step specialised on the number of states.
+     * @tparam numberOfStatesT shall be equal to numberOfStates.
+     * @param[in] in the input vector.
+     * @param[out] out the output vector.
+     */
+    template<MARTe::uint32 numberOfStatesT>
+    inline void Step(const MARTe::float64 * const in,
+                     MARTe::float64 * const out);
+
+    /**
+     * @brief Step for any number of states.
+     * @param[in] in the input vector.
+     * @param[out] out the output vector.
+     */
+    void StepGeneric(const MARTe::float64 * const in,
+                     MARTe::float64 * const out);
+
+    /**
+     * The matrices.
+     */
+    StateSpaceParameters parameters;
+
+    /**
+     * The initial state.
+     */
+    MARTe::float64 *x0;
+
+    /**
+     * The current state.
+     */
+    MARTe::float64 *x;
+
+    /**
+     * The next state (used by StepGeneric).
+     */
+    MARTe::float64 *xNext;
+
+    /**
+     * The number of states.
+     */
+    MARTe::uint32 numberOfStates;
+
+    /**
+     * The number of inputs.
+     */
+    MARTe::uint32 numberOfInputs;
+
+    /**
+     * The number of outputs.
+     */
+    MARTe::uint32 numberOfOutputs;
+
+    /**
+     * The number of samples processed in each cycle.
+     */
+    MARTe::uint32 numberOfSamples;
+
+    /**
+     * The inputs (input memory).
+     */
+    MARTe::float64 *u;
+
+    /**
+     * The outputs (output memory).
+     */
+    MARTe::float64 *y;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+template<MARTe::uint32 numberOfStatesT>
+inline void StateSpaceGAM::Step(const MARTe::float64 * const in, MARTe::float64 * const out) {
+    using namespace MARTe;
+    const float64 * const A = parameters.A;
+    const float64 * const B = parameters.B;
+    const float64 * const C = parameters.C;
+    const float64 * const D = parameters.D;
+    float64 next[numberOfStatesT];
+    uint32 i;
+    uint32 j;
+    for (i = 0u; i < numberOfOutputs; i++) {
+        float64 value = 0.0;
+        for (j = 0u; j < numberOfStatesT; j++) {
+            value += C[(i * numberOfStatesT) + j] * x[j];
+        }
+        for (j = 0u; j < numberOfInputs; j++) {
+            value += D[(i * numberOfInputs) + j] * in[j];
+        }
+        out[i] = value;
+    }
+    for (i = 0u; i < numberOfStatesT; i++) {
+        float64 value = 0.0;
+        for (j = 0u; j < numberOfStatesT; j++) {
+            value += A[(i * numberOfStatesT) + j] * x[j];
+        }
+        for (j = 0u; j < numberOfInputs; j++) {
+            value += B[(i * numberOfInputs) + j] * in[j];
+        }
+        next[i] = value;
+    }
+    for (i = 0u; i < numberOfStatesT; i++) {
+        x[i] = next[i];
+    }
+}
+
+}
+
+#endif /* GAMS_CONTROLGAMS_STATESPACEGAM_H_ */
@@ -0,0 +1,99 @@
+/**
+ * @file DecimatorGAM.cpp
+ * @brief Source file for class DecimatorGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DecimatorGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "DecimatorGAM.h"
+#include "SignalProcessingKernels.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+DecimatorGAM::DecimatorGAM() :
+        FIRFilterGAM() {
+    factor = 0u;
+}
+
+DecimatorGAM::~DecimatorGAM() {
+}
+
+bool DecimatorGAM::ReadCoefficients(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = data.Read("Factor", factor);
+    if (ok) {
+        ok = (factor > 0u);
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Factor shall be specified and shall be > 0");
+    }
+    if (ok) {
+        if (data.GetType("Coefficients").IsVoid()) {
+            numberOfCoefficients = factor;
+            coefficients = new float32[numberOfCoefficients];
+            uint32 k;
+            for (k = 0u; k < numberOfCoefficients; k++) {
+                coefficients[k] = 1.0F / static_cast<float32>(factor);
+            }
+        }
+        else {
+            ok = FIRFilterGAM::ReadCoefficients(data);
+        }
+    }
+    return ok;
+}
+
+bool DecimatorGAM::GetOutputElements(const MARTe::uint32 inputElements, MARTe::uint32 &outputElements) const {
+    outputElements = inputElements / factor;
+    return ((outputElements > 0u) && ((inputElements % factor) == 0u));
+}
+
+bool DecimatorGAM::Execute() {
+    using namespace MARTe;
+    uint32 c;
+    for (c = 0u; c < numberOfChannels; c++) {
+        float32 *window = LoadChannel(c);
+        float32 *output = outputs[c];
+        uint32 m;
+        for (m = 0u; m < numberOfOutputElements; m++) {
+            output[m] = SignalProcessingKernels::Dot(reversedCoefficients, &window[((m + 1u) * factor) - 1u], numberOfCoefficients);
+        }
+        StoreChannel(window);
+    }
+    return true;
+}
+
+CLASS_REGISTER(DecimatorGAM, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,119 @@
+/**
+ * @file DecimatorGAM.h
+ * @brief Header file for class DecimatorGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * DecimatorGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_SIGNALPROCESSINGGAMS_DECIMATORGAM_H_
+#define GAMS_SIGNALPROCESSINGGAMS_DECIMATORGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FIRFilterGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Anti-aliasing FIR filter followed by a down-sampling of Factor.
+ *
+ * @details Only the retained samples are computed: the output element m is
+ * the filter output at the input element (m + 1) * Factor - 1. When no
+ * Coefficients are given the filter is the average of the last Factor
+ * samples (i.e. each output is the mean of a block of Factor inputs).
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Decimate = {
+ *     Class = DecimatorGAM
+ *     Factor = 10 //Compulsory. The input elements shall be a multiple of Factor.
+ *     Coefficients = {0.1 0.2 0.4 0.2 0.1} //Optional. Default = Factor coefficients equal to 1 / Factor.
+ *     InputSignals = {
+ *         Channel0 = {
+ *             DataSource = ADC
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Channel0D = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 10
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class DecimatorGAM : public FIRFilterGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    DecimatorGAM();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~DecimatorGAM();
+
+    /**
+     * @brief Filters and decimates every channel.
+     * @return true.
+     */
+    virtual bool Execute();
+
+protected:
+    /**
+     * @brief Reads Factor and the optional Coefficients.
+     * @param[in] data the GAM configuration.
+     * @return true if Factor > 0 and the Coefficients (if set) are valid.
+     */
+    virtual bool ReadCoefficients(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief The output has inputElements / Factor elements.
+     * @return true if inputElements is a multiple of Factor.
+     */
+    virtual bool GetOutputElements(const MARTe::uint32 inputElements,
+                                   MARTe::uint32 &outputElements) const;
+
+private:
+    /**
+     * The decimation factor.
+     */
+    MARTe::uint32 factor;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_SIGNALPROCESSINGGAMS_DECIMATORGAM_H_ */
@@ -0,0 +1,134 @@
+/**
+ * @file FIRFilterGAM.cpp
+ * @brief Source file for class FIRFilterGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FIRFilterGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "FIRFilterGAM.h"
+#include "MemoryOperationsHelper.h"
+#include "SignalProcessingKernels.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+FIRFilterGAM::FIRFilterGAM() :
+        SignalProcessingGAM() {
+    using namespace MARTe;
+    coefficients = NULL_PTR(float32 *);
+    reversedCoefficients = NULL_PTR(float32 *);
+    numberOfCoefficients = 0u;
+    windows = NULL_PTR(float32 *);
+    windowSize = 0u;
+}
+
+FIRFilterGAM::~FIRFilterGAM() {
+    using namespace MARTe;
+    if (coefficients != NULL_PTR(float32 *)) {
+        delete[] coefficients;
+    }
+    if (reversedCoefficients != NULL_PTR(float32 *)) {
+        delete[] reversedCoefficients;
+    }
+    if (windows != NULL_PTR(float32 *)) {
+        delete[] windows;
+    }
+}
+
+bool FIRFilterGAM::Initialise(MARTe::StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        ok = ReadCoefficients(data);
+    }
+    return ok;
+}
+
+bool FIRFilterGAM::ReadCoefficients(MARTe::StructuredDataI &data) {
+    return ReadArray(data, "Coefficients", coefficients, numberOfCoefficients);
+}
+
+bool FIRFilterGAM::GetOutputElements(const MARTe::uint32 inputElements, MARTe::uint32 &outputElements) const {
+    outputElements = inputElements;
+    return (inputElements > 0u);
+}
+
+bool FIRFilterGAM::AllocateState() {
+    using namespace MARTe;
+    reversedCoefficients = new float32[numberOfCoefficients];
+    uint32 k;
+    for (k = 0u; k < numberOfCoefficients; k++) {
+        reversedCoefficients[k] = coefficients[numberOfCoefficients - 1u - k];
+    }
+    windowSize = (numberOfCoefficients - 1u) + numberOfInputElements;
+    windows = new float32[numberOfChannels * windowSize];
+    return true;
+}
+
+void FIRFilterGAM::ResetState() {
+    (void) MARTe::MemoryOperationsHelper::Set(windows, '\0', static_cast<MARTe::uint32>(numberOfChannels * windowSize * sizeof(MARTe::float32)));
+}
+
+MARTe::float32 *FIRFilterGAM::LoadChannel(const MARTe::uint32 channel) {
+    using namespace MARTe;
+    float32 *window = &windows[channel * windowSize];
+    (void) MemoryOperationsHelper::Copy(&window[numberOfCoefficients - 1u], inputs[channel],
+                                        static_cast<uint32>(numberOfInputElements * sizeof(float32)));
+    return window;
+}
+
+void FIRFilterGAM::StoreChannel(MARTe::float32 * const window) const {
+    using namespace MARTe;
+    if (numberOfCoefficients > 1u) {
+        (void) MemoryOperationsHelper::Move(window, &window[numberOfInputElements],
+                                            static_cast<uint32>((numberOfCoefficients - 1u) * sizeof(float32)));
+    }
+}
+
+bool FIRFilterGAM::Execute() {
+    using namespace MARTe;
+    uint32 c;
+    for (c = 0u; c < numberOfChannels; c++) {
+        float32 *window = LoadChannel(c);
+        float32 *output = outputs[c];
+        uint32 n;
+        for (n = 0u; n < numberOfInputElements; n++) {
+            output[n] = SignalProcessingKernels::Dot(reversedCoefficients, &window[n], numberOfCoefficients);
+        }
+        StoreChannel(window);
+    }
+    return true;
+}
+
+CLASS_REGISTER(FIRFilterGAM, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,177 @@
+/**
+ * @file FIRFilterGAM.h
+ * @brief Header file for class FIRFilterGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * FIRFilterGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_SIGNALPROCESSINGGAMS_FIRFILTERGAM_H_
+#define GAMS_SIGNALPROCESSINGGAMS_FIRFILTERGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SignalProcessingGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Finite impulse response filter applied to every channel.
+ *
+ * @details y[n] = sum_k(Coefficients[k] * x[n - k]). The last
+ * (number of coefficients - 1) samples of each channel are kept between
+ * cycles, so that the output is continuous across cycles. Each output
+ * sample is computed with a vectorised dot product between the (reversed)
+ * coefficients and a contiguous window of the history.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +LowPass = {
+ *     Class = FIRFilterGAM
+ *     Coefficients = {0.25 0.25 0.25 0.25} //Compulsory. The filter taps.
+ *     InputSignals = {
+ *         Channel0 = {
+ *             DataSource = ADC
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Channel0F = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * See SignalProcessingGAM for the signal constraints. The history is
+ * cleared at every state change.
+ */
+class FIRFilterGAM : public SignalProcessingGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FIRFilterGAM();
+
+    /**
+     * @brief Destructor. Frees the coefficients and the history.
+     */
+    virtual ~FIRFilterGAM();
+
+    /**
+     * @brief Reads the coefficients (see ReadCoefficients).
+     * @param[in] data see GAM::Initialise.
+     * @return true if the coefficients are valid.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Filters every channel.
+     * @return true.
+     */
+    virtual bool Execute();
+
+protected:
+    /**
+     * @brief Reads the Coefficients parameter into coefficients and
+     * numberOfCoefficients.
+     * @param[in] data the GAM configuration.
+     * @return true if Coefficients is a non-empty array.
+     */
+    virtual bool ReadCoefficients(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief The output has the same number of elements as the input.
+     * @return true.
+     */
+    virtual bool GetOutputElements(const MARTe::uint32 inputElements,
+                                   MARTe::uint32 &outputElements) const;
+
+    /**
+     * @brief Allocates the history of each channel and reverses the
+     * coefficients.
+     * @return true.
+     */
+    virtual bool AllocateState();
+
+    /**
+     * @brief Clears the history.
+     */
+    virtual void ResetState();
+
+    /**
+     * @brief Appends the current input of a channel to its history.
+     * @param[in] channel the channel index.
+     * @return the start of the channel window, i.e. the oldest retained
+     * sample followed by the numberOfInputElements new ones.
+     */
+    MARTe::float32 *LoadChannel(const MARTe::uint32 channel);
+
+    /**
+     * @brief Retains the last (numberOfCoefficients - 1) samples of the
+     * channel window for the next cycle.
+     * @param[in] window the value returned by LoadChannel.
+     */
+    void StoreChannel(MARTe::float32 * const window) const;
+
+    /**
+     * The filter coefficients, as configured.
+     */
+    MARTe::float32 *coefficients;
+
+    /**
+     * The filter coefficients in reverse order.
+     */
+    MARTe::float32 *reversedCoefficients;
+
+    /**
+     * The number of coefficients.
+     */
+    MARTe::uint32 numberOfCoefficients;
+
+    /**
+     * The window of each channel: (numberOfCoefficients - 1) history samples
+     * followed by numberOfInputElements samples.
+     */
+    MARTe::float32 *windows;
+
+    /**
+     * Number of elements of the window of each channel.
+     */
+    MARTe::uint32 windowSize;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_SIGNALPROCESSINGGAMS_FIRFILTERGAM_H_ */
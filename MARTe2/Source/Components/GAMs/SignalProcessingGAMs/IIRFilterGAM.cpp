@@ -0,0 +1,173 @@
+/**
+ * @file IIRFilterGAM.cpp
+ * @brief Source file for class IIRFilterGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class IIRFilterGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "IIRFilterGAM.h"
+#include "MemoryOperationsHelper.h"
+#include "SignalProcessingKernels.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+IIRFilterGAM::IIRFilterGAM() :
+        SignalProcessingGAM() {
+    using namespace MARTe;
+    order = 0u;
+    numerator = NULL_PTR(float32 *);
+    negatedDenominator = NULL_PTR(float32 *);
+    delays = NULL_PTR(float32 *);
+    channelInputs = NULL_PTR(float32 *);
+    channelOutputs = NULL_PTR(float32 *);
+}
+
+IIRFilterGAM::~IIRFilterGAM() {
+    using namespace MARTe;
+    if (numerator != NULL_PTR(float32 *)) {
+        delete[] numerator;
+    }
+    if (negatedDenominator != NULL_PTR(float32 *)) {
+        delete[] negatedDenominator;
+    }
+    if (delays != NULL_PTR(float32 *)) {
+        delete[] delays;
+    }
+    if (channelInputs != NULL_PTR(float32 *)) {
+        delete[] channelInputs;
+    }
+    if (channelOutputs != NULL_PTR(float32 *)) {
+        delete[] channelOutputs;
+    }
+}
+
+bool IIRFilterGAM::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = GAM::Initialise(data);
+    float32 *b = NULL_PTR(float32 *);
+    float32 *a = NULL_PTR(float32 *);
+    uint32 numberOfB = 0u;
+    uint32 numberOfA = 0u;
+    if (ok) {
+        ok = ReadArray(data, "Numerator", b, numberOfB);
+    }
+    if (ok) {
+        ok = ReadArray(data, "Denominator", a, numberOfA);
+    }
+    if (ok) {
+        ok = (a[0] != 0.0F);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The first Denominator coefficient shall not be 0");
+        }
+    }
+    if (ok) {
+        order = ((numberOfB > numberOfA) ? numberOfB : numberOfA) - 1u;
+        numerator = new float32[order + 1u];
+        negatedDenominator = new float32[order + 1u];
+        uint32 k;
+        for (k = 0u; k <= order; k++) {
+            numerator[k] = (k < numberOfB) ? (b[k] / a[0]) : 0.0F;
+            negatedDenominator[k] = (k < numberOfA) ? (-a[k] / a[0]) : 0.0F;
+        }
+    }
+    if (b != NULL_PTR(float32 *)) {
+        delete[] b;
+    }
+    if (a != NULL_PTR(float32 *)) {
+        delete[] a;
+    }
+    return ok;
+}
+
+bool IIRFilterGAM::GetOutputElements(const MARTe::uint32 inputElements, MARTe::uint32 &outputElements) const {
+    outputElements = inputElements;
+    return (inputElements > 0u);
+}
+
+bool IIRFilterGAM::AllocateState() {
+    using namespace MARTe;
+    if (order > 0u) {
+        delays = new float32[order * numberOfChannels];
+    }
+    channelInputs = new float32[numberOfChannels];
+    channelOutputs = new float32[numberOfChannels];
+    return true;
+}
+
+void IIRFilterGAM::ResetState() {
+    using namespace MARTe;
+    if (delays != NULL_PTR(float32 *)) {
+        (void) MemoryOperationsHelper::Set(delays, '\0', static_cast<uint32>(order * numberOfChannels * sizeof(float32)));
+    }
+}
+
+bool IIRFilterGAM::Execute() {
+    using namespace MARTe;
+    uint32 rowSize = static_cast<uint32>(numberOfChannels * sizeof(float32));
+    uint32 n;
+    for (n = 0u; n < numberOfInputElements; n++) {
+        uint32 c;
+        for (c = 0u; c < numberOfChannels; c++) {
+            channelInputs[c] = inputs[c][n];
+        }
+        //y = b0 x + z0
+        if (order > 0u) {
+            (void) MemoryOperationsHelper::Copy(channelOutputs, delays, rowSize);
+        }
+        else {
+            (void) MemoryOperationsHelper::Set(channelOutputs, '\0', rowSize);
+        }
+        SignalProcessingKernels::ScaleAdd(channelOutputs, channelInputs, numerator[0], numberOfChannels);
+        //zi = z(i+1) + b(i+1) x - a(i+1) y, with zorder = 0
+        if (order > 0u) {
+            if (order > 1u) {
+                (void) MemoryOperationsHelper::Move(delays, &delays[numberOfChannels], (order - 1u) * rowSize);
+            }
+            (void) MemoryOperationsHelper::Set(&delays[(order - 1u) * numberOfChannels], '\0', rowSize);
+            uint32 i;
+            for (i = 0u; i < order; i++) {
+                SignalProcessingKernels::ScaleAdd(&delays[i * numberOfChannels], channelInputs, numerator[i + 1u], numberOfChannels);
+                SignalProcessingKernels::ScaleAdd(&delays[i * numberOfChannels], channelOutputs, negatedDenominator[i + 1u], numberOfChannels);
+            }
+        }
+        for (c = 0u; c < numberOfChannels; c++) {
+            outputs[c][n] = channelOutputs[c];
+        }
+    }
+    return true;
+}
+
+CLASS_REGISTER(IIRFilterGAM, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,172 @@
+/**
+ * @file IIRFilterGAM.h
+ * @brief Header file for class IIRFilterGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * IIRFilterGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_SIGNALPROCESSINGGAMS_IIRFILTERGAM_H_
+#define GAMS_SIGNALPROCESSINGGAMS_IIRFILTERGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SignalProcessingGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Infinite impulse response filter applied to every channel.
+ *
+ * @details The transfer function is
+ * H(z) = (b0 + b1 z^-1 + ... + bM z^-M) / (a0 + a1 z^-1 + ... + aN z^-N)
+ * and is implemented in direct form II transposed. The coefficients are
+ * normalised by a0.
+ *
+ * The recursion of an IIR filter cannot be vectorised along time, so the
+ * delay lines of all the channels are stored side by side and each sample
+ * is computed for all the channels at once. The speed-up thus grows with
+ * the number of channels (up to 8 with AVX, 4 with SSE and NEON).
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Notch = {
+ *     Class = IIRFilterGAM
+ *     Numerator = {0.9726 -1.8500 0.9726} //Compulsory. b0 ... bM.
+ *     Denominator = {1.0 -1.8500 0.9453} //Compulsory. a0 ... aN. a0 shall not be 0.
+ *     InputSignals = {
+ *         Channel0 = {
+ *             DataSource = ADC
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *         Channel1 = {
+ *             DataSource = ADC
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Channel0F = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *         Channel1F = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * The delay lines are cleared at every state change.
+ */
+class IIRFilterGAM : public SignalProcessingGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    IIRFilterGAM();
+
+    /**
+     * @brief Destructor. Frees the coefficients and the state.
+     */
+    virtual ~IIRFilterGAM();
+
+    /**
+     * @brief Reads and normalises the coefficients.
+     * @param[in] data see GAM::Initialise.
+     * @return true if Numerator and Denominator are valid.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Filters every channel.
+     * @return true.
+     */
+    virtual bool Execute();
+
+protected:
+    /**
+     * @brief The output has the same number of elements as the input.
+     * @return true.
+     */
+    virtual bool GetOutputElements(const MARTe::uint32 inputElements,
+                                   MARTe::uint32 &outputElements) const;
+
+    /**
+     * @brief Allocates the delay lines and the per-sample channel vectors.
+     * @return true.
+     */
+    virtual bool AllocateState();
+
+    /**
+     * @brief Clears the delay lines.
+     */
+    virtual void ResetState();
+
+private:
+    /**
+     * The filter order.
+     */
+    MARTe::uint32 order;
+
+    /**
+     * b0 / a0 ... border / a0 (zero padded).
+     */
+    MARTe::float32 *numerator;
+
+    /**
+     * -a0 / a0 ... -aorder / a0 (zero padded).
+     */
+    MARTe::float32 *negatedDenominator;
+
+    /**
+     * The delay lines: order rows of numberOfChannels elements.
+     */
+    MARTe::float32 *delays;
+
+    /**
+     * The input sample of each channel.
+     */
+    MARTe::float32 *channelInputs;
+
+    /**
+     * The output sample of each channel.
+     */
+    MARTe::float32 *channelOutputs;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_SIGNALPROCESSINGGAMS_IIRFILTERGAM_H_ */
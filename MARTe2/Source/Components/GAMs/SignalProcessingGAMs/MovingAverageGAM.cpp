@@ -0,0 +1,94 @@
+/**
+ * @file MovingAverageGAM.cpp
+ * @brief Source file for class MovingAverageGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MovingAverageGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MovingAverageGAM.h"
+#include "SignalProcessingKernels.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+MovingAverageGAM::MovingAverageGAM() :
+        FIRFilterGAM() {
+    scale = 0.0F;
+}
+
+MovingAverageGAM::~MovingAverageGAM() {
+}
+
+bool MovingAverageGAM::ReadCoefficients(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = data.Read("WindowSize", numberOfCoefficients);
+    if (ok) {
+        ok = (numberOfCoefficients > 0u);
+    }
+    if (ok) {
+        scale = 1.0F / static_cast<float32>(numberOfCoefficients);
+        coefficients = new float32[numberOfCoefficients];
+        uint32 k;
+        for (k = 0u; k < numberOfCoefficients; k++) {
+            coefficients[k] = scale;
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "WindowSize shall be specified and shall be > 0");
+    }
+    return ok;
+}
+
+bool MovingAverageGAM::Execute() {
+    using namespace MARTe;
+    uint32 c;
+    for (c = 0u; c < numberOfChannels; c++) {
+        float32 *window = LoadChannel(c);
+        float32 *output = outputs[c];
+        //The sum is recomputed once per cycle and then slid over the window
+        float64 sum = static_cast<float64>(SignalProcessingKernels::Sum(window, numberOfCoefficients));
+        uint32 n;
+        for (n = 0u; n < numberOfInputElements; n++) {
+            output[n] = scale * static_cast<float32>(sum);
+            if ((n + 1u) < numberOfInputElements) {
+                sum += static_cast<float64>(window[n + numberOfCoefficients]) - static_cast<float64>(window[n]);
+            }
+        }
+        StoreChannel(window);
+    }
+    return true;
+}
+
+CLASS_REGISTER(MovingAverageGAM, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,115 @@
+/**
+ * @file MovingAverageGAM.h
+ * @brief Header file for class MovingAverageGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * MovingAverageGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_SIGNALPROCESSINGGAMS_MOVINGAVERAGEGAM_H_
+#define GAMS_SIGNALPROCESSINGGAMS_MOVINGAVERAGEGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FIRFilterGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Moving average of the last WindowSize samples of every channel.
+ *
+ * @details Each output sample is the sum of the window scaled by
+ * 1 / WindowSize. In each cycle the sum of the first window is computed
+ * with the vectorised kernel and then updated (in float64) for each sample,
+ * adding the sample which enters the window and subtracting the one which
+ * leaves it, so that a cycle costs O(WindowSize + NumberOfElements). As the
+ * sum is recomputed at every cycle the rounding errors do not accumulate
+ * over long pulses.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Smooth = {
+ *     Class = MovingAverageGAM
+ *     WindowSize = 16 //Compulsory. Number of samples averaged.
+ *     InputSignals = {
+ *         Channel0 = {
+ *             DataSource = ADC
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Channel0A = {
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class MovingAverageGAM : public FIRFilterGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MovingAverageGAM();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~MovingAverageGAM();
+
+    /**
+     * @brief Averages every channel.
+     * @return true.
+     */
+    virtual bool Execute();
+
+protected:
+    /**
+     * @brief Reads WindowSize and sets WindowSize coefficients equal to
+     * 1 / WindowSize.
+     * @param[in] data the GAM configuration.
+     * @return true if WindowSize > 0.
+     */
+    virtual bool ReadCoefficients(MARTe::StructuredDataI &data);
+
+private:
+    /**
+     * 1 / WindowSize.
+     */
+    MARTe::float32 scale;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_SIGNALPROCESSINGGAMS_MOVINGAVERAGEGAM_H_ */
@@ -0,0 +1,170 @@
+/**
+ * @file SignalProcessingGAM.cpp
+ * @brief Source file for class SignalProcessingGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SignalProcessingGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "SignalProcessingGAM.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+SignalProcessingGAM::SignalProcessingGAM() :
+        MARTe::GAM(),
+        MARTe::StatefulI() {
+    using namespace MARTe;
+    numberOfChannels = 0u;
+    numberOfInputElements = 0u;
+    numberOfOutputElements = 0u;
+    inputs = NULL_PTR(float32 **);
+    outputs = NULL_PTR(float32 **);
+}
+
+SignalProcessingGAM::~SignalProcessingGAM() {
+    using namespace MARTe;
+    if (inputs != NULL_PTR(float32 **)) {
+        delete[] inputs;
+    }
+    if (outputs != NULL_PTR(float32 **)) {
+        delete[] outputs;
+    }
+}
+
+bool SignalProcessingGAM::Setup() {
+    using namespace MARTe;
+    numberOfChannels = GetNumberOfInputSignals();
+    bool ok = (numberOfChannels > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "At least one input signal shall be defined");
+    }
+    if (ok) {
+        ok = (GetNumberOfOutputSignals() == numberOfChannels);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The number of output signals shall be equal to the number of input signals");
+        }
+    }
+    if (ok) {
+        inputs = new float32*[numberOfChannels];
+        outputs = new float32*[numberOfChannels];
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfChannels) && (ok); i++) {
+        ok = ((GetSignalType(InputSignals, i) == Float32Bit) && (GetSignalType(OutputSignals, i) == Float32Bit));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The signals of channel %d shall be float32", i);
+        }
+        uint32 inputSamples = 0u;
+        uint32 outputSamples = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, i, inputSamples);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(OutputSignals, i, outputSamples);
+        }
+        if (ok) {
+            ok = ((inputSamples == 1u) && (outputSamples == 1u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The signals of channel %d shall have Samples = 1. Use NumberOfElements instead", i);
+            }
+        }
+        uint32 inputElements = 0u;
+        uint32 outputElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(InputSignals, i, inputElements);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, i, outputElements);
+        }
+        if (ok) {
+            if (i == 0u) {
+                numberOfInputElements = inputElements;
+                ok = GetOutputElements(numberOfInputElements, numberOfOutputElements);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "%d input elements are not supported", numberOfInputElements);
+                }
+            }
+            else {
+                ok = (inputElements == numberOfInputElements);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "All the input signals shall have %d elements", numberOfInputElements);
+                }
+            }
+        }
+        if (ok) {
+            ok = (outputElements == numberOfOutputElements);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The output signal of channel %d shall have %d elements", i, numberOfOutputElements);
+            }
+        }
+        if (ok) {
+            inputs[i] = static_cast<float32 *>(GetInputSignalMemory(i));
+            outputs[i] = static_cast<float32 *>(GetOutputSignalMemory(i));
+        }
+    }
+    if (ok) {
+        ok = AllocateState();
+    }
+    if (ok) {
+        ResetState();
+    }
+    return ok;
+}
+
+bool SignalProcessingGAM::PrepareNextState(const MARTe::char8 * const currentStateName, const MARTe::char8 * const nextStateName) {
+    ResetState();
+    return true;
+}
+
+bool SignalProcessingGAM::ReadArray(MARTe::StructuredDataI &data, const MARTe::char8 * const name, MARTe::float32 *&values, MARTe::uint32 &numberOfValues) {
+    using namespace MARTe;
+    AnyType arrayDescription = data.GetType(name);
+    bool ok = !arrayDescription.IsVoid();
+    if (ok) {
+        numberOfValues = arrayDescription.GetNumberOfElements(0u);
+        ok = (numberOfValues > 0u);
+    }
+    if (ok) {
+        values = new float32[numberOfValues];
+        Vector<float32> valuesVector(values, numberOfValues);
+        ok = data.Read(name, valuesVector);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s shall be specified as a non-empty array", name);
+    }
+    return ok;
+}
+
+} // namespace MARTe2Tutorial
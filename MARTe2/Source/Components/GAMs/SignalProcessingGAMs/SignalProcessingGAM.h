@@ -0,0 +1,160 @@
+/**
+ * @file SignalProcessingGAM.h
+ * @brief Header file for class SignalProcessingGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * SignalProcessingGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_SIGNALPROCESSINGGAMS_SIGNALPROCESSINGGAM_H_
+#define GAMS_SIGNALPROCESSINGGAMS_SIGNALPROCESSINGGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "StatefulI.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Common base of the signal processing GAMs.
+ *
+ * @details Each input signal is a channel: a float32 array holding the
+ * NumberOfElements samples acquired in the current cycle (e.g. 100 elements
+ * for a 100 kHz acquisition read by a 1 kHz thread). The output signal with
+ * the same index receives the result for that channel. All the channels
+ * shall have the same number of elements.
+ *
+ * The state of the algorithms (filter history, delay lines, ...) is
+ * allocated once in Setup and is reset at every state change, so that no
+ * memory is allocated nor freed in the real-time cycle.
+ *
+ * The computation uses the kernels of SignalProcessingKernels.h, which are
+ * vectorised with SSE on x86-64 (AVX when the library is compiled with
+ * -mavx) and with NEON on armv8.
+ *
+ * Derived classes implement GetOutputElements, AllocateState, ResetState
+ * and Execute.
+ */
+class SignalProcessingGAM : public MARTe::GAM, public MARTe::StatefulI {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SignalProcessingGAM();
+
+    /**
+     * @brief Destructor. Frees the channel tables.
+     */
+    virtual ~SignalProcessingGAM();
+
+    /**
+     * @brief Verifies the signals, collects their addresses and allocates
+     * the state.
+     * @details The number of input and output signals shall be the same, all
+     * the signals shall be float32 with one sample, the input signals shall
+     * have the same number of elements and each output signal shall have
+     * GetOutputElements elements.
+     * @return true if the constraints above are met and AllocateState
+     * returns true.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Resets the state.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+protected:
+    /**
+     * @brief Gets the number of output elements of each channel.
+     * @param[in] inputElements the number of input elements of each channel.
+     * @param[out] outputElements the number of output elements.
+     * @return true if inputElements is valid for the algorithm.
+     */
+    virtual bool GetOutputElements(const MARTe::uint32 inputElements,
+                                   MARTe::uint32 &outputElements) const = 0;
+
+    /**
+     * @brief Allocates the state for numberOfChannels channels of
+     * numberOfInputElements elements.
+     * @return true if the state can be allocated.
+     */
+    virtual bool AllocateState() = 0;
+
+    /**
+     * @brief Resets the state to its initial value.
+     */
+    virtual void ResetState() = 0;
+
+    /**
+     * @brief Reads a float32 array parameter.
+     * @param[in] data the configuration.
+     * @param[in] name the name of the parameter.
+     * @param[out] values the array, allocated with new[]. Shall be NULL.
+     * @param[out] numberOfValues the number of elements of the array.
+     * @return true if the parameter exists and has at least one element.
+     */
+    static bool ReadArray(MARTe::StructuredDataI &data,
+                          const MARTe::char8 * const name,
+                          MARTe::float32 *&values,
+                          MARTe::uint32 &numberOfValues);
+
+    /**
+     * The number of channels.
+     */
+    MARTe::uint32 numberOfChannels;
+
+    /**
+     * The number of elements of each input signal.
+     */
+    MARTe::uint32 numberOfInputElements;
+
+    /**
+     * The number of elements of each output signal.
+     */
+    MARTe::uint32 numberOfOutputElements;
+
+    /**
+     * The address of each input signal.
+     */
+    MARTe::float32 **inputs;
+
+    /**
+     * The address of each output signal.
+     */
+    MARTe::float32 **outputs;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_SIGNALPROCESSINGGAMS_SIGNALPROCESSINGGAM_H_ */
@@ -0,0 +1,342 @@
+/**
+ * @file SignalProcessingKernels.h
+ * @brief Header file for the signal processing kernels
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the vectorised kernels shared by the
+ * signal processing GAMs. The instruction set is selected at compile time:
+ * AVX (when compiled with -mavx, i.e. with SIGNAL_PROCESSING_AVX=1, see
+ * Makefile.inc), SSE (always available on x86-64) or NEON (always available
+ * on AArch64, enabled with -mfpu=neon-fp-armv8 by Makefile.inc on an AArch32
+ * armv8 toolchain), with a portable fallback.
+ */
+
+#ifndef GAMS_SIGNALPROCESSINGGAMS_SIGNALPROCESSINGKERNELS_H_
+#define GAMS_SIGNALPROCESSINGGAMS_SIGNALPROCESSINGKERNELS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#if defined(__AVX__)
+#include <immintrin.h>
+#define SIGNAL_PROCESSING_AVX
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#define SIGNAL_PROCESSING_SSE
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SIGNAL_PROCESSING_NEON
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+namespace SignalProcessingKernels {
+
+/**
+ * @brief Computes the dot product of two arrays.
+ * @param[in] a the first array.
+ * @param[in] b the second array.
+ * @param[in] n the number of elements.
+ * @return sum(a[i] * b[i]).
+ */
+inline MARTe::float32 Dot(const MARTe::float32 * const a,
+                          const MARTe::float32 * const b,
+                          const MARTe::uint32 n);
+
+/**
+ * @brief Computes y[i] += alpha * x[i].
+ * @param[in,out] y the accumulator.
+ * @param[in] x the input array.
+ * @param[in] alpha the scale.
+ * @param[in] n the number of elements.
+ */
+inline void ScaleAdd(MARTe::float32 * const y,
+                     const MARTe::float32 * const x,
+                     const MARTe::float32 alpha,
+                     const MARTe::uint32 n);
+
+/**
+ * @brief Computes the sum of an array.
+ * @param[in] x the array.
+ * @param[in] n the number of elements.
+ * @return sum(x[i]).
+ */
+inline MARTe::float32 Sum(const MARTe::float32 * const x,
+                          const MARTe::uint32 n);
+
+/**
+ * @brief Computes the minimum, maximum, sum and sum of squares of an array
+ * in a single pass.
+ * @param[in] x the array.
+ * @param[in] n the number of elements (> 0).
+ * @param[out] minimum min(x[i]).
+ * @param[out] maximum max(x[i]).
+ * @param[out] sum sum(x[i]).
+ * @param[out] sumOfSquares sum(x[i] * x[i]).
+ */
+inline void Statistics(const MARTe::float32 * const x,
+                       const MARTe::uint32 n,
+                       MARTe::float32 &minimum,
+                       MARTe::float32 &maximum,
+                       MARTe::float32 &sum,
+                       MARTe::float32 &sumOfSquares);
+
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+namespace SignalProcessingKernels {
+
+#if defined(SIGNAL_PROCESSING_AVX)
+/**
+ * @brief Sums the 8 lanes of an AVX register.
+ */
+inline MARTe::float32 HorizontalSum(const __m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+    return _mm_cvtss_f32(s);
+}
+#elif defined(SIGNAL_PROCESSING_SSE)
+/**
+ * @brief Sums the 4 lanes of an SSE register.
+ */
+inline MARTe::float32 HorizontalSum(const __m128 v) {
+    __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+    return _mm_cvtss_f32(s);
+}
+#elif defined(SIGNAL_PROCESSING_NEON)
+/**
+ * @brief Sums the 4 lanes of a NEON register.
+ */
+inline MARTe::float32 HorizontalSum(const float32x4_t v) {
+#if defined(__aarch64__)
+    return vaddvq_f32(v);
+#else
+    float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+#endif
+}
+#endif
+
+inline MARTe::float32 Dot(const MARTe::float32 * const a, const MARTe::float32 * const b, const MARTe::uint32 n) {
+    using namespace MARTe;
+    uint32 i = 0u;
+    float32 result = 0.0F;
+#if defined(SIGNAL_PROCESSING_AVX)
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    for (; (i + 16u) <= n; i += 16u) {
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i])));
+        acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(&a[i + 8u]), _mm256_loadu_ps(&b[i + 8u])));
+    }
+    for (; (i + 8u) <= n; i += 8u) {
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i])));
+    }
+    result = HorizontalSum(_mm256_add_ps(acc0, acc1));
+#elif defined(SIGNAL_PROCESSING_SSE)
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    for (; (i + 8u) <= n; i += 8u) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i])));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&a[i + 4u]), _mm_loadu_ps(&b[i + 4u])));
+    }
+    for (; (i + 4u) <= n; i += 4u) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i])));
+    }
+    result = HorizontalSum(_mm_add_ps(acc0, acc1));
+#elif defined(SIGNAL_PROCESSING_NEON)
+    float32x4_t acc0 = vdupq_n_f32(0.0F);
+    float32x4_t acc1 = vdupq_n_f32(0.0F);
+    for (; (i + 8u) <= n; i += 8u) {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(&a[i]), vld1q_f32(&b[i]));
+        acc1 = vmlaq_f32(acc1, vld1q_f32(&a[i + 4u]), vld1q_f32(&b[i + 4u]));
+    }
+    for (; (i + 4u) <= n; i += 4u) {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(&a[i]), vld1q_f32(&b[i]));
+    }
+    result = HorizontalSum(vaddq_f32(acc0, acc1));
+#endif
+    for (; i < n; i++) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+inline void ScaleAdd(MARTe::float32 * const y, const MARTe::float32 * const x, const MARTe::float32 alpha, const MARTe::uint32 n) {
+    using namespace MARTe;
+    uint32 i = 0u;
+#if defined(SIGNAL_PROCESSING_AVX)
+    __m256 va = _mm256_set1_ps(alpha);
+    for (; (i + 8u) <= n; i += 8u) {
+        _mm256_storeu_ps(&y[i], _mm256_add_ps(_mm256_loadu_ps(&y[i]), _mm256_mul_ps(va, _mm256_loadu_ps(&x[i]))));
+    }
+#elif defined(SIGNAL_PROCESSING_SSE)
+    __m128 va = _mm_set1_ps(alpha);
+    for (; (i + 4u) <= n; i += 4u) {
+        _mm_storeu_ps(&y[i], _mm_add_ps(_mm_loadu_ps(&y[i]), _mm_mul_ps(va, _mm_loadu_ps(&x[i]))));
+    }
+#elif defined(SIGNAL_PROCESSING_NEON)
+    float32x4_t va = vdupq_n_f32(alpha);
+    for (; (i + 4u) <= n; i += 4u) {
+        vst1q_f32(&y[i], vmlaq_f32(vld1q_f32(&y[i]), va, vld1q_f32(&x[i])));
+    }
+#endif
+    for (; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+inline MARTe::float32 Sum(const MARTe::float32 * const x, const MARTe::uint32 n) {
+    using namespace MARTe;
+    uint32 i = 0u;
+    float32 result = 0.0F;
+#if defined(SIGNAL_PROCESSING_AVX)
+    __m256 acc = _mm256_setzero_ps();
+    for (; (i + 8u) <= n; i += 8u) {
+        acc = _mm256_add_ps(acc, _mm256_loadu_ps(&x[i]));
+    }
+    result = HorizontalSum(acc);
+#elif defined(SIGNAL_PROCESSING_SSE)
+    __m128 acc = _mm_setzero_ps();
+    for (; (i + 4u) <= n; i += 4u) {
+        acc = _mm_add_ps(acc, _mm_loadu_ps(&x[i]));
+    }
+    result = HorizontalSum(acc);
+#elif defined(SIGNAL_PROCESSING_NEON)
+    float32x4_t acc = vdupq_n_f32(0.0F);
+    for (; (i + 4u) <= n; i += 4u) {
+        acc = vaddq_f32(acc, vld1q_f32(&x[i]));
+    }
+    result = HorizontalSum(acc);
+#endif
+    for (; i < n; i++) {
+        result += x[i];
+    }
+    return result;
+}
+
+inline void Statistics(const MARTe::float32 * const x, const MARTe::uint32 n, MARTe::float32 &minimum, MARTe::float32 &maximum, MARTe::float32 &sum,
+                       MARTe::float32 &sumOfSquares) {
+    using namespace MARTe;
+    uint32 i = 0u;
+    minimum = x[0];
+    maximum = x[0];
+    sum = 0.0F;
+    sumOfSquares = 0.0F;
+#if defined(SIGNAL_PROCESSING_AVX)
+    if (n >= 8u) {
+        __m256 vmin = _mm256_loadu_ps(&x[0]);
+        __m256 vmax = vmin;
+        __m256 vsum = _mm256_setzero_ps();
+        __m256 vsq = _mm256_setzero_ps();
+        for (; (i + 8u) <= n; i += 8u) {
+            __m256 v = _mm256_loadu_ps(&x[i]);
+            vmin = _mm256_min_ps(vmin, v);
+            vmax = _mm256_max_ps(vmax, v);
+            vsum = _mm256_add_ps(vsum, v);
+            vsq = _mm256_add_ps(vsq, _mm256_mul_ps(v, v));
+        }
+        float32 lanes[8];
+        uint32 k;
+        _mm256_storeu_ps(&lanes[0], vmin);
+        for (k = 0u; k < 8u; k++) {
+            minimum = (lanes[k] < minimum) ? lanes[k] : minimum;
+        }
+        _mm256_storeu_ps(&lanes[0], vmax);
+        for (k = 0u; k < 8u; k++) {
+            maximum = (lanes[k] > maximum) ? lanes[k] : maximum;
+        }
+        sum = HorizontalSum(vsum);
+        sumOfSquares = HorizontalSum(vsq);
+    }
+#elif defined(SIGNAL_PROCESSING_SSE)
+    if (n >= 4u) {
+        __m128 vmin = _mm_loadu_ps(&x[0]);
+        __m128 vmax = vmin;
+        __m128 vsum = _mm_setzero_ps();
+        __m128 vsq = _mm_setzero_ps();
+        for (; (i + 4u) <= n; i += 4u) {
+            __m128 v = _mm_loadu_ps(&x[i]);
+            vmin = _mm_min_ps(vmin, v);
+            vmax = _mm_max_ps(vmax, v);
+            vsum = _mm_add_ps(vsum, v);
+            vsq = _mm_add_ps(vsq, _mm_mul_ps(v, v));
+        }
+        float32 lanes[4];
+        uint32 k;
+        _mm_storeu_ps(&lanes[0], vmin);
+        for (k = 0u; k < 4u; k++) {
+            minimum = (lanes[k] < minimum) ? lanes[k] : minimum;
+        }
+        _mm_storeu_ps(&lanes[0], vmax);
+        for (k = 0u; k < 4u; k++) {
+            maximum = (lanes[k] > maximum) ? lanes[k] : maximum;
+        }
+        sum = HorizontalSum(vsum);
+        sumOfSquares = HorizontalSum(vsq);
+    }
+#elif defined(SIGNAL_PROCESSING_NEON)
+    if (n >= 4u) {
+        float32x4_t vmin = vld1q_f32(&x[0]);
+        float32x4_t vmax = vmin;
+        float32x4_t vsum = vdupq_n_f32(0.0F);
+        float32x4_t vsq = vdupq_n_f32(0.0F);
+        for (; (i + 4u) <= n; i += 4u) {
+            float32x4_t v = vld1q_f32(&x[i]);
+            vmin = vminq_f32(vmin, v);
+            vmax = vmaxq_f32(vmax, v);
+            vsum = vaddq_f32(vsum, v);
+            vsq = vmlaq_f32(vsq, v, v);
+        }
+        float32 lanes[4];
+        uint32 k;
+        vst1q_f32(&lanes[0], vmin);
+        for (k = 0u; k < 4u; k++) {
+            minimum = (lanes[k] < minimum) ? lanes[k] : minimum;
+        }
+        vst1q_f32(&lanes[0], vmax);
+        for (k = 0u; k < 4u; k++) {
+            maximum = (lanes[k] > maximum) ? lanes[k] : maximum;
+        }
+        sum = HorizontalSum(vsum);
+        sumOfSquares = HorizontalSum(vsq);
+    }
+#endif
+    for (; i < n; i++) {
+        minimum = (x[i] < minimum) ? x[i] : minimum;
+        maximum = (x[i] > maximum) ? x[i] : maximum;
+        sum += x[i];
+        sumOfSquares += x[i] * x[i];
+    }
+}
+
+}
+}
+
+#endif /* GAMS_SIGNALPROCESSINGGAMS_SIGNALPROCESSINGKERNELS_H_ */
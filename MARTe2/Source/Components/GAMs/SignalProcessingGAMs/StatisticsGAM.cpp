@@ -0,0 +1,87 @@
+/**
+ * @file StatisticsGAM.cpp
+ * @brief Source file for class StatisticsGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StatisticsGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "SignalProcessingKernels.h"
+#include "StatisticsGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Number of statistics written for each channel.
+ */
+const MARTe::uint32 STATISTICS_GAM_NUMBER_OF_OUTPUTS = 4u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+StatisticsGAM::StatisticsGAM() :
+        SignalProcessingGAM() {
+}
+
+StatisticsGAM::~StatisticsGAM() {
+}
+
+bool StatisticsGAM::GetOutputElements(const MARTe::uint32 inputElements, MARTe::uint32 &outputElements) const {
+    outputElements = STATISTICS_GAM_NUMBER_OF_OUTPUTS;
+    return (inputElements > 0u);
+}
+
+bool StatisticsGAM::AllocateState() {
+    return true;
+}
+
+void StatisticsGAM::ResetState() {
+}
+
+bool StatisticsGAM::Execute() {
+    using namespace MARTe;
+    float32 scale = 1.0F / static_cast<float32>(numberOfInputElements);
+    uint32 c;
+    for (c = 0u; c < numberOfChannels; c++) {
+        float32 sum = 0.0F;
+        float32 sumOfSquares = 0.0F;
+        float32 *output = outputs[c];
+        SignalProcessingKernels::Statistics(inputs[c], numberOfInputElements, output[0], output[1], sum, sumOfSquares);
+        output[2] = sum * scale;
+        output[3] = static_cast<float32>(sqrt(sumOfSquares * scale));
+    }
+    return true;
+}
+
+CLASS_REGISTER(StatisticsGAM, "")
+} // namespace MARTe2Tutorial
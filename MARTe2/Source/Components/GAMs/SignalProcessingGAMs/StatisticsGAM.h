@@ -0,0 +1,115 @@
+/**
+ * @file StatisticsGAM.h
+ * @brief Header file for class StatisticsGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * StatisticsGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_SIGNALPROCESSINGGAMS_STATISTICSGAM_H_
+#define GAMS_SIGNALPROCESSINGGAMS_STATISTICSGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SignalProcessingGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Computes the minimum, maximum, mean and root mean square of the
+ * samples of every channel in the current cycle.
+ *
+ * @details The four values are computed in a single vectorised pass and
+ * are written, in this order, to the four elements of the output signal of
+ * the channel.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Stats = {
+ *     Class = StatisticsGAM
+ *     InputSignals = {
+ *         Channel0 = {
+ *             DataSource = ADC
+ *             Type = float32
+ *             NumberOfElements = 100
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Channel0Stats = { //{min, max, mean, rms}
+ *             DataSource = DDB1
+ *             Type = float32
+ *             NumberOfElements = 4
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class StatisticsGAM : public SignalProcessingGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    StatisticsGAM();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~StatisticsGAM();
+
+    /**
+     * @brief Computes the statistics of every channel.
+     * @return true.
+     */
+    virtual bool Execute();
+
+protected:
+    /**
+     * @brief The output has 4 elements.
+     * @return true if inputElements > 0.
+     */
+    virtual bool GetOutputElements(const MARTe::uint32 inputElements,
+                                   MARTe::uint32 &outputElements) const;
+
+    /**
+     * @brief No state is required.
+     * @return true.
+     */
+    virtual bool AllocateState();
+
+    /**
+     * @brief NOOP.
+     */
+    virtual void ResetState();
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_SIGNALPROCESSINGGAMS_STATISTICSGAM_H_ */
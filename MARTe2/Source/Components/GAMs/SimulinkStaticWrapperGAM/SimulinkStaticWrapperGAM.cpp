@@ -0,0 +1,522 @@
+/**
+ * @file SimulinkStaticWrapperGAM.cpp
+ * @brief Source file for class SimulinkStaticWrapperGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SimulinkStaticWrapperGAM (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "SimulinkStaticWrapperGAM.h"
+#include "Sleep.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * void *<SymbolPrefix>(void): allocates a model instance.
+ */
+typedef void *(*SimulinkStaticAllocFunction)();
+
+/**
+ * uint32 <SymbolPrefix>_GetStaticTable(void *model, entries, size): fills
+ * at most size entries and returns the number of entries of the table.
+ */
+typedef MARTe::uint32 (*SimulinkStaticGetTableFunction)(void *, MARTe2Tutorial::SimulinkStaticTableEntry *, MARTe::uint32);
+
+/**
+ * void <SymbolPrefix>_xxx(void *model).
+ */
+typedef void (*SimulinkStaticModelFunction)(void *);
+
+/**
+ * No update in progress or pending.
+ */
+const MARTe::uint32 SIMULINK_STATIC_UPDATE_IDLE = 0u;
+
+/**
+ * The staged values are pending to be applied.
+ */
+const MARTe::uint32 SIMULINK_STATIC_UPDATE_PENDING = 1u;
+
+/**
+ * An update is being staged.
+ */
+const MARTe::uint32 SIMULINK_STATIC_UPDATE_WRITING = 2u;
+
+/**
+ * The real-time thread is applying the staged values.
+ */
+const MARTe::uint32 SIMULINK_STATIC_UPDATE_APPLYING = 3u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+SimulinkStaticWrapperGAM::SimulinkStaticWrapperGAM() :
+        MARTe::GAM(),
+        MARTe::MessageI() {
+    using namespace MARTe;
+    model = NULL_PTR(void *);
+    initializeFunction = NULL_PTR(SimulinkStaticModelFunction);
+    stepFunction = NULL_PTR(SimulinkStaticModelFunction);
+    terminateFunction = NULL_PTR(SimulinkStaticModelFunction);
+    table = NULL_PTR(SimulinkStaticTableEntry *);
+    numberOfEntries = 0u;
+    stagedValues = NULL_PTR(char8 *);
+    stagedOffsets = NULL_PTR(uint32 *);
+    stagedChanged = NULL_PTR(bool *);
+    updateState = SIMULINK_STATIC_UPDATE_IDLE;
+    stateBeforeUpdate = SIMULINK_STATIC_UPDATE_IDLE;
+    numberOfSamples = 1u;
+    inputAddresses = NULL_PTR(void **);
+    inputSizes = NULL_PTR(uint32 *);
+    outputAddresses = NULL_PTR(void **);
+    outputSizes = NULL_PTR(uint32 *);
+    inputSignals = NULL_PTR(void **);
+    outputSignals = NULL_PTR(void **);
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    (void) MessageI::InstallMessageFilter(filter);
+}
+
+SimulinkStaticWrapperGAM::~SimulinkStaticWrapperGAM() {
+    using namespace MARTe;
+    if ((model != NULL_PTR(void *)) && (terminateFunction != NULL_PTR(SimulinkStaticModelFunction))) {
+        terminateFunction(model);
+    }
+    if (table != NULL_PTR(SimulinkStaticTableEntry *)) {
+        delete[] table;
+    }
+    if (stagedValues != NULL_PTR(char8 *)) {
+        delete[] stagedValues;
+    }
+    if (stagedOffsets != NULL_PTR(uint32 *)) {
+        delete[] stagedOffsets;
+    }
+    if (stagedChanged != NULL_PTR(bool *)) {
+        delete[] stagedChanged;
+    }
+    if (inputAddresses != NULL_PTR(void **)) {
+        delete[] inputAddresses;
+    }
+    if (inputSizes != NULL_PTR(uint32 *)) {
+        delete[] inputSizes;
+    }
+    if (outputAddresses != NULL_PTR(void **)) {
+        delete[] outputAddresses;
+    }
+    if (outputSizes != NULL_PTR(uint32 *)) {
+        delete[] outputSizes;
+    }
+    if (inputSignals != NULL_PTR(void **)) {
+        delete[] inputSignals;
+    }
+    if (outputSignals != NULL_PTR(void **)) {
+        delete[] outputSignals;
+    }
+    library.Close();
+}
+
+bool SimulinkStaticWrapperGAM::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = GAM::Initialise(data);
+    StreamString libraryName;
+    StreamString symbolPrefix;
+    if (ok) {
+        ok = data.Read("Library", libraryName);
+        if (ok) {
+            ok = data.Read("SymbolPrefix", symbolPrefix);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Library and SymbolPrefix shall be specified");
+        }
+    }
+    if (ok) {
+        if (!data.Read("NumberOfSamples", numberOfSamples)) {
+            numberOfSamples = 1u;
+        }
+        ok = (numberOfSamples > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfSamples shall be > 0");
+        }
+    }
+    if (ok) {
+        ok = library.Open(libraryName.Buffer());
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not open %s", libraryName.Buffer());
+        }
+    }
+    SimulinkStaticAllocFunction allocFunction = NULL_PTR(SimulinkStaticAllocFunction);
+    SimulinkStaticGetTableFunction getTableFunction = NULL_PTR(SimulinkStaticGetTableFunction);
+    if (ok) {
+        StreamString symbol;
+        allocFunction = reinterpret_cast<SimulinkStaticAllocFunction>(library.Function(symbolPrefix.Buffer()));
+        symbol.Printf("%s_initialize", symbolPrefix.Buffer());
+        initializeFunction = reinterpret_cast<SimulinkStaticModelFunction>(library.Function(symbol.Buffer()));
+        symbol = "";
+        symbol.Printf("%s_step", symbolPrefix.Buffer());
+        stepFunction = reinterpret_cast<SimulinkStaticModelFunction>(library.Function(symbol.Buffer()));
+        symbol = "";
+        symbol.Printf("%s_terminate", symbolPrefix.Buffer());
+        terminateFunction = reinterpret_cast<SimulinkStaticModelFunction>(library.Function(symbol.Buffer()));
+        symbol = "";
+        symbol.Printf("%s_GetStaticTable", symbolPrefix.Buffer());
+        getTableFunction = reinterpret_cast<SimulinkStaticGetTableFunction>(library.Function(symbol.Buffer()));
+        ok = ((allocFunction != NULL_PTR(SimulinkStaticAllocFunction)) && (initializeFunction != NULL_PTR(SimulinkStaticModelFunction))
+                && (stepFunction != NULL_PTR(SimulinkStaticModelFunction)));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "%s does not export %s, %s_initialize and %s_step", libraryName.Buffer(), symbolPrefix.Buffer(),
+                         symbolPrefix.Buffer(), symbolPrefix.Buffer());
+        }
+        else {
+            ok = (getTableFunction != NULL_PTR(SimulinkStaticGetTableFunction));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "%s was not generated with static_table = 1 (%s_GetStaticTable not found)", libraryName.Buffer(),
+                             symbolPrefix.Buffer());
+            }
+        }
+    }
+    if (ok) {
+        model = allocFunction();
+        ok = (model != NULL_PTR(void *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the %s model", symbolPrefix.Buffer());
+        }
+    }
+    if (ok) {
+        numberOfEntries = getTableFunction(model, NULL_PTR(SimulinkStaticTableEntry *), 0u);
+        table = new SimulinkStaticTableEntry[numberOfEntries];
+        ok = (getTableFunction(model, table, numberOfEntries) == numberOfEntries);
+    }
+    if (ok) {
+        //One staging slot per parameter, so that the updates are resolved here
+        stagedOffsets = new uint32[numberOfEntries];
+        stagedChanged = new bool[numberOfEntries];
+        uint32 stagedSize = 0u;
+        uint32 i;
+        for (i = 0u; i < numberOfEntries; i++) {
+            stagedOffsets[i] = stagedSize;
+            stagedChanged[i] = false;
+            if (table[i].kind == SIMULINK_STATIC_PARAMETER) {
+                stagedSize += static_cast<uint32>(table[i].byteSize);
+            }
+        }
+        if (stagedSize > 0u) {
+            stagedValues = new char8[stagedSize];
+        }
+    }
+    if ((ok) && (data.MoveRelative("Parameters"))) {
+        uint32 numberOfParameters = data.GetNumberOfChildren();
+        uint32 i;
+        for (i = 0u; (i < numberOfParameters) && (ok); i++) {
+            const char8 * const name = data.GetChildName(i);
+            uint32 index = 0u;
+            ok = GetParameterIndex(name, index);
+            if (ok) {
+                //The model is not executed yet: write it directly
+                AnyType value = data.GetType(name);
+                ok = CheckParameter(index, value);
+                if (ok) {
+                    ok = WriteParameter(index, value, static_cast<char8 *>(table[index].address));
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "%s is not a parameter of the static table", name);
+            }
+        }
+        (void) data.MoveToAncestor(1u);
+    }
+    return ok;
+}
+
+bool SimulinkStaticWrapperGAM::FindEntry(const MARTe::char8 * const name, const MARTe::uint32 kind, MARTe::uint32 &index) const {
+    using namespace MARTe;
+    bool found = false;
+    uint32 i;
+    for (i = 0u; (i < numberOfEntries) && (!found); i++) {
+        if (table[i].kind == kind) {
+            found = (StringHelper::Compare(table[i].name, name) == 0);
+            if (found) {
+                index = i;
+            }
+        }
+    }
+    return found;
+}
+
+bool SimulinkStaticWrapperGAM::GetParameterIndex(const MARTe::char8 * const name, MARTe::uint32 &index) const {
+    return FindEntry(name, SIMULINK_STATIC_PARAMETER, index);
+}
+
+bool SimulinkStaticWrapperGAM::UpdateParameter(const MARTe::uint32 index, const MARTe::AnyType &value) {
+    using namespace MARTe;
+    bool ok = CheckParameter(index, value);
+    if (ok) {
+        BeginUpdate();
+        ok = WriteParameter(index, value, &stagedValues[stagedOffsets[index]]);
+        if (ok) {
+            stagedChanged[index] = true;
+        }
+        EndUpdate(ok);
+    }
+    return ok;
+}
+
+MARTe::ErrorManagement::ErrorType SimulinkStaticWrapperGAM::SetParameters(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    uint32 numberOfParameters = data.GetNumberOfChildren();
+    err.parametersError = (numberOfParameters == 0u);
+    if (!err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "At least one parameter shall be specified");
+    }
+    //Check all the parameters before staging any
+    uint32 i;
+    for (i = 0u; (i < numberOfParameters) && (err.ErrorsCleared()); i++) {
+        const char8 * const name = data.GetChildName(i);
+        uint32 index = 0u;
+        if (GetParameterIndex(name, index)) {
+            err.parametersError = !CheckParameter(index, data.GetType(name));
+        }
+        else {
+            err.parametersError = true;
+            REPORT_ERROR(ErrorManagement::ParametersError, "%s is not a parameter of the static table", name);
+        }
+    }
+    if (err.ErrorsCleared()) {
+        bool ok = true;
+        BeginUpdate();
+        for (i = 0u; (i < numberOfParameters) && (ok); i++) {
+            const char8 * const name = data.GetChildName(i);
+            uint32 index = 0u;
+            ok = GetParameterIndex(name, index);
+            if (ok) {
+                ok = WriteParameter(index, data.GetType(name), &stagedValues[stagedOffsets[index]]);
+            }
+            if (ok) {
+                stagedChanged[index] = true;
+            }
+        }
+        EndUpdate(true);
+        err.fatalError = !ok;
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType SimulinkStaticWrapperGAM::SetParameter(MARTe::StreamString name, MARTe::float64 value) {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    uint32 index = 0u;
+    if (GetParameterIndex(name.Buffer(), index)) {
+        err.parametersError = !UpdateParameter(index, AnyType(value));
+    }
+    else {
+        err.parametersError = true;
+        REPORT_ERROR(ErrorManagement::ParametersError, "%s is not a parameter of the static table", name.Buffer());
+    }
+    return err;
+}
+
+bool SimulinkStaticWrapperGAM::CheckParameter(const MARTe::uint32 index, const MARTe::AnyType &value) const {
+    using namespace MARTe;
+    bool ok = (index < numberOfEntries);
+    if (ok) {
+        ok = (table[index].kind == SIMULINK_STATIC_PARAMETER);
+    }
+    if (ok) {
+        ok = !value.IsVoid();
+    }
+    if (ok) {
+        uint32 numberOfElements = 1u;
+        if (value.GetNumberOfDimensions() > 0u) {
+            numberOfElements *= value.GetNumberOfElements(0u);
+        }
+        if (value.GetNumberOfDimensions() > 1u) {
+            numberOfElements *= value.GetNumberOfElements(1u);
+        }
+        uint32 elementSize = static_cast<uint32>(value.GetTypeDescriptor().numberOfBits) / 8u;
+        ok = (static_cast<size_t>(numberOfElements * elementSize) == table[index].byteSize);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The size of %s does not match the size in the model", table[index].name);
+        }
+    }
+    return ok;
+}
+
+bool SimulinkStaticWrapperGAM::WriteParameter(const MARTe::uint32 index, const MARTe::AnyType &value, MARTe::char8 * const destination) const {
+    using namespace MARTe;
+    bool ok = true;
+    const char8 * const source = static_cast<const char8 *>(value.GetDataPointer());
+    if (value.GetNumberOfDimensions() > 1u) {
+        //Row-major configuration to column-major model
+        uint32 numberOfColumns = value.GetNumberOfElements(0u);
+        uint32 numberOfRows = value.GetNumberOfElements(1u);
+        uint32 elementSize = static_cast<uint32>(value.GetTypeDescriptor().numberOfBits) / 8u;
+        uint32 r;
+        for (r = 0u; (r < numberOfRows) && (ok); r++) {
+            uint32 c;
+            for (c = 0u; (c < numberOfColumns) && (ok); c++) {
+                ok = MemoryOperationsHelper::Copy(&destination[((c * numberOfRows) + r) * elementSize], &source[((r * numberOfColumns) + c) * elementSize],
+                                                  elementSize);
+            }
+        }
+    }
+    else {
+        ok = MemoryOperationsHelper::Copy(destination, source, static_cast<uint32>(table[index].byteSize));
+    }
+    return ok;
+}
+
+void SimulinkStaticWrapperGAM::BeginUpdate() {
+    using namespace MARTe;
+    bool acquired = false;
+    while (!acquired) {
+        uint32 expected = __atomic_load_n(&updateState, __ATOMIC_ACQUIRE);
+        if ((expected == SIMULINK_STATIC_UPDATE_IDLE) || (expected == SIMULINK_STATIC_UPDATE_PENDING)) {
+            acquired = __atomic_compare_exchange_n(&updateState, &expected, SIMULINK_STATIC_UPDATE_WRITING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+            if (acquired) {
+                stateBeforeUpdate = expected;
+            }
+        }
+        if (!acquired) {
+            Sleep::MSec(1u);
+        }
+    }
+}
+
+void SimulinkStaticWrapperGAM::EndUpdate(const bool commit) {
+    //A pending update which is extended stays pending
+    __atomic_store_n(&updateState, (commit) ? (SIMULINK_STATIC_UPDATE_PENDING) : (stateBeforeUpdate), __ATOMIC_RELEASE);
+}
+
+void SimulinkStaticWrapperGAM::ApplyUpdate() {
+    using namespace MARTe;
+    uint32 expected = SIMULINK_STATIC_UPDATE_PENDING;
+    if (__atomic_compare_exchange_n(&updateState, &expected, SIMULINK_STATIC_UPDATE_APPLYING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        uint32 i;
+        for (i = 0u; i < numberOfEntries; i++) {
+            if (stagedChanged[i]) {
+                (void) MemoryOperationsHelper::Copy(table[i].address, &stagedValues[stagedOffsets[i]], static_cast<uint32>(table[i].byteSize));
+                stagedChanged[i] = false;
+            }
+        }
+        __atomic_store_n(&updateState, SIMULINK_STATIC_UPDATE_IDLE, __ATOMIC_RELEASE);
+    }
+}
+
+bool SimulinkStaticWrapperGAM::BindSignals(const MARTe::SignalDirection direction, void **&addresses, MARTe::uint32 *&sizes) {
+    using namespace MARTe;
+    uint32 numberOfSignals = (direction == InputSignals) ? GetNumberOfInputSignals() : GetNumberOfOutputSignals();
+    uint32 kind = (direction == InputSignals) ? SIMULINK_STATIC_INPUT : SIMULINK_STATIC_OUTPUT;
+    addresses = new void*[numberOfSignals];
+    sizes = new uint32[numberOfSignals];
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        StreamString signalName;
+        uint32 index = 0u;
+        ok = GetSignalName(direction, i, signalName);
+        if (ok) {
+            ok = FindEntry(signalName.Buffer(), kind, index);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "%s is not a %s port of the static table", signalName.Buffer(),
+                             (direction == InputSignals) ? "input" : "output");
+            }
+        }
+        uint32 byteSize = 0u;
+        if (ok) {
+            ok = GetSignalByteSize(direction, i, byteSize);
+        }
+        if (ok) {
+            ok = (static_cast<size_t>(byteSize) == (table[index].byteSize * numberOfSamples));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The size of %s shall be NumberOfSamples (%d) times the size in the model",
+                             signalName.Buffer(), numberOfSamples);
+            }
+        }
+        if (ok) {
+            sizes[i] = byteSize / numberOfSamples;
+        }
+        if (ok) {
+            addresses[i] = table[index].address;
+        }
+    }
+    return ok;
+}
+
+bool SimulinkStaticWrapperGAM::Setup() {
+    using namespace MARTe;
+    bool ok = BindSignals(InputSignals, inputAddresses, inputSizes);
+    if (ok) {
+        ok = BindSignals(OutputSignals, outputAddresses, outputSizes);
+    }
+    if (ok) {
+        uint32 i;
+        inputSignals = new void*[GetNumberOfInputSignals()];
+        for (i = 0u; i < GetNumberOfInputSignals(); i++) {
+            inputSignals[i] = GetInputSignalMemory(i);
+        }
+        outputSignals = new void*[GetNumberOfOutputSignals()];
+        for (i = 0u; i < GetNumberOfOutputSignals(); i++) {
+            outputSignals[i] = GetOutputSignalMemory(i);
+        }
+        initializeFunction(model);
+    }
+    return ok;
+}
+
+bool SimulinkStaticWrapperGAM::Execute() {
+    using namespace MARTe;
+    ApplyUpdate();
+    uint32 s;
+    for (s = 0u; s < numberOfSamples; s++) {
+        uint32 i;
+        for (i = 0u; i < GetNumberOfInputSignals(); i++) {
+            (void) MemoryOperationsHelper::Copy(inputAddresses[i], &static_cast<char8 *>(inputSignals[i])[s * inputSizes[i]], inputSizes[i]);
+        }
+        stepFunction(model);
+        for (i = 0u; i < GetNumberOfOutputSignals(); i++) {
+            (void) MemoryOperationsHelper::Copy(&static_cast<char8 *>(outputSignals[i])[s * outputSizes[i]], outputAddresses[i], outputSizes[i]);
+        }
+    }
+    return true;
+}
+
+void SimulinkStaticWrapperGAM::Purge(MARTe::ReferenceContainer &purgeList) {
+    RemoveMessageFilter(filter);
+    GAM::Purge(purgeList);
+}
+
+CLASS_REGISTER(SimulinkStaticWrapperGAM, "")
+CLASS_METHOD_REGISTER(SimulinkStaticWrapperGAM, SetParameters)
+CLASS_METHOD_REGISTER(SimulinkStaticWrapperGAM, SetParameter)
+} // namespace MARTe2Tutorial
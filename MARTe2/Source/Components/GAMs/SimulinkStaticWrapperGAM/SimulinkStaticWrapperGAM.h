@@ -0,0 +1,431 @@
+/**
+ * @file SimulinkStaticWrapperGAM.h
+ * @brief Header file for class SimulinkStaticWrapperGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * SimulinkStaticWrapperGAM with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef GAMS_SIMULINKSTATICWRAPPERGAM_SIMULINKSTATICWRAPPERGAM_H_
+#define GAMS_SIMULINKSTATICWRAPPERGAM_SIMULINKSTATICWRAPPERGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <stddef.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "LoadableLibrary.h"
+#include "MessageI.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * The entry describes a tunable parameter.
+ */
+const MARTe::uint32 SIMULINK_STATIC_PARAMETER = 0u;
+
+/**
+ * The entry describes a root input port.
+ */
+const MARTe::uint32 SIMULINK_STATIC_INPUT = 1u;
+
+/**
+ * The entry describes a root output port.
+ */
+const MARTe::uint32 SIMULINK_STATIC_OUTPUT = 2u;
+
+/**
+ * @brief An entry of the table generated by the code_gen.m scripts when
+ * static_table = 1. The layout shall match the StaticTableEntry emitted in
+ * the model source code.
+ */
+struct SimulinkStaticTableEntry {
+    /**
+     * The name of the parameter or of the port.
+     */
+    const MARTe::char8 *name;
+
+    /**
+     * SIMULINK_STATIC_PARAMETER, SIMULINK_STATIC_INPUT or
+     * SIMULINK_STATIC_OUTPUT.
+     */
+    MARTe::uint32 kind;
+
+    /**
+     * The address of the data in the model instance.
+     */
+    void *address;
+
+    /**
+     * The size of the data in bytes.
+     */
+    size_t byteSize;
+};
+
+/**
+ * @brief Executes a Simulink model generated with the static parameter/IO
+ * table of the Models code_gen.m scripts (static_table = 1).
+ *
+ * @details The SimulinkWrapperGAM finds the parameters and the ports by
+ * name, walking the C-API string tables of the model. With static_table = 1
+ * the generated library instead exports <SymbolPrefix>_GetStaticTable,
+ * which returns, for a model instance, the address and size of every
+ * parameter and port listed in code_gen.m, computed from the offsets known
+ * when the model is compiled. The C-API tables are not generated, so that
+ * the library is smaller and loads faster.
+ *
+ * The table is read once, after the instance is allocated. The parameters
+ * of the Parameters node are then copied to their addresses and the GAM
+ * signals are bound, by name, to the ports. In the real-time cycle the
+ * inputs are copied to the model, the step function is called and the
+ * outputs are copied back, with no lookups.
+ *
+ * The parameters can be changed online, without a state change, by sending
+ * a Message to the GAM (e.g. through the TCPSocketMessageProxy):
+ * <pre>
+ * +UpdateParametersMsg = {
+ *     Class = Message
+ *     Destination = RTApp.Functions.GAMPID
+ *     Function = SetParameters
+ *     Mode = ExpectsReply
+ *     +Parameters = {
+ *         Class = ConfigurationDatabase
+ *         Kp = (float64) 12.0 //Same syntax of the Parameters node.
+ *     }
+ * }
+ * </pre>
+ * or, one float64 parameter at a time, by an OPCUAVariable named as the
+ * parameter, with the Event PVValue = ParameterName and
+ * Function = SetParameter. From C++, UpdateParameter does the same with the
+ * index returned (once) by GetParameterIndex.
+ *
+ * The new values are checked and copied to a staging buffer, with the
+ * address and size of each parameter resolved in Initialise, and are
+ * copied to the model at the beginning of the next cycle, all at once, so
+ * that a step never sees a partial update. The real-time thread never
+ * blocks on an update (as with the ParameterBuffer of the PIDGAM).
+ *
+ * With NumberOfSamples = N > 1 the model is stepped N times in each cycle,
+ * so that a model designed for a 10 kHz rate can be executed by a 1 kHz
+ * thread which hands over blocks of N = 10 samples, paying the cost of the
+ * scheduler once per block. Every signal shall then hold N times the port
+ * of the model: the sample s is copied to (from) the port before (after)
+ * the step s.
+ *
+ * The model shall be generated with the code_gen.m settings (ert_shrlib,
+ * reusable function, root I/O part of the model data structure,
+ * column-major arrays). Matrices given as parameters are thus stored by
+ * columns in the model.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +GAMPID = {
+ *     Class = SimulinkStaticWrapperGAM
+ *     Library = PID.so //Compulsory. Searched in LD_LIBRARY_PATH.
+ *     SymbolPrefix = PID //Compulsory. The model name.
+ *     NumberOfSamples = 1 //Optional. Default = 1. Number of model steps in each cycle.
+ *     InputSignals = {
+ *         e = { //Shall be a port of the table with the same size.
+ *             DataSource = DDB1
+ *             Type = float64
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         u = {
+ *             DataSource = DDB1
+ *             Type = float64
+ *         }
+ *     }
+ *     Parameters = { //Optional. The parameters not set keep the value of the model.
+ *         Kp = (float64) 10.93
+ *         Ki = (float64) 2.88
+ *         Kd = (float64) 4.29
+ *         dt = (float64) 0.01
+ *     }
+ * }
+ * </pre>
+ */
+class SimulinkStaticWrapperGAM : public MARTe::GAM, public MARTe::MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the filter of the registered methods.
+     */
+    SimulinkStaticWrapperGAM();
+
+    /**
+     * @brief Destructor. Terminates the model instance and closes the
+     * library.
+     */
+    virtual ~SimulinkStaticWrapperGAM();
+
+    /**
+     * @brief Loads the library, allocates a model instance, reads its
+     * static table and sets the parameters.
+     * @param[in] data see GAM::Initialise.
+     * @return true if the library exports the required functions and all
+     * the parameters in the Parameters node are in the table with the
+     * same size.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Binds the signals to the ports and initialises the model.
+     * @return true if every signal is a port of the table (inputs for
+     * InputSignals and outputs for OutputSignals) with NumberOfSamples
+     * times its size.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Applies any pending update of the parameters and, for each
+     * sample of the block, copies the inputs, executes a model step and
+     * copies the outputs.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief Removes the message filter.
+     * @param[in] purgeList see ReferenceContainer::Purge.
+     */
+    virtual void Purge(MARTe::ReferenceContainer &purgeList);
+
+    /**
+     * @brief Gets the index of a parameter for UpdateParameter.
+     * @param[in] name the parameter name.
+     * @param[out] index the parameter index.
+     * @return true if the parameter is in the table.
+     */
+    bool GetParameterIndex(const MARTe::char8 * const name,
+                           MARTe::uint32 &index) const;
+
+    /**
+     * @brief Stages a new value of a parameter, applied at the next cycle.
+     * @param[in] index the value returned by GetParameterIndex.
+     * @param[in] value the new value. Matrices are transposed to the model
+     * column-major layout.
+     * @return true if index is valid and value has the size of the
+     * parameter.
+     */
+    bool UpdateParameter(const MARTe::uint32 index,
+                         const MARTe::AnyType &value);
+
+    /**
+     * @brief Stages new values of one or more parameters, applied together
+     * at the next cycle.
+     * @details Registered with CLASS_METHOD_REGISTER. Nothing is staged if
+     * any of the parameters is not valid.
+     * @param[in] data holds the parameters, as in the Parameters node.
+     * @return ErrorManagement::NoError if at least one parameter is set and
+     * all are parameters of the table with the same size.
+     */
+    MARTe::ErrorManagement::ErrorType SetParameters(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Stages a new value of a float64 parameter.
+     * @details Registered with CLASS_METHOD_REGISTER. Matches the Message
+     * sent by an OPCUAVariable with PVValue = ParameterName.
+     * @param[in] name the parameter name.
+     * @param[in] value the new value.
+     * @return ErrorManagement::NoError if the name is a float64 scalar
+     * parameter of the table.
+     */
+    MARTe::ErrorManagement::ErrorType SetParameter(MARTe::StreamString name,
+                                                   MARTe::float64 value);
+
+private:
+    /**
+     * @brief Checks that a value can be written to a parameter.
+     * @param[in] index the index of the entry.
+     * @param[in] value the value.
+     * @return true if index is a parameter and value has its size.
+     */
+    bool CheckParameter(const MARTe::uint32 index,
+                        const MARTe::AnyType &value) const;
+
+    /**
+     * @brief Copies a value, already checked, in the model layout.
+     * @param[in] index the index of the parameter.
+     * @param[in] value the value.
+     * @param[out] destination where to copy the value.
+     * @return true if the value could be copied.
+     */
+    bool WriteParameter(const MARTe::uint32 index,
+                        const MARTe::AnyType &value,
+                        MARTe::char8 * const destination) const;
+
+    /**
+     * @brief Waits (sleeping) for any other update in progress or any
+     * update being applied by the real-time thread, which are both short.
+     */
+    void BeginUpdate();
+
+    /**
+     * @brief Ends an update.
+     * @param[in] commit if true the staged values are applied at the next
+     * cycle.
+     */
+    void EndUpdate(const bool commit);
+
+    /**
+     * @brief Copies the staged values to the model, if an update is
+     * pending. Called by the real-time thread at the beginning of each
+     * cycle.
+     */
+    void ApplyUpdate();
+
+    /**
+     * @brief Finds an entry of the table.
+     * @param[in] name the entry name.
+     * @param[in] kind the entry kind.
+     * @param[out] index the entry index.
+     * @return true if the entry exists.
+     */
+    bool FindEntry(const MARTe::char8 * const name,
+                   const MARTe::uint32 kind,
+                   MARTe::uint32 &index) const;
+
+    /**
+     * @brief Binds the signals of a direction to the ports.
+     * @param[in] direction InputSignals or OutputSignals.
+     * @param[out] addresses the model address of each signal.
+     * @param[out] sizes the size of a sample of each signal.
+     * @return true if all the signals are bound.
+     */
+    bool BindSignals(const MARTe::SignalDirection direction,
+                     void **&addresses,
+                     MARTe::uint32 *&sizes);
+
+    /**
+     * The model library.
+     */
+    MARTe::LoadableLibrary library;
+
+    /**
+     * The model instance.
+     */
+    void *model;
+
+    /**
+     * void <SymbolPrefix>_initialize(void *model).
+     */
+    void (*initializeFunction)(void *);
+
+    /**
+     * void <SymbolPrefix>_step(void *model).
+     */
+    void (*stepFunction)(void *);
+
+    /**
+     * void <SymbolPrefix>_terminate(void *model). May be NULL.
+     */
+    void (*terminateFunction)(void *);
+
+    /**
+     * The static table of the model instance.
+     */
+    SimulinkStaticTableEntry *table;
+
+    /**
+     * The number of entries of the table.
+     */
+    MARTe::uint32 numberOfEntries;
+
+    /**
+     * The staged values of the parameters.
+     */
+    MARTe::char8 *stagedValues;
+
+    /**
+     * The offset in stagedValues of each entry of the table.
+     */
+    MARTe::uint32 *stagedOffsets;
+
+    /**
+     * True for each entry whose staged value is to be applied.
+     */
+    bool *stagedChanged;
+
+    /**
+     * IDLE, PENDING, WRITING or APPLYING.
+     */
+    volatile MARTe::uint32 updateState;
+
+    /**
+     * The state before the update in progress.
+     */
+    MARTe::uint32 stateBeforeUpdate;
+
+    /**
+     * Filter of the registered methods.
+     */
+    MARTe::ReferenceT<MARTe::RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * The number of model steps in each cycle.
+     */
+    MARTe::uint32 numberOfSamples;
+
+    /**
+     * The model address of each input signal.
+     */
+    void **inputAddresses;
+
+    /**
+     * The size of a sample of each input signal.
+     */
+    MARTe::uint32 *inputSizes;
+
+    /**
+     * The model address of each output signal.
+     */
+    void **outputAddresses;
+
+    /**
+     * The size of a sample of each output signal.
+     */
+    MARTe::uint32 *outputSizes;
+
+    /**
+     * The GAM address of each input signal.
+     */
+    void **inputSignals;
+
+    /**
+     * The GAM address of each output signal.
+     */
+    void **outputSignals;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMS_SIMULINKSTATICWRAPPERGAM_SIMULINKSTATICWRAPPERGAM_H_ */
@@ -0,0 +1,668 @@
+/**
+ * @file CompiledStateMachine.cpp
+ * @brief Source file for class CompiledStateMachine
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CompiledStateMachine (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CompiledStateMachine.h"
+#include "CompiledStateMachineFilter.h"
+#include "HighResolutionTimer.h"
+#include "HotPathTrace.h"
+#include "ObjectRegistryDatabase.h"
+#include "QueuedMessageI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Name of the container of the Messages sent when entering a state.
+ */
+const MARTe::char8 * const COMPILED_STATE_MACHINE_ENTER = "ENTER";
+
+/**
+ * Default number of workers.
+ */
+const MARTe::uint32 COMPILED_STATE_MACHINE_DEFAULT_WORKERS = 2u;
+
+/**
+ * Period (ms) at which the idle workers check if they shall stop.
+ */
+const MARTe::uint32 COMPILED_STATE_MACHINE_WORKER_POLL = 100u;
+
+/**
+ * @brief Frees the actions of a transition.
+ */
+void FreeActions(MARTe2Tutorial::CompiledStateMachineTransition &transition) {
+    if (transition.actions != NULL_PTR(MARTe2Tutorial::CompiledStateMachineAction *)) {
+        delete[] transition.actions;
+        transition.actions = NULL_PTR(MARTe2Tutorial::CompiledStateMachineAction *);
+    }
+    transition.numberOfActions = 0u;
+}
+
+/**
+ * @brief Checks if the registered methods of a destination can be called
+ * directly, i.e. if it is a MessageI which executes its messages in the thread
+ * of the sender (a QueuedMessageI executes them in its own thread).
+ */
+bool IsDirectlyCallable(const MARTe::Reference &destination) {
+    using namespace MARTe;
+    bool callable = destination.IsValid();
+    if (callable) {
+        Object *object = destination.operator->();
+        callable = (dynamic_cast<MessageI *>(object) != NULL_PTR(MessageI *));
+        if (callable) {
+            callable = (dynamic_cast<QueuedMessageI *>(object) == NULL_PTR(QueuedMessageI *));
+        }
+    }
+    return callable;
+}
+
+/**
+ * @brief Checks if two destinations are the same object, or one is an
+ * ancestor of the other.
+ */
+bool IsSameObjectTree(const MARTe::char8 * const destination1,
+                      const MARTe::char8 * const destination2) {
+    using namespace MARTe;
+    uint32 length1 = StringHelper::Length(destination1);
+    uint32 length2 = StringHelper::Length(destination2);
+    uint32 shortest = (length1 < length2) ? (length1) : (length2);
+    bool same = (StringHelper::CompareN(destination1, destination2, shortest) == 0);
+    if ((same) && (length1 != length2)) {
+        //RTApp.Data is in RTApp, RTApp2 is not
+        char8 next = (length1 > length2) ? (destination1[shortest]) : (destination2[shortest]);
+        same = (next == '.');
+    }
+    return same;
+}
+
+/**
+ * @brief Converts a Timeout (ms, 0 = no limit).
+ */
+MARTe::TimeoutType ToTimeout(const MARTe::uint32 timeout) {
+    return (timeout == 0u) ? (MARTe::TTInfiniteWait) : (MARTe::TimeoutType(timeout));
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+CompiledStateMachine::CompiledStateMachine() :
+        MARTe::ReferenceContainer(), MARTe::EmbeddedServiceMethodBinderI(), MARTe::MessageI(), workers(*this) {
+    using namespace MARTe;
+    states = NULL_PTR(CompiledStateMachineState *);
+    numberOfStates = 0u;
+    currentState = 0u;
+    compiled = false;
+    directCalls = true;
+    numberOfWorkers = 0u;
+    wake = NULL_PTR(EventSem *);
+    jobs = NULL_PTR(CompiledStateMachineAction * volatile *);
+    jobTimeout = 0u;
+    pending = 0;
+    failures = 0;
+    numberOfTransitions = 0u;
+    lastTransitionTime = 0u;
+    maxTransitionTime = 0u;
+    (void) mux.Create();
+    (void) done.Create();
+
+    filter = ReferenceT<CompiledStateMachineFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetStateMachine(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
+}
+
+CompiledStateMachine::~CompiledStateMachine() {
+    using namespace MARTe;
+    if (states != NULL_PTR(CompiledStateMachineState *)) {
+        uint32 s;
+        for (s = 0u; s < numberOfStates; s++) {
+            uint32 t;
+            for (t = 0u; t < states[s].numberOfTransitions; t++) {
+                FreeActions(states[s].transitions[t]);
+            }
+            if (states[s].transitions != NULL_PTR(CompiledStateMachineTransition *)) {
+                delete[] states[s].transitions;
+            }
+            FreeActions(states[s].enter);
+        }
+        delete[] states;
+    }
+    if (wake != NULL_PTR(EventSem *)) {
+        uint32 w;
+        for (w = 0u; w < numberOfWorkers; w++) {
+            (void) wake[w].Close();
+        }
+        delete[] wake;
+    }
+    if (jobs != NULL_PTR(CompiledStateMachineAction * volatile *)) {
+        delete[] jobs;
+    }
+    (void) done.Close();
+    (void) mux.Close();
+}
+
+bool CompiledStateMachine::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = ReferenceContainer::Initialise(data);
+    if (ok) {
+        numberOfWorkers = COMPILED_STATE_MACHINE_DEFAULT_WORKERS;
+        (void) data.Read("NumberOfWorkers", numberOfWorkers);
+        uint32 directCallsIn = 1u;
+        (void) data.Read("DirectCalls", directCallsIn);
+        directCalls = (directCallsIn != 0u);
+    }
+    //The states are the ReferenceContainers which are not Messages
+    uint32 i;
+    for (i = 0u; (i < Size()) && (ok); i++) {
+        ReferenceT<ReferenceContainer> state = Get(i);
+        ReferenceT<Message> message = Get(i);
+        if ((state.IsValid()) && (!message.IsValid())) {
+            numberOfStates++;
+        }
+    }
+    if (ok) {
+        ok = (numberOfStates > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At least one state shall be defined");
+        }
+    }
+    if (ok) {
+        states = new CompiledStateMachineState[numberOfStates];
+    }
+    uint32 s = 0u;
+    for (i = 0u; (i < Size()) && (ok); i++) {
+        ReferenceT<ReferenceContainer> state = Get(i);
+        ReferenceT<Message> message = Get(i);
+        if ((state.IsValid()) && (!message.IsValid())) {
+            CompiledStateMachineState &compiledState = states[s];
+            compiledState.name = state->GetName();
+            compiledState.numberOfTransitions = 0u;
+            compiledState.transitions = NULL_PTR(CompiledStateMachineTransition *);
+            compiledState.enter.numberOfActions = 0u;
+            compiledState.enter.actions = NULL_PTR(CompiledStateMachineAction *);
+            compiledState.enter.timeout = 0u;
+            compiledState.enter.resolved = false;
+            uint32 e;
+            for (e = 0u; e < state->Size(); e++) {
+                ReferenceT<ReferenceContainer> event = state->Get(e);
+                if (event.IsValid()) {
+                    if (StringHelper::Compare(event->GetName(), COMPILED_STATE_MACHINE_ENTER) != 0) {
+                        compiledState.numberOfTransitions++;
+                    }
+                }
+            }
+            if (compiledState.numberOfTransitions > 0u) {
+                compiledState.transitions = new CompiledStateMachineTransition[compiledState.numberOfTransitions];
+            }
+            StreamString statePath;
+            ok = statePath.Printf("+%s", compiledState.name.Buffer());
+            if (ok) {
+                ok = data.MoveRelative(statePath.Buffer());
+            }
+            uint32 t = 0u;
+            for (e = 0u; (e < state->Size()) && (ok); e++) {
+                ReferenceT<ReferenceContainer> event = state->Get(e);
+                if (event.IsValid()) {
+                    if (StringHelper::Compare(event->GetName(), COMPILED_STATE_MACHINE_ENTER) == 0) {
+                        ok = ReadTransition(data, *(event.operator->()), compiledState.enter);
+                        compiledState.enter.nextState = s;
+                        compiledState.enter.errorState = s;
+                    }
+                    else {
+                        //The NextState and NextStateError are resolved once all the states are known
+                        ok = ReadTransition(data, *(event.operator->()), compiledState.transitions[t]);
+                        t++;
+                    }
+                }
+            }
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+            s++;
+        }
+    }
+    //Resolve the NextState and NextStateError now that all the states are known
+    for (s = 0u; (s < numberOfStates) && (ok); s++) {
+        StreamString statePath;
+        ok = statePath.Printf("+%s", states[s].name.Buffer());
+        if (ok) {
+            ok = data.MoveRelative(statePath.Buffer());
+        }
+        uint32 t;
+        for (t = 0u; (t < states[s].numberOfTransitions) && (ok); t++) {
+            CompiledStateMachineTransition &transition = states[s].transitions[t];
+            StreamString eventPath;
+            StreamString nextState;
+            StreamString errorState;
+            ok = eventPath.Printf("+%s", transition.event.Buffer());
+            if (ok) {
+                ok = data.MoveRelative(eventPath.Buffer());
+            }
+            if (ok) {
+                ok = data.Read("NextState", nextState);
+                if (!data.Read("NextStateError", errorState)) {
+                    errorState = nextState;
+                }
+                (void) data.MoveToAncestor(1u);
+            }
+            if (ok) {
+                ok = GetStateIndex(nextState, transition.nextState);
+                if (ok) {
+                    ok = GetStateIndex(errorState, transition.errorState);
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The NextState or NextStateError of %s.%s does not exist", states[s].name.Buffer(),
+                                 transition.event.Buffer());
+                }
+            }
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    //The workers
+    if ((ok) && (numberOfWorkers > 0u)) {
+        wake = new EventSem[numberOfWorkers];
+        jobs = new CompiledStateMachineAction * volatile[numberOfWorkers];
+        uint32 w;
+        for (w = 0u; (w < numberOfWorkers) && (ok); w++) {
+            ok = wake[w].Create();
+            if (ok) {
+                ok = wake[w].Reset();
+            }
+            jobs[w] = NULL_PTR(CompiledStateMachineAction *);
+        }
+        uint32 cpuMask = 0xffu;
+        (void) data.Read("CPUs", cpuMask);
+        if (ok) {
+            workers.SetName(GetName());
+            workers.SetNumberOfPoolThreads(numberOfWorkers);
+            workers.SetCPUMask(cpuMask);
+            ok = (workers.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the workers");
+            }
+        }
+    }
+    return ok;
+}
+
+bool CompiledStateMachine::ReadTransition(MARTe::StructuredDataI &data,
+                                          MARTe::ReferenceContainer &eventContainer,
+                                          CompiledStateMachineTransition &transition) {
+    using namespace MARTe;
+    transition.event = eventContainer.GetName();
+    transition.nextState = numberOfStates;
+    transition.errorState = numberOfStates;
+    transition.timeout = 0u;
+    transition.resolved = false;
+    transition.numberOfActions = 0u;
+    transition.actions = NULL_PTR(CompiledStateMachineAction *);
+    StreamString eventPath;
+    bool ok = eventPath.Printf("+%s", transition.event.Buffer());
+    if (ok) {
+        ok = data.MoveRelative(eventPath.Buffer());
+    }
+    if (ok) {
+        (void) data.Read("Timeout", transition.timeout);
+    }
+    uint32 m;
+    for (m = 0u; m < eventContainer.Size(); m++) {
+        ReferenceT<Message> message = eventContainer.Get(m);
+        if (message.IsValid()) {
+            transition.numberOfActions++;
+        }
+    }
+    if ((ok) && (transition.numberOfActions > 0u)) {
+        transition.actions = new CompiledStateMachineAction[transition.numberOfActions];
+        uint32 a = 0u;
+        for (m = 0u; (m < eventContainer.Size()) && (ok); m++) {
+            ReferenceT<Message> message = eventContainer.Get(m);
+            if (message.IsValid()) {
+                StreamString messagePath;
+                uint32 concurrent = 0u;
+                ok = messagePath.Printf("+%s", message->GetName());
+                if (ok) {
+                    ok = data.MoveRelative(messagePath.Buffer());
+                }
+                if (ok) {
+                    (void) data.Read("Concurrent", concurrent);
+                    ok = data.MoveToAncestor(1u);
+                }
+                transition.actions[a].message = message;
+                transition.actions[a].direct = false;
+                transition.actions[a].concurrent = (concurrent != 0u);
+                transition.actions[a].stage = a;
+                a++;
+            }
+        }
+    }
+    if (ok) {
+        ok = data.MoveToAncestor(1u);
+    }
+    return ok;
+}
+
+bool CompiledStateMachine::GetStateIndex(const MARTe::StreamString &name,
+                                         MARTe::uint32 &idx) const {
+    using namespace MARTe;
+    bool found = false;
+    uint32 s;
+    for (s = 0u; (s < numberOfStates) && (!found); s++) {
+        found = (states[s].name == name);
+        if (found) {
+            idx = s;
+        }
+    }
+    return found;
+}
+
+bool CompiledStateMachine::CompileTables() {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 s;
+    for (s = 0u; s < numberOfStates; s++) {
+        uint32 t;
+        for (t = 0u; t < states[s].numberOfTransitions; t++) {
+            //Go on, so that all the missing destinations are reported
+            if (!CompileTransition(states[s].transitions[t])) {
+                ok = false;
+            }
+        }
+        if (!CompileTransition(states[s].enter)) {
+            ok = false;
+        }
+    }
+    compiled = true;
+    return ok;
+}
+
+bool CompiledStateMachine::CompileTransition(CompiledStateMachineTransition &transition) {
+    using namespace MARTe;
+    bool ok = true;
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    uint32 stage = 0u;
+    uint32 stageStart = 0u;
+    uint32 a;
+    for (a = 0u; a < transition.numberOfActions; a++) {
+        CompiledStateMachineAction &action = transition.actions[a];
+        ReferenceT<Message> message = action.message;
+        action.function = message->GetFunction().GetList();
+        action.destination = ord->Find(message->GetDestination().GetList());
+        action.parameters = message->Get(0u);
+        action.direct = ((directCalls) && (message->ExpectsReply()) && (IsDirectlyCallable(action.destination)));
+        if (!action.destination.IsValid()) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The destination %s of %s does not exist", message->GetDestination().GetList(),
+                         message->GetName());
+            ok = false;
+        }
+        //Only a Concurrent message joins the group, unless the group already uses its destination
+        bool join = ((a > 0u) && (action.concurrent));
+        uint32 previous;
+        for (previous = stageStart; (previous < a) && (join); previous++) {
+            join = !IsSameObjectTree(transition.actions[previous].message->GetDestination().GetList(), message->GetDestination().GetList());
+        }
+        if ((a > 0u) && (!join)) {
+            stage++;
+            stageStart = a;
+        }
+        action.stage = stage;
+    }
+    transition.resolved = ok;
+    return ok;
+}
+
+void CompiledStateMachine::Purge(MARTe::ReferenceContainer &purgeList) {
+    using namespace MARTe;
+    if (numberOfWorkers > 0u) {
+        if (workers.Stop() != ErrorManagement::NoError) {
+            if (workers.Stop() != ErrorManagement::NoError) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop MultiThreadService.");
+            }
+        }
+    }
+    (void) RemoveMessageFilter(filter);
+    ReferenceContainer::Purge(purgeList);
+}
+
+bool CompiledStateMachine::ExportData(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = Object::ExportData(data);
+    (void) mux.Lock();
+    if (ok) {
+        ok = data.Write("CurrentState", states[currentState].name.Buffer());
+    }
+    if (ok) {
+        ok = data.Write("Transitions", numberOfTransitions);
+    }
+    if (ok) {
+        ok = data.Write("LastTransitionTime", lastTransitionTime);
+    }
+    if (ok) {
+        ok = data.Write("MaxTransitionTime", maxTransitionTime);
+    }
+    (void) mux.UnLock();
+    return ok;
+}
+
+MARTe::ErrorManagement::ErrorType CompiledStateMachine::Trigger(const MARTe::char8 * const event) {
+    using namespace MARTe;
+    HOT_PATH_TRACE_BEGIN("CompiledStateMachine::Trigger");
+    ErrorManagement::ErrorType err;
+    (void) mux.Lock();
+    if (!compiled) {
+        //No Compile message was received: resolve the destinations now
+        (void) CompileTables();
+    }
+    uint64 start = HighResolutionTimer::Counter();
+    uint32 previousState = currentState;
+    CompiledStateMachineTransition *transition = NULL_PTR(CompiledStateMachineTransition *);
+    if (err.ErrorsCleared()) {
+        uint32 t;
+        for (t = 0u; (t < states[currentState].numberOfTransitions) && (transition == NULL_PTR(CompiledStateMachineTransition *)); t++) {
+            if (states[currentState].transitions[t].event == event) {
+                transition = &states[currentState].transitions[t];
+            }
+        }
+        err.illegalOperation = (transition == NULL_PTR(CompiledStateMachineTransition *));
+    }
+    if (err.ErrorsCleared()) {
+        //The missing destinations may have been created since the last compilation
+        CompiledStateMachineTransition &enter = states[transition->nextState].enter;
+        if (!transition->resolved) {
+            (void) CompileTransition(*transition);
+        }
+        if (!enter.resolved) {
+            (void) CompileTransition(enter);
+        }
+        err.initialisationError = ((!transition->resolved) || (!enter.resolved));
+    }
+    if (err.ErrorsCleared()) {
+        bool ok = RunActions(*transition);
+        currentState = (ok) ? (transition->nextState) : (transition->errorState);
+        err.fatalError = !ok;
+        if (!RunActions(states[currentState].enter)) {
+            err.fatalError = true;
+        }
+        numberOfTransitions++;
+        lastTransitionTime = static_cast<uint32>(static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period() * 1e6);
+        if (lastTransitionTime > maxTransitionTime) {
+            maxTransitionTime = lastTransitionTime;
+        }
+    }
+    uint32 transitionTime = lastTransitionTime;
+    (void) mux.UnLock();
+    HOT_PATH_TRACE_END("CompiledStateMachine::Trigger");
+    if (err.illegalOperation) {
+        REPORT_ERROR(ErrorManagement::IllegalOperation, "Event %s not accepted in state %s", event, states[previousState].name.Buffer());
+    }
+    else if (err.initialisationError) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Event %s refused in state %s: not all its destinations exist", event,
+                     states[previousState].name.Buffer());
+    }
+    else if (err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::Information, "%s: %s -> %s in %d us", event, states[previousState].name.Buffer(), states[currentState].name.Buffer(),
+                     transitionTime);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "%s: %s -> %s (error) in %d us", event, states[previousState].name.Buffer(),
+                     states[currentState].name.Buffer(), transitionTime);
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType CompiledStateMachine::Compile() {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    (void) mux.Lock();
+    err.initialisationError = !CompileTables();
+    (void) mux.UnLock();
+    if (err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::Information, "The destinations of the %d states are resolved", numberOfStates);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Not all the destinations exist: the events which use them are refused");
+    }
+    return err;
+}
+
+const MARTe::char8 *CompiledStateMachine::GetCurrentState() const {
+    return states[currentState].name.Buffer();
+}
+
+bool CompiledStateMachine::RunActions(CompiledStateMachineTransition &transition) {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 first = 0u;
+    while ((first < transition.numberOfActions) && (ok)) {
+        uint32 end = first + 1u;
+        while ((end < transition.numberOfActions) && (transition.actions[end].stage == transition.actions[first].stage)) {
+            end++;
+        }
+        //All but the first action of the stage go to the workers, if any is free
+        uint32 dispatched = end - first - 1u;
+        if (dispatched > numberOfWorkers) {
+            dispatched = numberOfWorkers;
+        }
+        if (dispatched > 0u) {
+            jobTimeout = transition.timeout;
+            __atomic_store_n(&pending, static_cast<int32>(dispatched), __ATOMIC_RELEASE);
+            __atomic_store_n(&failures, 0, __ATOMIC_RELEASE);
+            (void) done.Reset();
+            uint32 w;
+            for (w = 0u; w < dispatched; w++) {
+                jobs[w] = &transition.actions[first + 1u + w];
+                (void) wake[w].Post();
+            }
+        }
+        ok = RunAction(transition.actions[first], transition.timeout);
+        uint32 a;
+        for (a = first + 1u + dispatched; a < end; a++) {
+            if (!RunAction(transition.actions[a], transition.timeout)) {
+                ok = false;
+            }
+        }
+        if (dispatched > 0u) {
+            if (done.Wait(TTInfiniteWait) != ErrorManagement::NoError) {
+                ok = false;
+            }
+            if (__atomic_load_n(&failures, __ATOMIC_ACQUIRE) > 0) {
+                ok = false;
+            }
+        }
+        first = end;
+    }
+    return ok;
+}
+
+bool CompiledStateMachine::RunAction(CompiledStateMachineAction &action,
+                                     const MARTe::uint32 timeout) {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    if (action.direct) {
+        Object *destination = action.destination.operator->();
+        if (action.parameters.IsValid()) {
+            err = destination->CallRegisteredMethod<StructuredDataI &>(action.function.Buffer(), *(action.parameters.operator->()));
+        }
+        else {
+            err = destination->CallRegisteredMethod(action.function.Buffer());
+        }
+        if (err.unsupportedFeature) {
+            //Not a registered method: from now on go through its message filters
+            action.direct = false;
+        }
+    }
+    if (!action.direct) {
+        action.message->SetAsReply(false);
+        if (action.message->ExpectsReply()) {
+            err = MessageI::SendMessageAndWaitReply(action.message, this, ToTimeout(timeout));
+        }
+        else {
+            err = MessageI::SendMessage(action.message, this);
+        }
+    }
+    if (!err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "%s of %s failed", action.function.Buffer(), action.message->GetDestination().GetList());
+    }
+    return err.ErrorsCleared();
+}
+
+MARTe::ErrorManagement::ErrorType CompiledStateMachine::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint32 w = info.GetThreadNumber();
+        if (w < numberOfWorkers) {
+            if (wake[w].Wait(TimeoutType(COMPILED_STATE_MACHINE_WORKER_POLL)) == ErrorManagement::NoError) {
+                (void) wake[w].Reset();
+                CompiledStateMachineAction *job = jobs[w];
+                jobs[w] = NULL_PTR(CompiledStateMachineAction *);
+                if (job != NULL_PTR(CompiledStateMachineAction *)) {
+                    if (!RunAction(*job, jobTimeout)) {
+                        (void) __atomic_add_fetch(&failures, 1, __ATOMIC_ACQ_REL);
+                    }
+                    if (__atomic_sub_fetch(&pending, 1, __ATOMIC_ACQ_REL) == 0) {
+                        (void) done.Post();
+                    }
+                }
+            }
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+CLASS_REGISTER(CompiledStateMachine, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,443 @@
+/**
+ * @file CompiledStateMachine.h
+ * @brief Header file for class CompiledStateMachine
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * CompiledStateMachine with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef INTERFACES_COMPILEDSTATEMACHINE_COMPILEDSTATEMACHINE_H_
+#define INTERFACES_COMPILEDSTATEMACHINE_COMPILEDSTATEMACHINE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "Message.h"
+#include "MessageI.h"
+#include "MultiThreadService.h"
+#include "MutexSem.h"
+#include "ReferenceContainer.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+class CompiledStateMachineFilter;
+
+/**
+ * @brief A Message of a transition, with its destination resolved.
+ */
+struct CompiledStateMachineAction {
+    /**
+     * The Message declared in the configuration (reused at every transition).
+     */
+    MARTe::ReferenceT<MARTe::Message> message;
+
+    /**
+     * The Destination of the message.
+     */
+    MARTe::Reference destination;
+
+    /**
+     * The +Parameters of the message (may be invalid).
+     */
+    MARTe::ReferenceT<MARTe::StructuredDataI> parameters;
+
+    /**
+     * The Function of the message.
+     */
+    MARTe::StreamString function;
+
+    /**
+     * True if the Function is called directly on the destination.
+     */
+    bool direct;
+
+    /**
+     * True if the action may be executed concurrently with the previous ones.
+     */
+    bool concurrent;
+
+    /**
+     * The actions with the same stage are executed concurrently.
+     */
+    MARTe::uint32 stage;
+};
+
+/**
+ * @brief A row of the transition table.
+ */
+struct CompiledStateMachineTransition {
+    /**
+     * The name of the event.
+     */
+    MARTe::StreamString event;
+
+    /**
+     * The index of the NextState.
+     */
+    MARTe::uint32 nextState;
+
+    /**
+     * The index of the NextStateError.
+     */
+    MARTe::uint32 errorState;
+
+    /**
+     * Maximum time (ms) given to each action (0 = no limit).
+     */
+    MARTe::uint32 timeout;
+
+    /**
+     * True if the destinations of all the actions exist.
+     */
+    bool resolved;
+
+    /**
+     * The number of actions.
+     */
+    MARTe::uint32 numberOfActions;
+
+    /**
+     * The actions, in the declared order.
+     */
+    CompiledStateMachineAction *actions;
+};
+
+/**
+ * @brief A state and its transitions.
+ */
+struct CompiledStateMachineState {
+    /**
+     * The name of the state.
+     */
+    MARTe::StreamString name;
+
+    /**
+     * The number of events accepted in the state.
+     */
+    MARTe::uint32 numberOfTransitions;
+
+    /**
+     * The transitions.
+     */
+    CompiledStateMachineTransition *transitions;
+
+    /**
+     * The actions executed when entering the state (ENTER).
+     */
+    CompiledStateMachineTransition enter;
+};
+
+/**
+ * @brief A StateMachine which compiles its states and events into a
+ * transition table.
+ *
+ * @details The configuration is the one of the MARTe StateMachine: each
+ * ReferenceContainer child is a state, whose StateMachineEvent children are
+ * the accepted events, with their NextState, NextStateError, Timeout (ms,
+ * 0 = no limit) and the Messages to send. An ENTER ReferenceContainer holds
+ * the Messages sent when the state is entered. The first state is the
+ * initial state. Replacing Class = StateMachine by
+ * Class = CompiledStateMachine is thus enough.
+ *
+ * The names of the states are resolved when the object is initialised. The
+ * destinations of all the Messages are resolved once all the objects exist,
+ * when a message with Function = Compile is received or, failing that,
+ * before the first event is executed. A missing destination is then reported
+ * as an error. An event whose Messages, or the ENTER Messages of whose
+ * NextState, have a missing destination is refused (the other events are
+ * executed) until these destinations exist. From then on, a transition does
+ * no lookup by path and no allocation:
+ *  - the Messages which expect a reply, to a MessageI which is not a
+ *    QueuedMessageI, call their Function directly on the resolved
+ *    destination, with the preallocated +Parameters (the same synchronous
+ *    semantics, without the message round trip). The Function is then
+ *    executed by the thread of the sender or by a worker, and the message
+ *    filters of the destination only see the Functions which are not
+ *    registered methods. The other Messages, and all of them if
+ *    DirectCalls = 0, are sent as usual;
+ *  - the Messages are executed in the declared order. A Message with
+ *    Concurrent = 1 is executed, by a pool of NumberOfWorkers threads,
+ *    concurrently with the previous Messages of its group (the group of a
+ *    Message without Concurrent starts with it). A Concurrent Message whose
+ *    destination is the destination of a Message of the group, or one of its
+ *    ancestors or descendants (e.g. RTApp and RTApp.Data.Writer), starts a
+ *    new group, which waits for the previous one, so that the order of the
+ *    Messages to the same object is kept.
+ *
+ * If any Message fails the machine goes to the NextStateError. Compile is
+ * reserved and shall not be the name of an event.
+ *
+ * The events are processed in the thread of the sender, as soon as they are
+ * received. The duration of each transition (from the receipt of the event
+ * until the ENTER Messages of the new state are executed) is reported and
+ * exported as LastTransitionTime and MaxTransitionTime (us).
+ *
+ * <pre>
+ * +StateMachine = {
+ *     Class = CompiledStateMachine
+ *     NumberOfWorkers = 2 //Optional. Threads executing the concurrent Messages (0 = none). Default = 2.
+ *     CPUs = 0x1 //Optional. Affinity of the workers. Default = 0xff.
+ *     DirectCalls = 1 //Optional. Call the Functions directly. Default = 1.
+ *     +INITIAL = {
+ *         Class = ReferenceContainer
+ *         +START = {
+ *             Class = StateMachineEvent
+ *             NextState = IDLE
+ *             NextStateError = ERROR
+ *             Timeout = 0
+ *             +PrepareChangeToIdleMsg = {
+ *                 Class = Message
+ *                 Destination = RTApp
+ *                 Mode = ExpectsReply
+ *                 Function = PrepareNextState
+ *                 +Parameters = {
+ *                     Class = ConfigurationDatabase
+ *                     param1 = Idle
+ *                 }
+ *             }
+ *             +OpenTreeMsg = {
+ *                 Class = Message
+ *                 Destination = Writer
+ *                 Mode = ExpectsReply
+ *                 Function = OpenTree
+ *                 Concurrent = 1 //Optional. Executed concurrently with the previous Messages. Default = 0.
+ *             }
+ *             ...
+ *         }
+ *     }
+ *     ...
+ * }
+ * </pre>
+ */
+class CompiledStateMachine : public MARTe::ReferenceContainer,
+        public MARTe::EmbeddedServiceMethodBinderI,
+        public MARTe::MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the CompiledStateMachineFilter.
+     */
+    CompiledStateMachine();
+
+    /**
+     * @brief Destructor. Frees the transition table.
+     */
+    virtual ~CompiledStateMachine();
+
+    /**
+     * @brief Creates the states, events and Messages, builds the transition
+     * table and starts the workers.
+     * @param[in] data see ReferenceContainer::Initialise.
+     * @return true if there is at least one state and all the NextState and
+     * NextStateError exist.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Stops the workers and removes the message filter.
+     * @details See ReferenceContainer::Purge
+     */
+    virtual void Purge(MARTe::ReferenceContainer &purgeList);
+
+    /**
+     * @brief Exports the CurrentState, the number of Transitions and the
+     * LastTransitionTime and MaxTransitionTime (us).
+     * @param[out] data where to export.
+     * @return true if the data could be written.
+     */
+    virtual bool ExportData(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Executes the transition of an event from the current state.
+     * @param[in] event the name of the event.
+     * @return ErrorManagement::NoError if the event is accepted in the
+     * current state and all its Messages succeeded.
+     */
+    MARTe::ErrorManagement::ErrorType Trigger(const MARTe::char8 * const event);
+
+    /**
+     * @brief Resolves the destinations and assigns the stages of the actions
+     * of all the transitions.
+     * @return ErrorManagement::NoError if all the destinations exist.
+     */
+    MARTe::ErrorManagement::ErrorType Compile();
+
+    /**
+     * @brief Gets the name of the current state.
+     * @return the name of the current state.
+     */
+    const MARTe::char8 *GetCurrentState() const;
+
+    /**
+     * @brief Executes the actions dispatched to a worker.
+     * @param[in] info see EmbeddedServiceMethodBinderI::Execute.
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+private:
+    /**
+     * @brief Reads the Timeout and the Messages of an event.
+     * @return true if the event is well defined.
+     */
+    bool ReadTransition(MARTe::StructuredDataI &data,
+                        MARTe::ReferenceContainer &eventContainer,
+                        CompiledStateMachineTransition &transition);
+
+    /**
+     * @brief Gets the index of a state.
+     * @return true if the state exists.
+     */
+    bool GetStateIndex(const MARTe::StreamString &name,
+                       MARTe::uint32 &idx) const;
+
+    /**
+     * @brief Compiles all the transitions. The mux shall be locked.
+     * @return true if the destinations of all the transitions exist.
+     */
+    bool CompileTables();
+
+    /**
+     * @brief Resolves the destinations and assigns the stages of the actions
+     * of a transition.
+     * @return true if all the destinations exist.
+     */
+    bool CompileTransition(CompiledStateMachineTransition &transition);
+
+    /**
+     * @brief Executes the actions of a transition, stage by stage.
+     * @return true if all the actions succeeded.
+     */
+    bool RunActions(CompiledStateMachineTransition &transition);
+
+    /**
+     * @brief Executes an action.
+     * @return true if the action succeeded.
+     */
+    bool RunAction(CompiledStateMachineAction &action,
+                   const MARTe::uint32 timeout);
+
+    /**
+     * The states.
+     */
+    CompiledStateMachineState *states;
+
+    /**
+     * The number of states.
+     */
+    MARTe::uint32 numberOfStates;
+
+    /**
+     * The index of the current state.
+     */
+    MARTe::uint32 currentState;
+
+    /**
+     * True once the transitions are compiled.
+     */
+    bool compiled;
+
+    /**
+     * Call the Functions of the destinations which allow it directly.
+     */
+    bool directCalls;
+
+    /**
+     * Serialises the transitions.
+     */
+    MARTe::MutexSem mux;
+
+    /**
+     * The workers.
+     */
+    MARTe::MultiThreadService workers;
+
+    /**
+     * The number of workers.
+     */
+    MARTe::uint32 numberOfWorkers;
+
+    /**
+     * Posted when an action is dispatched to a worker.
+     */
+    MARTe::EventSem *wake;
+
+    /**
+     * The action dispatched to each worker.
+     */
+    CompiledStateMachineAction * volatile *jobs;
+
+    /**
+     * The timeout of the dispatched actions.
+     */
+    MARTe::uint32 jobTimeout;
+
+    /**
+     * Number of dispatched actions not yet completed.
+     */
+    volatile MARTe::int32 pending;
+
+    /**
+     * Number of dispatched actions which failed.
+     */
+    volatile MARTe::int32 failures;
+
+    /**
+     * Posted when the last dispatched action completes.
+     */
+    MARTe::EventSem done;
+
+    /**
+     * Number of executed transitions.
+     */
+    MARTe::uint32 numberOfTransitions;
+
+    /**
+     * Duration (us) of the last transition.
+     */
+    MARTe::uint32 lastTransitionTime;
+
+    /**
+     * Maximum duration (us) of a transition.
+     */
+    MARTe::uint32 maxTransitionTime;
+
+    /**
+     * The message filter.
+     */
+    MARTe::ReferenceT<CompiledStateMachineFilter> filter;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_COMPILEDSTATEMACHINE_COMPILEDSTATEMACHINE_H_ */
@@ -0,0 +1,90 @@
+/**
+ * @file CompiledStateMachineFilter.cpp
+ * @brief Source file for class CompiledStateMachineFilter
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CompiledStateMachineFilter (public, protected, and private). Be
+ * aware that some methods, such as those inline could be defined on the
+ * header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CompiledStateMachine.h"
+#include "CompiledStateMachineFilter.h"
+#include "MessageI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Function of the message which resolves the destinations.
+ */
+const MARTe::char8 * const COMPILED_STATE_MACHINE_FILTER_COMPILE = "Compile";
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+CompiledStateMachineFilter::CompiledStateMachineFilter() :
+        MARTe::MessageFilter(true) {
+    machine = NULL_PTR(CompiledStateMachine *);
+}
+
+CompiledStateMachineFilter::~CompiledStateMachineFilter() {
+}
+
+void CompiledStateMachineFilter::SetStateMachine(CompiledStateMachine * const machineIn) {
+    machine = machineIn;
+}
+
+MARTe::ErrorManagement::ErrorType CompiledStateMachineFilter::ConsumeMessage(MARTe::ReferenceT<MARTe::Message> &messageToTest) {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    err.fatalError = (machine == NULL_PTR(CompiledStateMachine *));
+    if (err.ErrorsCleared()) {
+        const char8 * const function = messageToTest->GetFunction().GetList();
+        if (StringHelper::Compare(function, COMPILED_STATE_MACHINE_FILTER_COMPILE) == 0) {
+            err = machine->Compile();
+        }
+        else {
+            err = machine->Trigger(function);
+        }
+    }
+    if (messageToTest->ExpectsReply()) {
+        messageToTest->SetAsReply(true);
+        if (messageToTest->ExpectsIndirectReply()) {
+            ErrorManagement::ErrorType replyErr = MessageI::SendMessage(messageToTest, machine);
+            if (!replyErr.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::CommunicationError, "Could not send the indirect reply");
+            }
+        }
+    }
+    return err;
+}
+
+CLASS_REGISTER(CompiledStateMachineFilter, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,93 @@
+/**
+ * @file CompiledStateMachineFilter.h
+ * @brief Header file for class CompiledStateMachineFilter
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * CompiledStateMachineFilter with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef INTERFACES_COMPILEDSTATEMACHINE_COMPILEDSTATEMACHINEFILTER_H_
+#define INTERFACES_COMPILEDSTATEMACHINE_COMPILEDSTATEMACHINEFILTER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Message.h"
+#include "MessageFilter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+class CompiledStateMachine;
+
+/**
+ * @brief Delivers every message received by a CompiledStateMachine as an
+ * event, the Function of the message being the name of the event.
+ *
+ * @details The event is processed in the thread of the sender. A message
+ * with Function = Compile resolves the destinations instead (see
+ * CompiledStateMachine::Compile). The message is then marked as a reply (and sent back if it expects an indirect reply).
+ */
+class CompiledStateMachineFilter : public MARTe::MessageFilter {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Permanent filter.
+     */
+    CompiledStateMachineFilter();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~CompiledStateMachineFilter();
+
+    /**
+     * @brief Sets the CompiledStateMachine which processes the events.
+     * @param[in] machineIn the CompiledStateMachine.
+     */
+    void SetStateMachine(CompiledStateMachine * const machineIn);
+
+    /**
+     * @brief Triggers the event named by the Function of the message, or
+     * compiles the machine if the Function is Compile.
+     * @param[in] messageToTest the message.
+     * @return the result of CompiledStateMachine::Trigger or
+     * CompiledStateMachine::Compile.
+     */
+    virtual MARTe::ErrorManagement::ErrorType ConsumeMessage(MARTe::ReferenceT<MARTe::Message> &messageToTest);
+
+private:
+    /**
+     * The CompiledStateMachine which processes the events.
+     */
+    CompiledStateMachine *machine;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_COMPILEDSTATEMACHINE_COMPILEDSTATEMACHINEFILTER_H_ */
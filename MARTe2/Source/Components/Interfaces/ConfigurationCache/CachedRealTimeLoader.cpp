@@ -0,0 +1,256 @@
+/**
+ * @file CachedRealTimeLoader.cpp
+ * @brief Source file for class CachedRealTimeLoader
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CachedRealTimeLoader (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CachedRealTimeLoader.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
+#include "Message.h"
+#include "MessageI.h"
+#include "ObjectRegistryDatabase.h"
+#include "ParallelObjectBuilder.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Environment variable with the cache directory.
+ */
+const MARTe::char8 * const CACHED_REAL_TIME_LOADER_ENV = "MARTe2_CONFIG_CACHE";
+
+/**
+ * Environment variable with the number of InitialiseWorkers.
+ */
+const MARTe::char8 * const CACHED_REAL_TIME_LOADER_WORKERS_ENV = "MARTe2_INITIALISE_WORKERS";
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+CachedRealTimeLoader::CachedRealTimeLoader() :
+        MARTe::Loader() {
+}
+
+CachedRealTimeLoader::~CachedRealTimeLoader() {
+}
+
+MARTe::ErrorManagement::ErrorType CachedRealTimeLoader::Configure(MARTe::StructuredDataI &data,
+                                                                  MARTe::StreamI &configuration) {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    StreamString parserType;
+    if (!data.Read("Parser", parserType)) {
+        parserType = "cfg";
+    }
+    if (!data.Read("FirstState", firstState)) {
+        firstState = "";
+    }
+    if (!data.Read("MessageDestination", messageDestination)) {
+        messageDestination = "";
+    }
+    if (!data.Read("MessageFunction", messageFunction)) {
+        messageFunction = "";
+    }
+    StreamString cacheDirectory;
+    if (!data.Read("CacheDirectory", cacheDirectory)) {
+        const char8 * const directory = getenv(CACHED_REAL_TIME_LOADER_ENV);
+        if (directory != NULL_PTR(const char8 *)) {
+            cacheDirectory = directory;
+        }
+        else if (!ConfigurationCache::GetDefaultDirectory(cacheDirectory)) {
+            cacheDirectory = "";
+        }
+    }
+    uint32 initialiseWorkers = 0u;
+    if (!data.Read("InitialiseWorkers", initialiseWorkers)) {
+        const char8 * const workers = getenv(CACHED_REAL_TIME_LOADER_WORKERS_ENV);
+        if (workers != NULL_PTR(const char8 *)) {
+            initialiseWorkers = static_cast<uint32>(strtoul(workers, NULL_PTR(char8 **), 10));
+        }
+    }
+    if (parserType != "cfg") {
+        REPORT_ERROR(ErrorManagement::Information, "Only the cfg syntax is cached, the %s configuration is parsed", parserType.Buffer());
+        err = Loader::Configure(data, configuration);
+    }
+    else {
+        uint64 start = HighResolutionTimer::Counter();
+        uint32 size = static_cast<uint32>(configuration.Size());
+        char8 *text = new char8[size + 1u];
+        err.fatalError = !configuration.Seek(0u);
+        if (err.ErrorsCleared()) {
+            uint32 readSize = size;
+            err.fatalError = !configuration.Read(text, readSize);
+            if (err.ErrorsCleared()) {
+                err.fatalError = (readSize != size);
+            }
+        }
+        text[size] = '\0';
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not read the configuration");
+        }
+        uint64 hash = ConfigurationCache::Hash(text, size);
+        bool useCache = (cacheDirectory.Size() > 0u);
+        if (useCache) {
+            useCache = ConfigurationCache::PrepareDirectory(cacheDirectory.Buffer());
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Warning, "No CacheDirectory and neither XDG_CACHE_HOME nor HOME are set, the configuration is not cached");
+        }
+        StreamString fileName;
+        if ((err.ErrorsCleared()) && (useCache)) {
+            err.fatalError = !ConfigurationCache::GetFileName(cacheDirectory.Buffer(), hash, fileName);
+        }
+        ConfigurationDatabase cdb;
+        bool cached = false;
+        if ((err.ErrorsCleared()) && (useCache)) {
+            cached = ConfigurationCache::Load(fileName.Buffer(), hash, cdb);
+        }
+        if ((err.ErrorsCleared()) && (!cached)) {
+            StreamString textStream = text;
+            (void) textStream.Seek(0u);
+            StreamString parserErrors;
+            StandardParser parser(textStream, cdb, &parserErrors);
+            err.parametersError = !parser.Parse();
+            if ((err.ErrorsCleared()) && (useCache)) {
+                //A cache which cannot be written only costs the next start a parse
+                if (!ConfigurationCache::Compile(cdb, hash, fileName.Buffer())) {
+                    REPORT_ERROR(ErrorManagement::Warning, "Could not cache the configuration in %s", fileName.Buffer());
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Could not parse the configuration: %s", parserErrors.Buffer());
+            }
+        }
+        delete[] text;
+        uint32 elapsed = static_cast<uint32>(static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period() * 1e6);
+        if (err.ErrorsCleared()) {
+            if (useCache) {
+                REPORT_ERROR(ErrorManagement::Information, "Configuration %s %s in %d us", (cached ? "loaded from" : "parsed and cached in"), fileName.Buffer(),
+                             elapsed);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Information, "Configuration parsed in %d us", elapsed);
+            }
+            err.fatalError = !cdb.MoveToRoot();
+        }
+        if ((err.ErrorsCleared()) && (initialiseWorkers > 0u)) {
+            ParallelObjectBuilder builder;
+            err.initialisationError = !builder.Build(cdb, *ObjectRegistryDatabase::Instance(), initialiseWorkers);
+            if (!err.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Could not create the objects");
+            }
+        }
+        else if (err.ErrorsCleared()) {
+            err.initialisationError = !ObjectRegistryDatabase::Instance()->Initialise(cdb);
+            if (!err.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Could not create the objects");
+            }
+        }
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    uint32 i;
+    for (i = 0u; (i < ord->Size()) && (err.ErrorsCleared()); i++) {
+        ReferenceT<RealTimeApplication> application = ord->Get(i);
+        if (application.IsValid()) {
+            err.initialisationError = !application->ConfigureApplication();
+            if (!err.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Could not configure %s", application->GetName());
+            }
+        }
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType CachedRealTimeLoader::Start() {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (firstState.Size() > 0u) {
+        uint32 i;
+        for (i = 0u; (i < ord->Size()) && (err.ErrorsCleared()); i++) {
+            ReferenceT<RealTimeApplication> application = ord->Get(i);
+            if (application.IsValid()) {
+                err = application->PrepareNextState(firstState);
+                if (err.ErrorsCleared()) {
+                    err = application->StartNextStateExecution();
+                }
+                if (!err.ErrorsCleared()) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not start %s in %s", application->GetName(), firstState.Buffer());
+                }
+            }
+        }
+    }
+    else if ((messageDestination.Size() > 0u) && (messageFunction.Size() > 0u)) {
+        ConfigurationDatabase cdb;
+        err.fatalError = !cdb.Write("Destination", messageDestination.Buffer());
+        if (err.ErrorsCleared()) {
+            err.fatalError = !cdb.Write("Function", messageFunction.Buffer());
+        }
+        ReferenceT<Message> message(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        if (err.ErrorsCleared()) {
+            err.fatalError = !message->Initialise(cdb);
+        }
+        if (err.ErrorsCleared()) {
+            err = MessageI::SendMessage(message, this);
+        }
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not send %s to %s", messageFunction.Buffer(), messageDestination.Buffer());
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "Neither a FirstState nor a start message were given");
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType CachedRealTimeLoader::Stop() {
+    using namespace MARTe;
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    uint32 i;
+    for (i = 0u; i < ord->Size(); i++) {
+        ReferenceT<RealTimeApplication> application = ord->Get(i);
+        if (application.IsValid()) {
+            //Not an error if it is not running
+            (void) application->StopCurrentStateExecution();
+        }
+    }
+    return Loader::Stop();
+}
+
+CLASS_REGISTER(CachedRealTimeLoader, "")
+} // namespace MARTe2Tutorial
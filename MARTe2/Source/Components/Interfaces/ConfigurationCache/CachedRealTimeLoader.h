@@ -0,0 +1,137 @@
+/**
+ * @file CachedRealTimeLoader.h
+ * @brief Header file for class CachedRealTimeLoader
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * CachedRealTimeLoader with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef INTERFACES_CONFIGURATIONCACHE_CACHEDREALTIMELOADER_H_
+#define INTERFACES_CONFIGURATIONCACHE_CACHEDREALTIMELOADER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Loader.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+/**
+ * @brief A RealTimeLoader which loads the configuration from a binary image
+ * (see ConfigurationCache) instead of parsing it, when the image exists.
+ *
+ * @details The image is looked up by the hash of the configuration text in
+ * the cache directory. If it does not exist (or is not valid) the text is
+ * parsed with the StandardParser and the image is written, so that the
+ * next start with the same text skips the lexing and parsing. Images can
+ * also be created in advance with the ConfigurationCompiler tool. Any
+ * change to the text changes the hash, so a stale image is never used.
+ *
+ * The cache directory is, by order of preference, the CacheDirectory loader
+ * parameter, the MARTe2_CONFIG_CACHE environment variable or the per-user
+ * $XDG_CACHE_HOME/MARTe2ConfigCache (or $HOME/.cache/MARTe2ConfigCache).
+ * It is created with mode 0700 if missing. The cache is not used (the
+ * configuration is always parsed) if the directory or the image are not
+ * owned by the effective user or are writable by the group or the others.
+ *
+ * If InitialiseWorkers (loader parameter, or the MARTe2_INITIALISE_WORKERS
+ * environment variable) is greater than 0, the top-level objects are
+ * initialised by a ParallelObjectBuilder with that many workers, so that
+ * the independent objects are initialised concurrently. Otherwise they are
+ * initialised one after the other by the ObjectRegistryDatabase.
+ *
+ * As the RealTimeLoader, it configures all the RealTimeApplications and
+ * then either starts the FirstState or sends the MessageFunction to the
+ * MessageDestination. Only the cfg syntax is cached: other Parsers are
+ * delegated to the Loader.
+ *
+ * <pre>
+ * MARTeApp.sh -l ConfigurationCache::CachedRealTimeLoader -f RTApp.cfg -m StateMachine:START
+ * </pre>
+ */
+class CachedRealTimeLoader : public MARTe::Loader {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    CachedRealTimeLoader();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~CachedRealTimeLoader();
+
+    /**
+     * @brief Loads (or parses and caches) the configuration, creates the
+     * objects and configures the RealTimeApplications.
+     * @param[in] data the loader parameters.
+     * @param[in] configuration the configuration text.
+     * @return ErrorManagement::NoError if the objects were created and the
+     * RealTimeApplications configured.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Configure(MARTe::StructuredDataI &data,
+                                                        MARTe::StreamI &configuration);
+
+    /**
+     * @brief Starts the FirstState of the RealTimeApplications or sends the
+     * start message.
+     * @return ErrorManagement::NoError if the state was started or the
+     * message sent.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Start();
+
+    /**
+     * @brief Stops the RealTimeApplications and calls Loader::Stop.
+     * @return see Loader::Stop.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Stop();
+
+private:
+    /**
+     * The first state of the RealTimeApplications.
+     */
+    MARTe::StreamString firstState;
+
+    /**
+     * The destination of the start message.
+     */
+    MARTe::StreamString messageDestination;
+
+    /**
+     * The function of the start message.
+     */
+    MARTe::StreamString messageFunction;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_CONFIGURATIONCACHE_CACHEDREALTIMELOADER_H_ */
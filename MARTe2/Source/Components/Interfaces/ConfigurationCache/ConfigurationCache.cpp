@@ -0,0 +1,631 @@
+/**
+ * @file ConfigurationCache.cpp
+ * @brief Source file for the ConfigurationCache functions
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the functions which
+ * compile a ConfigurationDatabase into a binary image and load it back.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationCache.h"
+#include "File.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * "MCFG"
+ */
+const MARTe::uint32 CONFIGURATION_CACHE_MAGIC = 0x4746434Du;
+
+/**
+ * Incremented whenever the layout changes, so that older images are ignored.
+ */
+const MARTe::uint32 CONFIGURATION_CACHE_VERSION = 1u;
+
+/**
+ * Alignment of the records.
+ */
+const MARTe::uint32 CONFIGURATION_CACHE_ALIGNMENT = 8u;
+
+/**
+ * Kinds of record.
+ */
+const MARTe::uint32 CONFIGURATION_CACHE_NODE = 1u;
+const MARTe::uint32 CONFIGURATION_CACHE_NUMERIC = 2u;
+const MARTe::uint32 CONFIGURATION_CACHE_STRINGS = 3u;
+
+/**
+ * Maximum depth of the tree (guards the recursion against corrupted images).
+ */
+const MARTe::uint32 CONFIGURATION_CACHE_MAX_DEPTH = 64u;
+
+/**
+ * 64 bit FNV-1a.
+ */
+const MARTe::uint64 CONFIGURATION_CACHE_FNV_OFFSET = 0xcbf29ce484222325ull;
+const MARTe::uint64 CONFIGURATION_CACHE_FNV_PRIME = 0x100000001b3ull;
+
+/**
+ * @brief The header of an image.
+ */
+struct ConfigurationCacheHeader {
+    MARTe::uint32 magic;
+    MARTe::uint32 version;
+    MARTe::uint64 hash;
+    MARTe::uint64 checksum;
+    MARTe::uint32 size;
+    MARTe::uint32 numberOfRecords;
+};
+
+/**
+ * @brief A record, followed by the name and the data, each one padded.
+ */
+struct ConfigurationCacheRecord {
+    MARTe::uint32 kind;
+    MARTe::uint32 nameSize;
+    MARTe::uint32 numberOfChildren;
+    MARTe::uint32 typeDescriptor;
+    MARTe::uint32 numberOfDimensions;
+    MARTe::uint32 numberOfElements[2];
+    MARTe::uint32 dataSize;
+};
+
+/**
+ * @brief Accumulates bytes in a FNV-1a hash.
+ */
+MARTe::uint64 Accumulate(MARTe::uint64 hash,
+                         const MARTe::uint8 * const buffer,
+                         const MARTe::uint32 size) {
+    MARTe::uint32 i;
+    for (i = 0u; i < size; i++) {
+        hash ^= static_cast<MARTe::uint64>(buffer[i]);
+        hash *= CONFIGURATION_CACHE_FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief True if the file is owned by the effective user and cannot be
+ * written by the group or the others.
+ */
+bool IsPrivate(const struct stat &fileStat) {
+    return ((fileStat.st_uid == geteuid()) && ((fileStat.st_mode & (S_IWGRP | S_IWOTH)) == 0u));
+}
+
+/**
+ * @brief Size padded to the alignment of the records.
+ */
+MARTe::uint32 Padded(const MARTe::uint32 size) {
+    return ((size + CONFIGURATION_CACHE_ALIGNMENT - 1u) / CONFIGURATION_CACHE_ALIGNMENT) * CONFIGURATION_CACHE_ALIGNMENT;
+}
+
+/**
+ * @brief Writes the records of a tree to a file, updating the checksum.
+ */
+class ConfigurationCacheWriter {
+public:
+    ConfigurationCacheWriter(MARTe::File &fileIn) :
+            file(fileIn) {
+        checksum = CONFIGURATION_CACHE_FNV_OFFSET;
+        size = static_cast<MARTe::uint32>(sizeof(ConfigurationCacheHeader));
+        numberOfRecords = 0u;
+    }
+
+    bool WriteNode(MARTe::StructuredDataI &data,
+                   const MARTe::char8 * const name) {
+        using namespace MARTe;
+        ConfigurationCacheRecord record;
+        bool ok = MemoryOperationsHelper::Set(&record, '\0', static_cast<uint32>(sizeof(record)));
+        uint32 numberOfChildren = data.GetNumberOfChildren();
+        record.kind = CONFIGURATION_CACHE_NODE;
+        record.numberOfChildren = numberOfChildren;
+        if (ok) {
+            ok = WriteRecord(record, name);
+        }
+        uint32 i;
+        for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+            //Copy the name, as moving in the tree may invalidate it
+            StreamString childName = data.GetChildName(i);
+            if (data.MoveRelative(childName.Buffer())) {
+                ok = WriteNode(data, childName.Buffer());
+                if (ok) {
+                    ok = data.MoveToAncestor(1u);
+                }
+            }
+            else {
+                ok = WriteLeaf(data, childName.Buffer());
+            }
+        }
+        return ok;
+    }
+
+    bool WriteLeaf(MARTe::StructuredDataI &data,
+                   const MARTe::char8 * const name) {
+        using namespace MARTe;
+        AnyType leaf = data.GetType(name);
+        TypeDescriptor td = leaf.GetTypeDescriptor();
+        uint8 numberOfDimensions = leaf.GetNumberOfDimensions();
+        uint32 numberOfColumns = (numberOfDimensions > 0u) ? (leaf.GetNumberOfElements(0u)) : (1u);
+        uint32 numberOfRows = (numberOfDimensions > 1u) ? (leaf.GetNumberOfElements(1u)) : (1u);
+        uint32 numberOfValues = numberOfColumns * numberOfRows;
+        bool ok = (numberOfDimensions <= 2u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s has more than two dimensions", name);
+        }
+        ConfigurationCacheRecord record;
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(&record, '\0', static_cast<uint32>(sizeof(record)));
+        }
+        record.numberOfDimensions = numberOfDimensions;
+        record.numberOfElements[0] = numberOfColumns;
+        record.numberOfElements[1] = numberOfRows;
+        bool numeric = (!td.isStructuredData) && ((td.numberOfBits % 8u) == 0u);
+        if (numeric) {
+            numeric = ((td.type == SignedInteger) || (td.type == UnsignedInteger) || (td.type == Float));
+        }
+        if ((ok) && (numeric)) {
+            uint32 dataSize = numberOfValues * (td.numberOfBits / 8u);
+            uint8 *values = new uint8[dataSize];
+            AnyType destination(td, 0u, values);
+            destination.SetNumberOfDimensions(numberOfDimensions);
+            destination.SetNumberOfElements(0u, numberOfColumns);
+            destination.SetNumberOfElements(1u, numberOfRows);
+            ok = data.Read(name, destination);
+            record.kind = CONFIGURATION_CACHE_NUMERIC;
+            record.typeDescriptor = td.all;
+            record.dataSize = dataSize;
+            if (ok) {
+                ok = WriteRecord(record, name);
+            }
+            if (ok) {
+                ok = Write(values, dataSize);
+            }
+            delete[] values;
+        }
+        else if (ok) {
+            StreamString *values = new StreamString[numberOfValues];
+            if (numberOfDimensions == 0u) {
+                ok = data.Read(name, values[0]);
+            }
+            else if (numberOfDimensions == 1u) {
+                Vector<StreamString> vector(values, numberOfValues);
+                ok = data.Read(name, vector);
+            }
+            else {
+                Matrix<StreamString> matrix(values, numberOfRows, numberOfColumns);
+                ok = data.Read(name, matrix);
+            }
+            record.kind = CONFIGURATION_CACHE_STRINGS;
+            uint32 v;
+            for (v = 0u; v < numberOfValues; v++) {
+                record.dataSize += static_cast<uint32>(values[v].Size()) + 1u;
+            }
+            if (ok) {
+                ok = WriteRecord(record, name);
+            }
+            for (v = 0u; (v < numberOfValues) && (ok); v++) {
+                ok = Write(values[v].Buffer(), static_cast<uint32>(values[v].Size()) + 1u);
+            }
+            delete[] values;
+        }
+        else {
+        }
+        if (ok) {
+            ok = Pad();
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not write %s", name);
+        }
+        return ok;
+    }
+
+    MARTe::uint64 checksum;
+    MARTe::uint32 size;
+    MARTe::uint32 numberOfRecords;
+
+private:
+    bool WriteRecord(const ConfigurationCacheRecord &record,
+                     const MARTe::char8 * const name) {
+        ConfigurationCacheRecord toWrite = record;
+        toWrite.nameSize = MARTe::StringHelper::Length(name) + 1u;
+        bool ok = Write(&toWrite, static_cast<MARTe::uint32>(sizeof(toWrite)));
+        if (ok) {
+            ok = Write(name, toWrite.nameSize);
+        }
+        if (ok) {
+            ok = Pad();
+        }
+        numberOfRecords++;
+        return ok;
+    }
+
+    bool Write(const void * const buffer,
+               const MARTe::uint32 bufferSize) {
+        checksum = Accumulate(checksum, static_cast<const MARTe::uint8 *>(buffer), bufferSize);
+        size += bufferSize;
+        MARTe::uint32 written = bufferSize;
+        bool ok = file.Write(static_cast<const MARTe::char8 *>(buffer), written);
+        if (ok) {
+            ok = (written == bufferSize);
+        }
+        return ok;
+    }
+
+    bool Pad() {
+        const MARTe::char8 zeros[CONFIGURATION_CACHE_ALIGNMENT] = { '\0' };
+        bool ok = true;
+        MARTe::uint32 padding = Padded(size) - size;
+        if (padding > 0u) {
+            ok = Write(&zeros[0], padding);
+        }
+        return ok;
+    }
+
+    MARTe::File &file;
+};
+
+/**
+ * @brief Rebuilds a tree from the records of a mapped image.
+ */
+class ConfigurationCacheReader {
+public:
+    ConfigurationCacheReader(const MARTe::uint8 * const imageIn,
+                             const MARTe::uint32 sizeIn) :
+            image(imageIn) {
+        size = sizeIn;
+        offset = static_cast<MARTe::uint32>(sizeof(ConfigurationCacheHeader));
+        numberOfRecords = 0u;
+    }
+
+    bool ReadChildren(MARTe::ConfigurationDatabase &data,
+                      const MARTe::uint32 numberOfChildren,
+                      const MARTe::uint32 depth) {
+        using namespace MARTe;
+        bool ok = (depth < CONFIGURATION_CACHE_MAX_DEPTH);
+        uint32 i;
+        for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+            const ConfigurationCacheRecord *record = NULL_PTR(const ConfigurationCacheRecord *);
+            const char8 *name = NULL_PTR(const char8 *);
+            ok = ReadRecord(record, name);
+            if (!ok) {
+            }
+            else if (record->kind == CONFIGURATION_CACHE_NODE) {
+                ok = data.CreateRelative(name);
+                if (ok) {
+                    ok = ReadChildren(data, record->numberOfChildren, depth + 1u);
+                }
+                if (ok) {
+                    ok = data.MoveToAncestor(1u);
+                }
+            }
+            else {
+                ok = ReadLeaf(data, *record, name);
+            }
+        }
+        return ok;
+    }
+
+    bool ReadRecord(const ConfigurationCacheRecord *&record,
+                    const MARTe::char8 *&name) {
+        using namespace MARTe;
+        bool ok = ((offset + sizeof(ConfigurationCacheRecord)) <= size);
+        if (ok) {
+            record = reinterpret_cast<const ConfigurationCacheRecord *>(&image[offset]);
+            offset += static_cast<uint32>(sizeof(ConfigurationCacheRecord));
+            ok = ((record->nameSize > 0u) && (record->nameSize <= (size - offset)));
+        }
+        if (ok) {
+            name = reinterpret_cast<const char8 *>(&image[offset]);
+            ok = (name[record->nameSize - 1u] == '\0');
+            offset += Padded(record->nameSize);
+        }
+        if (ok) {
+            ok = ((offset <= size) && (record->dataSize <= (size - offset)));
+        }
+        if (ok) {
+            ok = ((record->kind == CONFIGURATION_CACHE_NODE) || (record->numberOfDimensions <= 2u));
+        }
+        numberOfRecords++;
+        return ok;
+    }
+
+    bool ReadLeaf(MARTe::ConfigurationDatabase &data,
+                  const ConfigurationCacheRecord &record,
+                  const MARTe::char8 * const name) {
+        using namespace MARTe;
+        const uint8 *values = &image[offset];
+        uint32 numberOfColumns = record.numberOfElements[0];
+        uint32 numberOfRows = record.numberOfElements[1];
+        uint32 numberOfValues = numberOfColumns * numberOfRows;
+        bool ok = ((numberOfColumns > 0u) && (numberOfRows > 0u) && ((numberOfValues / numberOfColumns) == numberOfRows));
+        if (!ok) {
+        }
+        else if (record.kind == CONFIGURATION_CACHE_NUMERIC) {
+            TypeDescriptor td(static_cast<uint16>(record.typeDescriptor));
+            ok = ((td.numberOfBits > 0u) && ((numberOfValues * (td.numberOfBits / 8u)) == record.dataSize));
+            if (ok) {
+                AnyType leaf(td, 0u, const_cast<uint8 *>(values));
+                leaf.SetNumberOfDimensions(static_cast<uint8>(record.numberOfDimensions));
+                leaf.SetNumberOfElements(0u, numberOfColumns);
+                leaf.SetNumberOfElements(1u, numberOfRows);
+                ok = data.Write(name, leaf);
+            }
+        }
+        else if (record.kind == CONFIGURATION_CACHE_STRINGS) {
+            //Point to the strings in the image, the database copies them
+            const char8 **strings = new const char8*[numberOfValues];
+            uint32 position = 0u;
+            uint32 v;
+            for (v = 0u; (v < numberOfValues) && (ok); v++) {
+                strings[v] = reinterpret_cast<const char8 *>(&values[position]);
+                while ((position < record.dataSize) && (values[position] != 0u)) {
+                    position++;
+                }
+                ok = (position < record.dataSize);
+                position++;
+            }
+            if (!ok) {
+            }
+            else if (record.numberOfDimensions == 0u) {
+                ok = data.Write(name, strings[0]);
+            }
+            else if (record.numberOfDimensions == 1u) {
+                Vector<const char8 *> vector(strings, numberOfValues);
+                ok = data.Write(name, vector);
+            }
+            else {
+                Matrix<const char8 *> matrix(strings, numberOfRows, numberOfColumns);
+                ok = data.Write(name, matrix);
+            }
+            delete[] strings;
+        }
+        else {
+            ok = false;
+        }
+        offset += Padded(record.dataSize);
+        return ok;
+    }
+
+    MARTe::uint32 offset;
+    MARTe::uint32 numberOfRecords;
+
+private:
+    const MARTe::uint8 * const image;
+    MARTe::uint32 size;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+namespace ConfigurationCache {
+
+MARTe::uint64 Hash(const MARTe::char8 * const buffer,
+                   const MARTe::uint32 size) {
+    return Accumulate(CONFIGURATION_CACHE_FNV_OFFSET, reinterpret_cast<const MARTe::uint8 *>(buffer), size);
+}
+
+bool GetFileName(const MARTe::char8 * const directory,
+                 const MARTe::uint64 hash,
+                 MARTe::StreamString &fileName) {
+    using namespace MARTe;
+    fileName = "";
+    //Printf has no 64 bit hexadecimal padding, write it in two halves
+    uint32 high = static_cast<uint32>(hash >> 32u);
+    uint32 low = static_cast<uint32>(hash);
+    return fileName.Printf("%s/%08x%08x.mcfg", directory, high, low);
+}
+
+bool GetDefaultDirectory(MARTe::StreamString &directory) {
+    using namespace MARTe;
+    directory = "";
+    const char8 * const xdgCacheHome = getenv("XDG_CACHE_HOME");
+    const char8 * const home = getenv("HOME");
+    bool ok = true;
+    if ((xdgCacheHome != NULL_PTR(const char8 *)) && (xdgCacheHome[0] == '/')) {
+        ok = directory.Printf("%s/MARTe2ConfigCache", xdgCacheHome);
+    }
+    else if ((home != NULL_PTR(const char8 *)) && (home[0] == '/')) {
+        ok = directory.Printf("%s/.cache/MARTe2ConfigCache", home);
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+bool PrepareDirectory(const MARTe::char8 * const directory) {
+    using namespace MARTe;
+    StreamString path = directory;
+    char8 *buffer = const_cast<char8 *>(path.Buffer());
+    uint32 size = static_cast<uint32>(path.Size());
+    //Create the missing components, only accessible by the user
+    uint32 i;
+    for (i = 1u; i <= size; i++) {
+        if ((i == size) || (buffer[i] == '/')) {
+            char8 separator = buffer[i];
+            buffer[i] = '\0';
+            (void) mkdir(buffer, 0700);
+            buffer[i] = separator;
+        }
+    }
+    struct stat directoryStat;
+    bool ok = (stat(directory, &directoryStat) == 0);
+    if (ok) {
+        ok = S_ISDIR(directoryStat.st_mode);
+    }
+    if (ok) {
+        ok = IsPrivate(directoryStat);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "The cache directory %s is not a directory owned by the user and not writable by others", directory);
+    }
+    return ok;
+}
+
+bool Compile(MARTe::StructuredDataI &data,
+             const MARTe::uint64 hash,
+             const MARTe::char8 * const fileName) {
+    using namespace MARTe;
+    StreamString temporaryName;
+    bool ok = temporaryName.Printf("%s.%d.tmp", fileName, static_cast<int32>(getpid()));
+    File file;
+    if (ok) {
+        ok = file.Open(temporaryName.Buffer(), File::ACCESS_MODE_W | File::FLAG_CREAT | File::FLAG_TRUNC);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not open %s", temporaryName.Buffer());
+        }
+    }
+    ConfigurationCacheHeader header;
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(&header, '\0', static_cast<uint32>(sizeof(header)));
+    }
+    //Reserve the header, written once the checksum is known
+    if (ok) {
+        uint32 headerSize = static_cast<uint32>(sizeof(header));
+        ok = file.Write(reinterpret_cast<const char8 *>(&header), headerSize);
+    }
+    ConfigurationCacheWriter writer(file);
+    if (ok) {
+        ok = data.MoveToRoot();
+    }
+    if (ok) {
+        ok = writer.WriteNode(data, "");
+    }
+    if (ok) {
+        header.magic = CONFIGURATION_CACHE_MAGIC;
+        header.version = CONFIGURATION_CACHE_VERSION;
+        header.hash = hash;
+        header.checksum = writer.checksum;
+        header.size = writer.size;
+        header.numberOfRecords = writer.numberOfRecords;
+        ok = file.Seek(0u);
+    }
+    if (ok) {
+        uint32 headerSize = static_cast<uint32>(sizeof(header));
+        ok = file.Write(reinterpret_cast<const char8 *>(&header), headerSize);
+    }
+    if (file.IsValid()) {
+        if (!file.Close()) {
+            ok = false;
+        }
+    }
+    if (ok) {
+        ok = (chmod(temporaryName.Buffer(), 0600) == 0);
+    }
+    if (ok) {
+        ok = (rename(temporaryName.Buffer(), fileName) == 0);
+    }
+    if (!ok) {
+        (void) remove(temporaryName.Buffer());
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not write the image %s", fileName);
+    }
+    return ok;
+}
+
+bool Load(const MARTe::char8 * const fileName,
+          const MARTe::uint64 hash,
+          MARTe::ConfigurationDatabase &data) {
+    using namespace MARTe;
+    int32 fd = open(fileName, O_RDONLY | O_NOFOLLOW);
+    bool ok = (fd >= 0);
+    struct stat fileStat;
+    if (ok) {
+        ok = (fstat(fd, &fileStat) == 0);
+    }
+    //An image which others can write could inject objects in the application
+    if (ok) {
+        ok = ((S_ISREG(fileStat.st_mode)) && (IsPrivate(fileStat)));
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "The image %s is not a file owned by the user and not writable by others", fileName);
+        }
+    }
+    if (ok) {
+        ok = ((static_cast<uint64>(fileStat.st_size) >= sizeof(ConfigurationCacheHeader)) && (static_cast<uint64>(fileStat.st_size) < 0xFFFFFFFFu));
+    }
+    void *mapped = MAP_FAILED;
+    uint32 size = 0u;
+    if (ok) {
+        size = static_cast<uint32>(fileStat.st_size);
+        mapped = mmap(NULL_PTR(void *), size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ok = (mapped != MAP_FAILED);
+    }
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    const uint8 *image = static_cast<const uint8 *>(mapped);
+    if (ok) {
+        const ConfigurationCacheHeader *header = reinterpret_cast<const ConfigurationCacheHeader *>(image);
+        ok = ((header->magic == CONFIGURATION_CACHE_MAGIC) && (header->version == CONFIGURATION_CACHE_VERSION));
+        if (ok) {
+            ok = ((header->hash == hash) && (header->size == size));
+        }
+        if (ok) {
+            uint32 headerSize = static_cast<uint32>(sizeof(ConfigurationCacheHeader));
+            ok = (Accumulate(CONFIGURATION_CACHE_FNV_OFFSET, &image[headerSize], size - headerSize) == header->checksum);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "The image %s is corrupted", fileName);
+            }
+        }
+        if (ok) {
+            data.Purge();
+            ConfigurationCacheReader reader(image, size);
+            const ConfigurationCacheRecord *root = NULL_PTR(const ConfigurationCacheRecord *);
+            const char8 *rootName = NULL_PTR(const char8 *);
+            ok = reader.ReadRecord(root, rootName);
+            if (ok) {
+                ok = (root->kind == CONFIGURATION_CACHE_NODE);
+            }
+            if (ok) {
+                ok = reader.ReadChildren(data, root->numberOfChildren, 0u);
+            }
+            if (ok) {
+                ok = ((reader.offset == size) && (reader.numberOfRecords == header->numberOfRecords));
+            }
+            if (!ok) {
+                data.Purge();
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "The image %s is not consistent", fileName);
+            }
+        }
+        (void) munmap(mapped, size);
+    }
+    if (ok) {
+        ok = data.MoveToRoot();
+    }
+    return ok;
+}
+
+}
+} // namespace MARTe2Tutorial
@@ -0,0 +1,135 @@
+/**
+ * @file ConfigurationCache.h
+ * @brief Header file for the ConfigurationCache functions
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the functions which
+ * compile a ConfigurationDatabase into a binary image and load it back.
+ */
+
+#ifndef INTERFACES_CONFIGURATIONCACHE_CONFIGURATIONCACHE_H_
+#define INTERFACES_CONFIGURATIONCACHE_CONFIGURATIONCACHE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+/**
+ * @brief Binary images of a parsed configuration.
+ *
+ * @details An image holds the tree of a ConfigurationDatabase, as produced
+ * by the StandardParser, so that it can be rebuilt without lexing and
+ * parsing the text. The image is keyed by the hash of the configuration
+ * text: it is named \<hash\>.mcfg in the cache directory.
+ *
+ * Layout (all the records are 8 byte aligned):
+ *  - a header with a magic number, the format version, the hash of the
+ *    text, the size and the checksum of the image;
+ *  - a node record for the root, followed depth-first by the records of
+ *    its children. Each record carries its name and, for the nodes, the
+ *    number of children. The numeric leaves keep their TypeDescriptor and
+ *    raw values, the other leaves are stored as strings.
+ *
+ * Loading maps the file in memory and checks the header, the checksum and
+ * the bounds of every record before writing anything to the database. As an
+ * image defines the objects of the application, only the images (and the
+ * directories) owned by the effective user and not writable by the group or
+ * the others are used.
+ */
+namespace ConfigurationCache {
+
+/**
+ * @brief Computes the hash (64 bit FNV-1a) of a configuration text.
+ * @param[in] buffer the text.
+ * @param[in] size the size of the text.
+ * @return the hash.
+ */
+MARTe::uint64 Hash(const MARTe::char8 * const buffer,
+                   const MARTe::uint32 size);
+
+/**
+ * @brief Gets the name of the image of a configuration.
+ * @param[in] directory the cache directory.
+ * @param[in] hash the hash of the configuration text.
+ * @param[out] fileName \<directory\>/\<hash\>.mcfg.
+ * @return true if the name could be written.
+ */
+bool GetFileName(const MARTe::char8 * const directory,
+                 const MARTe::uint64 hash,
+                 MARTe::StreamString &fileName);
+
+/**
+ * @brief Gets the default cache directory.
+ * @param[out] directory $XDG_CACHE_HOME/MARTe2ConfigCache or, if
+ * XDG_CACHE_HOME is not set, $HOME/.cache/MARTe2ConfigCache.
+ * @return true if either XDG_CACHE_HOME or HOME is set to an absolute path.
+ */
+bool GetDefaultDirectory(MARTe::StreamString &directory);
+
+/**
+ * @brief Creates the missing components of the cache directory (with mode
+ * 0700) and checks that it can be trusted.
+ * @param[in] directory the cache directory.
+ * @return true if the directory is owned by the effective user and is not
+ * writable by the group or the others.
+ */
+bool PrepareDirectory(const MARTe::char8 * const directory);
+
+/**
+ * @brief Writes the image of a configuration.
+ * @details The image is written (with mode 0600) to a temporary file which
+ * is then renamed, so that concurrent readers never see a partial image.
+ * @param[in] data the configuration (the whole tree from the root is written).
+ * @param[in] hash the hash of the configuration text.
+ * @param[in] fileName the name of the image.
+ * @return true if the image was written.
+ */
+bool Compile(MARTe::StructuredDataI &data,
+             const MARTe::uint64 hash,
+             const MARTe::char8 * const fileName);
+
+/**
+ * @brief Loads an image.
+ * @param[in] fileName the name of the image.
+ * @param[in] hash the expected hash of the configuration text.
+ * @param[out] data where to write the configuration (purged first).
+ * @return true if the image exists, is a regular file (not a link) owned by
+ * the effective user and not writable by the group or the others, is valid
+ * and was created from a text with the given hash.
+ */
+bool Load(const MARTe::char8 * const fileName,
+          const MARTe::uint64 hash,
+          MARTe::ConfigurationDatabase &data);
+}
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_CONFIGURATIONCACHE_CONFIGURATIONCACHE_H_ */
@@ -0,0 +1,360 @@
+/**
+ * @file ParallelObjectBuilder.cpp
+ * @brief Source file for class ParallelObjectBuilder
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ParallelObjectBuilder (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
+#include "HighResolutionTimer.h"
+#include "ParallelObjectBuilder.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Status of the items.
+ */
+const MARTe::uint32 PARALLEL_OBJECT_BUILDER_WAITING = 0u;
+const MARTe::uint32 PARALLEL_OBJECT_BUILDER_RUNNING = 1u;
+const MARTe::uint32 PARALLEL_OBJECT_BUILDER_DONE = 2u;
+const MARTe::uint32 PARALLEL_OBJECT_BUILDER_FAILED = 3u;
+
+/**
+ * Period (ms) at which the idle workers look for an object to initialise.
+ */
+const MARTe::uint32 PARALLEL_OBJECT_BUILDER_POLL = 10u;
+
+/**
+ * The leaves which reference other objects.
+ */
+const MARTe::char8 * const PARALLEL_OBJECT_BUILDER_REFERENCES[] = { "Destination", "DataSource", "TimingDataSource", "HeapName", NULL_PTR(const MARTe::char8 *) };
+
+/**
+ * @brief Microseconds elapsed since start.
+ */
+MARTe::uint32 ElapsedMicroseconds(const MARTe::uint64 start) {
+    using namespace MARTe;
+    return static_cast<uint32>(static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period() * 1e6);
+}
+
+/**
+ * @brief true if the name of a leaf is one of PARALLEL_OBJECT_BUILDER_REFERENCES.
+ */
+bool IsReference(const MARTe::char8 * const name) {
+    bool found = false;
+    MARTe::uint32 i;
+    for (i = 0u; (PARALLEL_OBJECT_BUILDER_REFERENCES[i] != NULL_PTR(const MARTe::char8 *)) && (!found); i++) {
+        found = (MARTe::StringHelper::Compare(name, PARALLEL_OBJECT_BUILDER_REFERENCES[i]) == 0);
+    }
+    return found;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+ParallelObjectBuilder::ParallelObjectBuilder() :
+        MARTe::EmbeddedServiceMethodBinderI(), workers(*this) {
+    items = NULL_PTR(ParallelObjectBuilderItem *);
+    numberOfItems = 0u;
+    numberOfCompleted = 0u;
+    numberOfRunning = 0u;
+    container = NULL_PTR(MARTe::ReferenceContainer *);
+    (void) mux.Create();
+    (void) progress.Create();
+}
+
+ParallelObjectBuilder::~ParallelObjectBuilder() {
+    if (items != NULL_PTR(ParallelObjectBuilderItem *)) {
+        MARTe::uint32 i;
+        for (i = 0u; i < numberOfItems; i++) {
+            if (items[i].dependencies != NULL_PTR(MARTe::uint32 *)) {
+                delete[] items[i].dependencies;
+            }
+        }
+        delete[] items;
+    }
+    (void) progress.Close();
+    (void) mux.Close();
+}
+
+bool ParallelObjectBuilder::Build(MARTe::StructuredDataI &data,
+                                  MARTe::ReferenceContainer &destination,
+                                  const MARTe::uint32 numberOfWorkers) {
+    using namespace MARTe;
+    uint64 start = HighResolutionTimer::Counter();
+    container = &destination;
+    bool ok = ReadItems(data);
+    //Create the objects in the calling thread, as it may load their libraries
+    uint32 i;
+    for (i = 0u; (i < numberOfItems) && (ok); i++) {
+        StreamString className;
+        ok = items[i].data.Read("Class", className);
+        if (ok) {
+            items[i].reference = Reference(className.Buffer(), GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            ok = items[i].reference.IsValid();
+        }
+        if (ok) {
+            const char8 * const nodeName = items[i].nodeName.Buffer();
+            items[i].reference->SetName(&nodeName[1]);
+            if (nodeName[0] == '$') {
+                items[i].reference->SetDomain(true);
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not create %s", items[i].nodeName.Buffer());
+        }
+    }
+    if ((ok) && (numberOfItems > 0u)) {
+        uint32 numberOfThreads = (numberOfWorkers < numberOfItems) ? (numberOfWorkers) : (numberOfItems);
+        numberOfCompleted = 0u;
+        numberOfRunning = 0u;
+        workers.SetName("ParallelObjectBuilder");
+        workers.SetNumberOfPoolThreads(numberOfThreads);
+        ok = (workers.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not start the workers");
+        }
+        bool completed = !ok;
+        while (!completed) {
+            (void) mux.Lock();
+            completed = (numberOfCompleted == numberOfItems);
+            (void) mux.UnLock();
+            if (!completed) {
+                (void) progress.ResetWait(TimeoutType(PARALLEL_OBJECT_BUILDER_POLL));
+            }
+        }
+        if (workers.Stop() != ErrorManagement::NoError) {
+            if (workers.Stop() != ErrorManagement::NoError) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not stop MultiThreadService.");
+            }
+        }
+    }
+    for (i = 0u; (i < numberOfItems) && (ok); i++) {
+        ok = (items[i].status == PARALLEL_OBJECT_BUILDER_DONE);
+    }
+    //Same order as ObjectRegistryDatabase::Initialise
+    for (i = 0u; (i < numberOfItems) && (ok); i++) {
+        ok = destination.Delete(items[i].reference);
+        if (ok) {
+            ok = destination.Insert(items[i].reference);
+        }
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%d objects initialised in %d us with %d workers", numberOfItems, ElapsedMicroseconds(start),
+                            numberOfWorkers);
+    }
+    return ok;
+}
+
+bool ParallelObjectBuilder::ReadItems(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = data.MoveToRoot();
+    uint32 numberOfChildren = data.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        const char8 * const childName = data.GetChildName(i);
+        if ((childName[0] == '+') || (childName[0] == '$')) {
+            numberOfItems++;
+        }
+    }
+    if ((ok) && (numberOfItems > 0u)) {
+        items = new ParallelObjectBuilderItem[numberOfItems];
+    }
+    uint32 n = 0u;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        StreamString childName = data.GetChildName(i);
+        if ((childName.Buffer()[0] == '+') || (childName.Buffer()[0] == '$')) {
+            items[n].nodeName = childName;
+            items[n].dependencies = NULL_PTR(uint32 *);
+            items[n].numberOfDependencies = 0u;
+            items[n].status = PARALLEL_OBJECT_BUILDER_WAITING;
+            items[n].initialiseTime = 0u;
+            ok = data.MoveRelative(childName.Buffer());
+            if (ok) {
+                ok = data.Copy(items[n].data);
+                if (ok) {
+                    ok = data.MoveToAncestor(1u);
+                }
+            }
+            if (ok) {
+                ok = items[n].data.MoveToRoot();
+            }
+            n++;
+        }
+    }
+    uint32 *found = NULL_PTR(uint32 *);
+    if ((ok) && (numberOfItems > 0u)) {
+        found = new uint32[numberOfItems];
+    }
+    for (i = 0u; (i < numberOfItems) && (ok); i++) {
+        uint32 numberOfFound = 0u;
+        FindDependencies(i, items[i].data, found, numberOfFound);
+        ok = items[i].data.MoveToRoot();
+        if (numberOfFound > 0u) {
+            items[i].numberOfDependencies = numberOfFound;
+            items[i].dependencies = new uint32[numberOfFound];
+            uint32 d;
+            for (d = 0u; d < numberOfFound; d++) {
+                items[i].dependencies[d] = found[d];
+                REPORT_ERROR_STATIC(ErrorManagement::Debug, "%s depends on %s", items[i].nodeName.Buffer(), items[found[d]].nodeName.Buffer());
+            }
+        }
+    }
+    if (found != NULL_PTR(uint32 *)) {
+        delete[] found;
+    }
+    return ok;
+}
+
+void ParallelObjectBuilder::FindDependencies(const MARTe::uint32 idx,
+                                             MARTe::StructuredDataI &data,
+                                             MARTe::uint32 * const found,
+                                             MARTe::uint32 &numberOfFound) {
+    using namespace MARTe;
+    uint32 numberOfChildren = data.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; i < numberOfChildren; i++) {
+        StreamString childName = data.GetChildName(i);
+        if (data.MoveRelative(childName.Buffer())) {
+            FindDependencies(idx, data, found, numberOfFound);
+            (void) data.MoveToAncestor(1u);
+        }
+        else if (IsReference(childName.Buffer())) {
+            StreamString path;
+            if (data.GetType(childName.Buffer()).GetNumberOfDimensions() == 0u) {
+                (void) data.Read(childName.Buffer(), path);
+            }
+            //The first element of the path is the top-level object
+            const char8 *name = path.Buffer();
+            uint32 nameSize = static_cast<uint32>(path.Size());
+            uint32 c;
+            for (c = 0u; c < nameSize; c++) {
+                if (name[c] == '.') {
+                    nameSize = c;
+                }
+            }
+            uint32 j;
+            for (j = 0u; (j < numberOfItems) && (nameSize > 0u); j++) {
+                const char8 * const candidate = &(items[j].nodeName.Buffer()[1]);
+                bool matches = (j != idx);
+                if (matches) {
+                    matches = ((StringHelper::Length(candidate) == nameSize) && (StringHelper::CompareN(candidate, name, nameSize) == 0));
+                }
+                uint32 f;
+                for (f = 0u; (f < numberOfFound) && (matches); f++) {
+                    matches = (found[f] != j);
+                }
+                if (matches) {
+                    found[numberOfFound] = j;
+                    numberOfFound++;
+                }
+            }
+        }
+        else {
+        }
+    }
+}
+
+bool ParallelObjectBuilder::SelectNext(MARTe::uint32 &idx) {
+    using namespace MARTe;
+    //The first waiting object with the fewest dependencies not yet completed
+    bool found = false;
+    uint32 fewest = 0u;
+    uint32 i;
+    for (i = 0u; i < numberOfItems; i++) {
+        if (items[i].status == PARALLEL_OBJECT_BUILDER_WAITING) {
+            uint32 pending = 0u;
+            uint32 d;
+            for (d = 0u; d < items[i].numberOfDependencies; d++) {
+                uint32 status = items[items[i].dependencies[d]].status;
+                if ((status != PARALLEL_OBJECT_BUILDER_DONE) && (status != PARALLEL_OBJECT_BUILDER_FAILED)) {
+                    pending++;
+                }
+            }
+            if ((!found) || (pending < fewest)) {
+                found = true;
+                fewest = pending;
+                idx = i;
+            }
+        }
+    }
+    if ((found) && (fewest > 0u)) {
+        //Only a circular dependency can block the objects while none is running
+        found = (numberOfRunning == 0u);
+        if (found) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Circular dependency: %s is initialised before its dependencies", items[idx].nodeName.Buffer());
+        }
+    }
+    return found;
+}
+
+MARTe::ErrorManagement::ErrorType ParallelObjectBuilder::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint32 idx = 0u;
+        (void) mux.Lock();
+        bool found = SelectNext(idx);
+        if (found) {
+            items[idx].status = PARALLEL_OBJECT_BUILDER_RUNNING;
+            numberOfRunning++;
+        }
+        (void) mux.UnLock();
+        if (found) {
+            uint64 start = HighResolutionTimer::Counter();
+            bool ok = items[idx].reference->Initialise(items[idx].data);
+            items[idx].initialiseTime = ElapsedMicroseconds(start);
+            //Inserted now, so that the objects which depend on it can find it
+            if (ok) {
+                ok = container->Insert(items[idx].reference);
+            }
+            if (ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "%s initialised in %d us", items[idx].nodeName.Buffer(), items[idx].initialiseTime);
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not initialise %s", items[idx].nodeName.Buffer());
+            }
+            (void) mux.Lock();
+            items[idx].status = (ok) ? (PARALLEL_OBJECT_BUILDER_DONE) : (PARALLEL_OBJECT_BUILDER_FAILED);
+            numberOfRunning--;
+            numberOfCompleted++;
+            (void) mux.UnLock();
+            (void) progress.Post();
+        }
+        else {
+            (void) progress.ResetWait(TimeoutType(PARALLEL_OBJECT_BUILDER_POLL));
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+} // namespace MARTe2Tutorial
@@ -0,0 +1,214 @@
+/**
+ * @file ParallelObjectBuilder.h
+ * @brief Header file for class ParallelObjectBuilder
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * ParallelObjectBuilder with all of its public, protected and private
+ * members. It may also include definitions for inline methods which need to
+ * be visible to the compiler.
+ */
+
+#ifndef INTERFACES_CONFIGURATIONCACHE_PARALLELOBJECTBUILDER_H_
+#define INTERFACES_CONFIGURATIONCACHE_PARALLELOBJECTBUILDER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "MultiThreadService.h"
+#include "MutexSem.h"
+#include "Reference.h"
+#include "ReferenceContainer.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+/**
+ * @brief A top-level object of the configuration.
+ */
+struct ParallelObjectBuilderItem {
+    /**
+     * The name of the node (+Name or $Name).
+     */
+    MARTe::StreamString nodeName;
+
+    /**
+     * A copy of the node, so that the objects do not share the position in
+     * the tree.
+     */
+    MARTe::ConfigurationDatabase data;
+
+    /**
+     * The object.
+     */
+    MARTe::Reference reference;
+
+    /**
+     * The indexes of the objects which shall be initialised before.
+     */
+    MARTe::uint32 *dependencies;
+
+    /**
+     * The number of dependencies.
+     */
+    MARTe::uint32 numberOfDependencies;
+
+    /**
+     * Waiting, running, done or failed.
+     */
+    MARTe::uint32 status;
+
+    /**
+     * The duration (us) of Initialise.
+     */
+    MARTe::uint32 initialiseTime;
+};
+
+/**
+ * @brief Creates the top-level objects of a configuration and initialises
+ * the independent ones concurrently.
+ *
+ * @details Equivalent to ObjectRegistryDatabase::Initialise, but:
+ *  - the dependencies of each top-level object are the other top-level
+ *    objects named (first element of the path) by the Destination,
+ *    DataSource, TimingDataSource and HeapName (a RealTimeMemory) leaves of
+ *    its subtree;
+ *  - the objects are created, one after the other, in the order of the
+ *    configuration;
+ *  - a pool of workers then calls Initialise on every object whose
+ *    dependencies are already initialised. Each object is inserted in the
+ *    ObjectRegistryDatabase as soon as it is initialised, so that the
+ *    objects which depend on it can find it;
+ *  - if the dependencies are circular (e.g. a StateMachine which sends
+ *    messages to a RealTimeApplication which sends messages back), the
+ *    objects of the cycle are initialised in the order of the
+ *    configuration;
+ *  - once all are initialised, the objects are reordered in the
+ *    ObjectRegistryDatabase as in the configuration.
+ *
+ * A slow Initialise (e.g. the connection of an OPCUAClient or the opening
+ * of an MDSplus tree) thus only delays the objects which depend on it.
+ * The duration of each Initialise and the total are reported.
+ */
+class ParallelObjectBuilder : public MARTe::EmbeddedServiceMethodBinderI {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ParallelObjectBuilder();
+
+    /**
+     * @brief Destructor. Frees the objects which were not built.
+     */
+    virtual ~ParallelObjectBuilder();
+
+    /**
+     * @brief Creates and initialises the top-level objects of data.
+     * @param[in] data the configuration.
+     * @param[out] destination where to insert the objects (e.g. the
+     * ObjectRegistryDatabase).
+     * @param[in] numberOfWorkers the number of concurrent Initialise.
+     * @return true if all the objects were created and initialised.
+     */
+    bool Build(MARTe::StructuredDataI &data,
+               MARTe::ReferenceContainer &destination,
+               const MARTe::uint32 numberOfWorkers);
+
+    /**
+     * @brief Initialises the next object whose dependencies are initialised.
+     * @param[in] info see EmbeddedServiceMethodBinderI::Execute.
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+private:
+    /**
+     * @brief Reads the nodes, copies them and finds the dependencies.
+     * @return true if the nodes could be read.
+     */
+    bool ReadItems(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Adds to an item the top-level objects referenced in its subtree.
+     */
+    void FindDependencies(const MARTe::uint32 idx,
+                          MARTe::StructuredDataI &data,
+                          MARTe::uint32 * const found,
+                          MARTe::uint32 &numberOfFound);
+
+    /**
+     * @brief Selects the next object to initialise (called with mux locked).
+     * @return true if an object was selected.
+     */
+    bool SelectNext(MARTe::uint32 &idx);
+
+    /**
+     * The top-level objects.
+     */
+    ParallelObjectBuilderItem *items;
+
+    /**
+     * The number of top-level objects.
+     */
+    MARTe::uint32 numberOfItems;
+
+    /**
+     * The number of objects initialised (or which failed).
+     */
+    MARTe::uint32 numberOfCompleted;
+
+    /**
+     * The number of objects being initialised.
+     */
+    MARTe::uint32 numberOfRunning;
+
+    /**
+     * Where the objects are inserted.
+     */
+    MARTe::ReferenceContainer *container;
+
+    /**
+     * Protects the status of the items.
+     */
+    MARTe::MutexSem mux;
+
+    /**
+     * Posted every time an object completes.
+     */
+    MARTe::EventSem progress;
+
+    /**
+     * The workers.
+     */
+    MARTe::MultiThreadService workers;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_CONFIGURATIONCACHE_PARALLELOBJECTBUILDER_H_ */
@@ -0,0 +1,342 @@
+/**
+ * @file HotPathTrace.h
+ * @brief Header file for the hot-path tracing macros
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the HOT_PATH_TRACE_BEGIN,
+ * HOT_PATH_TRACE_END and HOT_PATH_TRACE_INSTANT macros and the per-thread
+ * ring buffers they write to.
+ *
+ * The macros record the HighResolutionTimer::Counter and a name, which shall
+ * be a string literal (only the pointer is stored), in a ring buffer owned by
+ * the calling thread. The ring is taken the first time a thread records an
+ * event, so that a thread shall record one event before entering its
+ * real-time loop if no allocation is tolerated in the loop. When the ring is
+ * full the oldest events are overwritten. When the thread exits its ring is
+ * released (pthread key destructor) and given to the next thread which
+ * starts tracing, so that short-lived threads do not leak rings; the events
+ * of the previous owner are then no longer dumped. A new ring is only
+ * allocated if no released ring is available, with the EventsPerThread of
+ * the HotPathTracer.
+ *
+ * Recording is a relaxed load of the enabled flag, a timer read and a store
+ * in memory owned by the thread: no locks, no system calls. The tracing is
+ * disabled until a HotPathTracer is instantiated, which also dumps the rings
+ * in the Chrome/Perfetto trace format. Defining HOT_PATH_TRACE_DISABLED
+ * compiles the macros out.
+ *
+ * Only the header is needed to record events: the registry is a static
+ * variable of an inline function, which the linker shares among all the
+ * component libraries loaded in the process.
+ */
+
+#ifndef INTERFACES_HOTPATHTRACER_HOTPATHTRACE_H_
+#define INTERFACES_HOTPATHTRACER_HOTPATHTRACE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <pthread.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HighResolutionTimer.h"
+#include "StringHelper.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+/**
+ * Maximum number of threads which can be traced.
+ */
+const MARTe::uint32 HOT_PATH_TRACE_MAX_THREADS = 256u;
+
+/**
+ * Maximum length of the name of a traced thread.
+ */
+const MARTe::uint32 HOT_PATH_TRACE_THREAD_NAME_SIZE = 32u;
+
+/**
+ * Default number of events of each ring (shall be a power of 2).
+ */
+const MARTe::uint32 HOT_PATH_TRACE_DEFAULT_EVENTS = 65536u;
+
+/**
+ * @brief A traced event.
+ */
+struct HotPathTraceEvent {
+    /**
+     * HighResolutionTimer::Counter of the event.
+     */
+    MARTe::uint64 timeStamp;
+
+    /**
+     * The name of the event (a string literal).
+     */
+    const MARTe::char8 *name;
+
+    /**
+     * The Chrome trace phase: 'B'egin, 'E'nd or 'i'nstant.
+     */
+    MARTe::char8 phase;
+};
+
+/**
+ * @brief The events of a thread.
+ * @details Only the owner thread writes the events. head is the number of
+ * events ever recorded; the last (mask + 1) of them are in the ring.
+ */
+struct HotPathTraceRing {
+    /**
+     * Number of recorded events.
+     */
+    volatile MARTe::uint64 head;
+
+    /**
+     * The value of head when the current owner took the ring.
+     */
+    volatile MARTe::uint64 start;
+
+    /**
+     * != 0 while the ring is owned by a thread.
+     */
+    volatile MARTe::uint32 inUse;
+
+    /**
+     * Number of events of the ring - 1.
+     */
+    MARTe::uint32 mask;
+
+    /**
+     * The events.
+     */
+    HotPathTraceEvent *events;
+
+    /**
+     * The owner thread.
+     */
+    MARTe::ThreadIdentifier threadId;
+
+    /**
+     * The name of the owner thread.
+     */
+    MARTe::char8 threadName[HOT_PATH_TRACE_THREAD_NAME_SIZE];
+};
+
+/**
+ * @brief The rings of all the traced threads.
+ * @details Zero initialised, i.e. disabled and with no rings.
+ */
+struct HotPathTraceRegistry {
+    /**
+     * Events are only recorded if != 0.
+     */
+    volatile MARTe::uint32 enabled;
+
+    /**
+     * Number of events of the rings allocated from now on (0 = default).
+     */
+    volatile MARTe::uint32 eventsPerThread;
+
+    /**
+     * Number of rings requested (may exceed HOT_PATH_TRACE_MAX_THREADS).
+     */
+    volatile MARTe::uint32 numberOfRings;
+
+    /**
+     * Number of threads which could not be traced because
+     * HOT_PATH_TRACE_MAX_THREADS threads were being traced.
+     */
+    volatile MARTe::uint32 untracedThreads;
+
+    /**
+     * The rings, published once allocated.
+     */
+    HotPathTraceRing * volatile rings[HOT_PATH_TRACE_MAX_THREADS];
+};
+
+/**
+ * @brief Gets the process wide registry.
+ * @return the registry.
+ */
+inline HotPathTraceRegistry &HotPathTraceGetRegistry() {
+    static HotPathTraceRegistry registry;
+    return registry;
+}
+
+/**
+ * @brief Releases a ring when its owner thread exits.
+ * @param[in] ring the ring.
+ */
+inline void HotPathTraceReleaseRing(void *ring) {
+    __atomic_store_n(&static_cast<HotPathTraceRing *>(ring)->inUse, 0u, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Gets the storage of the process wide key of the thread rings.
+ * @return the key.
+ */
+inline pthread_key_t &HotPathTraceGetThreadKeyStorage() {
+    static pthread_key_t key;
+    return key;
+}
+
+/**
+ * @brief Creates the key whose destructor releases the ring of a thread.
+ */
+inline void HotPathTraceCreateThreadKey() {
+    (void) pthread_key_create(&HotPathTraceGetThreadKeyStorage(), &HotPathTraceReleaseRing);
+}
+
+/**
+ * @brief Gets the process wide key of the thread rings, creating it once.
+ * @return the key.
+ */
+inline pthread_key_t HotPathTraceGetThreadKey() {
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    (void) pthread_once(&once, &HotPathTraceCreateThreadKey);
+    return HotPathTraceGetThreadKeyStorage();
+}
+
+/**
+ * @brief Takes a released ring or allocates and publishes a new one for the
+ * calling thread.
+ * @return the ring or NULL if HOT_PATH_TRACE_MAX_THREADS threads are
+ * already traced.
+ */
+inline HotPathTraceRing *HotPathTraceCreateRing() {
+    using namespace MARTe;
+    HotPathTraceRegistry &registry = HotPathTraceGetRegistry();
+    HotPathTraceRing *ring = NULL_PTR(HotPathTraceRing *);
+    uint32 numberOfRings = __atomic_load_n(&registry.numberOfRings, __ATOMIC_ACQUIRE);
+    if (numberOfRings > HOT_PATH_TRACE_MAX_THREADS) {
+        numberOfRings = HOT_PATH_TRACE_MAX_THREADS;
+    }
+    uint32 r;
+    for (r = 0u; (r < numberOfRings) && (ring == NULL_PTR(HotPathTraceRing *)); r++) {
+        HotPathTraceRing * const released = __atomic_load_n(&registry.rings[r], __ATOMIC_ACQUIRE);
+        if (released != NULL_PTR(HotPathTraceRing *)) {
+            uint32 expected = 0u;
+            if (__atomic_compare_exchange_n(&released->inUse, &expected, 1u, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+                ring = released;
+            }
+        }
+    }
+    if (ring == NULL_PTR(HotPathTraceRing *)) {
+        uint32 idx = __atomic_fetch_add(&registry.numberOfRings, 1u, __ATOMIC_ACQ_REL);
+        if (idx < HOT_PATH_TRACE_MAX_THREADS) {
+            uint32 size = __atomic_load_n(&registry.eventsPerThread, __ATOMIC_ACQUIRE);
+            if (size == 0u) {
+                size = HOT_PATH_TRACE_DEFAULT_EVENTS;
+            }
+            ring = new HotPathTraceRing;
+            ring->head = 0u;
+            ring->inUse = 1u;
+            ring->mask = size - 1u;
+            ring->events = new HotPathTraceEvent[size];
+        }
+        else {
+            (void) __atomic_add_fetch(&registry.untracedThreads, 1u, __ATOMIC_RELAXED);
+        }
+        if (ring != NULL_PTR(HotPathTraceRing *)) {
+            ring->start = 0u;
+            __atomic_store_n(&registry.rings[idx], ring, __ATOMIC_RELEASE);
+        }
+    }
+    else {
+        //The events of the previous owner are not dumped any more
+        __atomic_store_n(&ring->start, ring->head, __ATOMIC_RELEASE);
+    }
+    if (ring != NULL_PTR(HotPathTraceRing *)) {
+        ring->threadId = Threads::Id();
+        ring->threadName[0] = '\0';
+        const char8 * const threadName = Threads::Name(ring->threadId);
+        if (threadName != NULL_PTR(const char8 *)) {
+            (void) StringHelper::CopyN(&ring->threadName[0], threadName, HOT_PATH_TRACE_THREAD_NAME_SIZE - 1u);
+            ring->threadName[HOT_PATH_TRACE_THREAD_NAME_SIZE - 1u] = '\0';
+        }
+        //Released by HotPathTraceReleaseRing when the thread exits
+        (void) pthread_setspecific(HotPathTraceGetThreadKey(), ring);
+    }
+    return ring;
+}
+
+/**
+ * @brief Gets the ring of the calling thread, taking it on first use.
+ * @return the ring or NULL if the thread cannot be traced.
+ */
+inline HotPathTraceRing *HotPathTraceGetThreadRing() {
+    static __thread HotPathTraceRing *threadRing = NULL_PTR(HotPathTraceRing *);
+    static __thread bool registered = false;
+    if (!registered) {
+        registered = true;
+        threadRing = HotPathTraceCreateRing();
+    }
+    return threadRing;
+}
+
+/**
+ * @brief Records an event in the ring of the calling thread, if enabled.
+ * @param[in] name the name of the event (a string literal).
+ * @param[in] phase 'B', 'E' or 'i'.
+ */
+inline void HotPathTraceRecord(const MARTe::char8 * const name,
+                               const MARTe::char8 phase) {
+    using namespace MARTe;
+    HotPathTraceRegistry &registry = HotPathTraceGetRegistry();
+    if (__atomic_load_n(&registry.enabled, __ATOMIC_RELAXED) != 0u) {
+        HotPathTraceRing * const ring = HotPathTraceGetThreadRing();
+        if (ring != NULL_PTR(HotPathTraceRing *)) {
+            uint64 head = ring->head;
+            HotPathTraceEvent &event = ring->events[head & ring->mask];
+            event.timeStamp = HighResolutionTimer::Counter();
+            event.name = name;
+            event.phase = phase;
+            __atomic_store_n(&ring->head, head + 1u, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#ifdef HOT_PATH_TRACE_DISABLED
+#define HOT_PATH_TRACE_BEGIN(name)
+#define HOT_PATH_TRACE_END(name)
+#define HOT_PATH_TRACE_INSTANT(name)
+#else
+/**
+ * Opens the slice name on the calling thread.
+ */
+#define HOT_PATH_TRACE_BEGIN(name) MARTe2Tutorial::HotPathTraceRecord(name, 'B')
+/**
+ * Closes the slice name (the last one opened) on the calling thread.
+ */
+#define HOT_PATH_TRACE_END(name) MARTe2Tutorial::HotPathTraceRecord(name, 'E')
+/**
+ * Marks the instant name on the calling thread.
+ */
+#define HOT_PATH_TRACE_INSTANT(name) MARTe2Tutorial::HotPathTraceRecord(name, 'i')
+#endif
+
+#endif /* INTERFACES_HOTPATHTRACER_HOTPATHTRACE_H_ */
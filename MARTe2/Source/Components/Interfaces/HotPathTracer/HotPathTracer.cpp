@@ -0,0 +1,205 @@
+/**
+ * @file HotPathTracer.cpp
+ * @brief Source file for class HotPathTracer
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HotPathTracer (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CLASSMETHODREGISTER.h"
+#include "File.h"
+#include "HotPathTracer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Default file name of Dump.
+ */
+const MARTe::char8 * const HOT_PATH_TRACER_DEFAULT_FILE_NAME = "/tmp/MARTeTrace.json";
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+HotPathTracer::HotPathTracer() :
+        MARTe::Object(), MARTe::MessageI() {
+    using namespace MARTe;
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
+}
+
+HotPathTracer::~HotPathTracer() {
+    (void) Disable();
+}
+
+bool HotPathTracer::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        if (!data.Read("FileName", fileName)) {
+            fileName = HOT_PATH_TRACER_DEFAULT_FILE_NAME;
+        }
+        uint32 eventsPerThread = HOT_PATH_TRACE_DEFAULT_EVENTS;
+        (void) data.Read("EventsPerThread", eventsPerThread);
+        ok = ((eventsPerThread > 0u) && ((eventsPerThread & (eventsPerThread - 1u)) == 0u));
+        if (ok) {
+            __atomic_store_n(&HotPathTraceGetRegistry().eventsPerThread, eventsPerThread, __ATOMIC_RELEASE);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "EventsPerThread shall be a power of 2");
+        }
+    }
+    if (ok) {
+        uint32 enabled = 1u;
+        (void) data.Read("Enabled", enabled);
+        if (enabled != 0u) {
+            (void) Enable();
+        }
+    }
+    return ok;
+}
+
+void HotPathTracer::Purge(MARTe::ReferenceContainer &purgeList) {
+    (void) RemoveMessageFilter(filter);
+    Object::Purge(purgeList);
+}
+
+MARTe::ErrorManagement::ErrorType HotPathTracer::Dump(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    StreamString name;
+    if (!data.Read("param1", name)) {
+        name = fileName;
+    }
+    ErrorManagement::ErrorType err;
+    err.fatalError = !DumpToFile(name.Buffer());
+    if (err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::Information, "Trace written to %s", name.Buffer());
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType HotPathTracer::Enable() {
+    __atomic_store_n(&HotPathTraceGetRegistry().enabled, 1u, __ATOMIC_RELEASE);
+    return MARTe::ErrorManagement::NoError;
+}
+
+MARTe::ErrorManagement::ErrorType HotPathTracer::Disable() {
+    __atomic_store_n(&HotPathTraceGetRegistry().enabled, 0u, __ATOMIC_RELEASE);
+    return MARTe::ErrorManagement::NoError;
+}
+
+bool HotPathTracer::DumpToFile(const MARTe::char8 * const name) const {
+    using namespace MARTe;
+    File file;
+    bool ok = file.Open(name, File::ACCESS_MODE_W | File::FLAG_CREAT | File::FLAG_TRUNC);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not open %s", name);
+    }
+    if (ok) {
+        ok = file.Printf("%s", "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    }
+    HotPathTraceRegistry &registry = HotPathTraceGetRegistry();
+    uint32 numberOfRings = __atomic_load_n(&registry.numberOfRings, __ATOMIC_ACQUIRE);
+    if (numberOfRings > HOT_PATH_TRACE_MAX_THREADS) {
+        numberOfRings = HOT_PATH_TRACE_MAX_THREADS;
+    }
+    int32 pid = static_cast<int32>(getpid());
+    float64 period = HighResolutionTimer::Period() * 1e6;
+    const char8 *separator = "";
+    uint32 r;
+    for (r = 0u; (r < numberOfRings) && (ok); r++) {
+        HotPathTraceRing * const ring = __atomic_load_n(&registry.rings[r], __ATOMIC_ACQUIRE);
+        if (ring != NULL_PTR(HotPathTraceRing *)) {
+            uint32 tid = r + 1u;
+            ok = file.Printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,", separator, pid, tid);
+            if (ok) {
+                ok = file.Printf("\"args\":{\"name\":\"%s\"}}", &ring->threadName[0]);
+            }
+            separator = ",\n";
+            //Take a copy, as the owner thread keeps recording
+            uint64 size = static_cast<uint64>(ring->mask) + 1u;
+            //Only the events of the current owner (start is read first, so that start <= head)
+            uint64 start = __atomic_load_n(&ring->start, __ATOMIC_ACQUIRE);
+            uint64 head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+            uint64 first = (head > size) ? (head - size) : (0u);
+            if (first < start) {
+                first = start;
+            }
+            uint32 numberOfEvents = static_cast<uint32>(head - first);
+            HotPathTraceEvent *events = new HotPathTraceEvent[numberOfEvents];
+            uint32 e;
+            for (e = 0u; e < numberOfEvents; e++) {
+                events[e] = ring->events[(first + e) & ring->mask];
+            }
+            //Skip the events which were overwritten while copying
+            uint64 headAfter = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+            uint64 firstValid = (headAfter > size) ? (headAfter - size) : (0u);
+            for (e = 0u; (e < numberOfEvents) && (ok); e++) {
+                if ((first + e) >= firstValid) {
+                    char8 phase[2] = { events[e].phase, '\0' };
+                    ok = file.Printf("%s{\"name\":\"%s\",\"ph\":\"%s\",", separator, events[e].name, &phase[0]);
+                    if (ok) {
+                        float64 timeStamp = static_cast<float64>(events[e].timeStamp) * period;
+                        ok = file.Printf("\"ts\":%.3f,\"pid\":%d,\"tid\":%d", timeStamp, pid, tid);
+                    }
+                    if ((ok) && (events[e].phase == 'i')) {
+                        ok = file.Printf("%s", ",\"s\":\"t\"");
+                    }
+                    if (ok) {
+                        ok = file.Printf("%s", "}");
+                    }
+                }
+            }
+            delete[] events;
+        }
+    }
+    if (ok) {
+        ok = file.Printf("%s", "\n]}\n");
+    }
+    uint32 untracedThreads = __atomic_load_n(&registry.untracedThreads, __ATOMIC_RELAXED);
+    if (untracedThreads > 0u) {
+        REPORT_ERROR(ErrorManagement::Warning, "%d threads were not traced, as %d threads were already being traced", untracedThreads,
+                     HOT_PATH_TRACE_MAX_THREADS);
+    }
+    (void) file.Close();
+    return ok;
+}
+
+CLASS_REGISTER(HotPathTracer, "")
+CLASS_METHOD_REGISTER(HotPathTracer, Dump)
+CLASS_METHOD_REGISTER(HotPathTracer, Enable)
+CLASS_METHOD_REGISTER(HotPathTracer, Disable)
+} // namespace MARTe2Tutorial
@@ -0,0 +1,150 @@
+/**
+ * @file HotPathTracer.h
+ * @brief Header file for class HotPathTracer
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * HotPathTracer with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef INTERFACES_HOTPATHTRACER_HOTPATHTRACER_H_
+#define INTERFACES_HOTPATHTRACER_HOTPATHTRACER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HotPathTrace.h"
+#include "MessageI.h"
+#include "Object.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Enables the hot-path tracing (see HotPathTrace.h) and dumps the
+ * traced events in the Chrome/Perfetto JSON trace format.
+ *
+ * @details The events of every traced thread are written as
+ * ui.perfetto.dev and chrome://tracing expect them, with the timestamps in
+ * microseconds of the HighResolutionTimer and one track per thread, named
+ * after the MARTe thread name. The rings are read while the threads keep
+ * recording: the events which were overwritten during the dump are skipped.
+ *
+ * The Dump, Enable and Disable functions are registered for RPC, so that the
+ * trace can be taken on demand, e.g. through a TCPSocketMessageProxy or from
+ * the StateMachine. The optional param1 of Dump overrides the FileName.
+ *
+ * Each traced thread holds a ring of EventsPerThread events of 24 bytes
+ * (1.5 MB with the default), which is reused by another thread after it
+ * exits. The EventsPerThread only applies to the rings allocated after the
+ * HotPathTracer is initialised. The threads which start tracing while
+ * HOT_PATH_TRACE_MAX_THREADS threads hold a ring are not traced and are
+ * reported by Dump.
+ *
+ * <pre>
+ * +Tracer = {
+ *     Class = HotPathTracer
+ *     FileName = "/tmp/MARTeTrace.json" //Optional. Default = /tmp/MARTeTrace.json.
+ *     EventsPerThread = 65536 //Optional. Power of 2. Default = 65536.
+ *     Enabled = 1 //Optional. Record from the start. Default = 1.
+ * }
+ * </pre>
+ */
+class HotPathTracer : public MARTe::Object, public MARTe::MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the message filter.
+     */
+    HotPathTracer();
+
+    /**
+     * @brief Destructor. Disables the tracing. The rings are not freed, as
+     * the threads may still hold them, but are reused (see HotPathTrace.h).
+     */
+    virtual ~HotPathTracer();
+
+    /**
+     * @brief Reads the parameters listed in the class description and
+     * enables the tracing if Enabled.
+     * @param[in] data see Object::Initialise.
+     * @return true if EventsPerThread is a power of 2.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Removes the message filter.
+     * @details See Object::Purge
+     */
+    virtual void Purge(MARTe::ReferenceContainer &purgeList);
+
+    /**
+     * @brief Writes the traced events to a file.
+     * @details Registered for RPC.
+     * @param[in] data may contain param1, the name of the file.
+     * @return ErrorManagement::NoError if the file could be written.
+     */
+    MARTe::ErrorManagement::ErrorType Dump(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Starts recording events.
+     * @details Registered for RPC.
+     * @return ErrorManagement::NoError.
+     */
+    MARTe::ErrorManagement::ErrorType Enable();
+
+    /**
+     * @brief Stops recording events.
+     * @details Registered for RPC.
+     * @return ErrorManagement::NoError.
+     */
+    MARTe::ErrorManagement::ErrorType Disable();
+
+    /**
+     * @brief Writes the traced events to a file.
+     * @param[in] name the name of the file.
+     * @return true if the file could be written.
+     */
+    bool DumpToFile(const MARTe::char8 * const name) const;
+
+private:
+    /**
+     * The default file name of Dump.
+     */
+    MARTe::StreamString fileName;
+
+    /**
+     * The message filter.
+     */
+    MARTe::ReferenceT<MARTe::RegisteredMethodsMessageFilter> filter;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_HOTPATHTRACER_HOTPATHTRACER_H_ */
@@ -0,0 +1,448 @@
+/**
+ * @file MultiRateScheduler.cpp
+ * @brief Source file for class MultiRateScheduler
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MultiRateScheduler (public, protected, and private). Be aware
+ * that some methods, such as those inline could be defined on the header
+ * file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GAM.h"
+#include "HighResolutionTimer.h"
+#include "HotPathTrace.h"
+#include "MultiRateScheduler.h"
+#include "RealTimeApplication.h"
+#include "ReferenceContainer.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The longest hyperperiod (in cycles) over which the phases are staggered.
+ */
+const MARTe::uint32 MULTI_RATE_SCHEDULER_MAX_HYPERPERIOD = 10000u;
+
+/**
+ * @brief Appends a group to a thread.
+ * @param[in] rate the rate of the group, NULL to execute it in every cycle.
+ */
+void AddGroup(MARTe2Tutorial::MultiRateSchedulerThread &thread,
+              MARTe::ExecutableI * const * const executables,
+              const MARTe::uint32 numberOfExecutables,
+              const MARTe2Tutorial::MultiRateSchedulerRate * const rate) {
+    using namespace MARTe;
+    MARTe2Tutorial::MultiRateSchedulerGroup &group = thread.groups[thread.numberOfGroups];
+    group.executables = executables;
+    group.numberOfExecutables = numberOfExecutables;
+    group.name = NULL_PTR(const char8 *);
+    group.divider = 1u;
+    group.phase = 0u;
+    group.weight = 1u;
+    if (rate != NULL_PTR(const MARTe2Tutorial::MultiRateSchedulerRate *)) {
+        group.name = rate->name.Buffer();
+        group.divider = rate->divider;
+        //A GAM executed in every cycle has no phase to stagger
+        group.phase = (rate->divider > 1u) ? (rate->phase) : (0u);
+        group.weight = rate->weight;
+    }
+    group.countdown = group.phase;
+    thread.numberOfGroups++;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+MultiRateSchedulerThread::MultiRateSchedulerThread() :
+        MARTe::EmbeddedServiceMethodBinderI(),
+        executor(*this) {
+    scheduler = NULL_PTR(MultiRateScheduler *);
+    groups = NULL_PTR(MultiRateSchedulerGroup *);
+    numberOfGroups = 0u;
+    active = NULL_PTR(MARTe::ExecutableI **);
+    cycleTime = NULL_PTR(MARTe::uint32 *);
+    lastCycleStart = 0u;
+}
+
+MultiRateSchedulerThread::~MultiRateSchedulerThread() {
+    using namespace MARTe;
+    if (executor.GetStatus() != EmbeddedThreadI::OffState) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            if (executor.Stop() != ErrorManagement::NoError) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not Stop the thread");
+            }
+        }
+    }
+    if (groups != NULL_PTR(MultiRateSchedulerGroup *)) {
+        delete[] groups;
+    }
+    if (active != NULL_PTR(ExecutableI **)) {
+        delete[] active;
+    }
+}
+
+MARTe::ErrorManagement::ErrorType MultiRateSchedulerThread::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        err = scheduler->ExecuteCycle(*this);
+    }
+    return err;
+}
+
+MultiRateScheduler::MultiRateScheduler() :
+        MARTe::GAMSchedulerI() {
+    rates = NULL_PTR(MultiRateSchedulerRate *);
+    numberOfRates = 0u;
+    threads[0u] = NULL_PTR(MultiRateSchedulerThread *);
+    threads[1u] = NULL_PTR(MultiRateSchedulerThread *);
+    numberOfThreads[0u] = 0u;
+    numberOfThreads[1u] = 0u;
+}
+
+MultiRateScheduler::~MultiRateScheduler() {
+    MARTe::uint32 buffer;
+    for (buffer = 0u; buffer < 2u; buffer++) {
+        (void) StopThreads(buffer);
+        if (threads[buffer] != NULL_PTR(MultiRateSchedulerThread *)) {
+            delete[] threads[buffer];
+        }
+    }
+    if (rates != NULL_PTR(MultiRateSchedulerRate *)) {
+        delete[] rates;
+    }
+}
+
+bool MultiRateScheduler::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = GAMSchedulerI::Initialise(data);
+    if ((ok) && (data.MoveRelative("Rates"))) {
+        numberOfRates = data.GetNumberOfChildren();
+        rates = new MultiRateSchedulerRate[numberOfRates];
+        uint32 i;
+        for (i = 0u; (i < numberOfRates) && (ok); i++) {
+            rates[i].name = data.GetChildName(i);
+            ok = data.MoveRelative(rates[i].name.Buffer());
+            if (ok) {
+                ok = data.Read("Divider", rates[i].divider);
+                if (ok) {
+                    ok = (rates[i].divider > 0u);
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The Divider of %s shall be set and > 0", rates[i].name.Buffer());
+                }
+                if (ok) {
+                    if (data.Read("Phase", rates[i].phase)) {
+                        ok = (rates[i].phase < rates[i].divider);
+                        if (!ok) {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "The Phase of %s shall be < Divider", rates[i].name.Buffer());
+                        }
+                    }
+                    else {
+                        rates[i].phase = rates[i].divider;
+                    }
+                }
+                if (ok) {
+                    if (!data.Read("Weight", rates[i].weight)) {
+                        rates[i].weight = 1u;
+                    }
+                }
+                if (!data.MoveToAncestor(1u)) {
+                    ok = false;
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The rate of %s shall be a node", rates[i].name.Buffer());
+            }
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+MARTe::ErrorManagement::ErrorType MultiRateScheduler::StartNextStateExecution() {
+    using namespace MARTe;
+    uint32 buffer = RealTimeApplication::GetIndex();
+    ErrorManagement::ErrorType err = StopThreads((buffer + 1u) & 0x1u);
+    ScheduledState * const state = GetSchedulableStates()[buffer];
+    uint32 i;
+    for (i = 0u; (i < numberOfThreads[buffer]) && (err.ErrorsCleared()); i++) {
+        ScheduledThread &scheduledThread = state->threads[i];
+        MultiRateSchedulerThread &thread = threads[buffer][i];
+        thread.executor.SetName(scheduledThread.name);
+        thread.executor.SetCPUMask(scheduledThread.cpu);
+        thread.executor.SetStackSize(scheduledThread.stackSize);
+        thread.executor.SetPriorityClass(Threads::RealTimePriorityClass);
+        err = thread.executor.Start();
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the thread %s", scheduledThread.name);
+        }
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType MultiRateScheduler::StopCurrentStateExecution() {
+    return StopThreads(MARTe::RealTimeApplication::GetIndex());
+}
+
+void MultiRateScheduler::CustomPrepareNextState() {
+    using namespace MARTe;
+    uint32 nextBuffer = (RealTimeApplication::GetIndex() + 1u) & 0x1u;
+    //The threads of this buffer were stopped when the current state was started
+    if (threads[nextBuffer] != NULL_PTR(MultiRateSchedulerThread *)) {
+        delete[] threads[nextBuffer];
+        threads[nextBuffer] = NULL_PTR(MultiRateSchedulerThread *);
+    }
+    ScheduledState * const nextState = GetSchedulableStates()[nextBuffer];
+    numberOfThreads[nextBuffer] = nextState->numberOfThreads;
+    if (numberOfThreads[nextBuffer] > 0u) {
+        threads[nextBuffer] = new MultiRateSchedulerThread[numberOfThreads[nextBuffer]];
+    }
+    uint32 i;
+    for (i = 0u; i < numberOfThreads[nextBuffer]; i++) {
+        if (!ConfigureThread(nextState->threads[i], threads[nextBuffer][i])) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not group the GAMs of %s.%s", nextState->name, nextState->threads[i].name);
+        }
+    }
+}
+
+MARTe::ErrorManagement::ErrorType MultiRateScheduler::ExecuteCycle(MultiRateSchedulerThread &thread) {
+    using namespace MARTe;
+    HOT_PATH_TRACE_BEGIN("MultiRateScheduler::ExecuteCycle");
+    uint64 start = HighResolutionTimer::Counter();
+    if ((thread.cycleTime != NULL_PTR(uint32 *)) && (thread.lastCycleStart != 0u)) {
+        *thread.cycleTime = static_cast<uint32>(static_cast<float64>(start - thread.lastCycleStart) * HighResolutionTimer::Period() * 1e6);
+    }
+    thread.lastCycleStart = start;
+    uint32 numberOfActive = 0u;
+    uint32 g;
+    for (g = 0u; g < thread.numberOfGroups; g++) {
+        MultiRateSchedulerGroup &group = thread.groups[g];
+        if (group.countdown == 0u) {
+            uint32 e;
+            for (e = 0u; e < group.numberOfExecutables; e++) {
+                thread.active[numberOfActive] = group.executables[e];
+                numberOfActive++;
+            }
+            group.countdown = group.divider - 1u;
+        }
+        else {
+            group.countdown--;
+        }
+    }
+    ErrorManagement::ErrorType err;
+    err.fatalError = !ExecuteSingleCycle(thread.active, numberOfActive);
+    HOT_PATH_TRACE_END("MultiRateScheduler::ExecuteCycle");
+    return err;
+}
+
+bool MultiRateScheduler::ConfigureThread(MARTe::ScheduledThread &scheduledThread,
+                                         MultiRateSchedulerThread &thread) {
+    using namespace MARTe;
+    uint32 numberOfExecutables = scheduledThread.numberOfExecutables;
+    ExecutableI * const * const executables = scheduledThread.executables;
+    thread.scheduler = this;
+    thread.cycleTime = scheduledThread.cycleTime;
+    thread.lastCycleStart = 0u;
+    //At most one group per executable
+    uint32 size = (numberOfExecutables > 0u) ? (numberOfExecutables) : (1u);
+    thread.active = new ExecutableI*[size];
+    thread.groups = new MultiRateSchedulerGroup[size];
+    thread.numberOfGroups = 0u;
+    //The executables of each GAM are its input brokers, the GAM and its output brokers
+    uint32 cursor = 0u;
+    bool ok = true;
+    uint32 e;
+    for (e = 0u; (e < numberOfExecutables) && (ok); e++) {
+        GAM *gam = dynamic_cast<GAM *>(executables[e]);
+        if (gam != NULL_PTR(GAM *)) {
+            ReferenceContainer inputBrokers;
+            ReferenceContainer outputBrokers;
+            ok = gam->GetInputBrokers(inputBrokers);
+            if (ok) {
+                ok = gam->GetOutputBrokers(outputBrokers);
+            }
+            if (ok) {
+                uint32 first = cursor;
+                if (e >= (cursor + inputBrokers.Size())) {
+                    first = e - inputBrokers.Size();
+                }
+                uint32 last = e + outputBrokers.Size();
+                if (last >= numberOfExecutables) {
+                    last = numberOfExecutables - 1u;
+                }
+                if (first > cursor) {
+                    AddGroup(thread, &executables[cursor], first - cursor, NULL_PTR(MultiRateSchedulerRate *));
+                }
+                const MultiRateSchedulerRate *rate = NULL_PTR(MultiRateSchedulerRate *);
+                uint32 r;
+                for (r = 0u; (r < numberOfRates) && (rate == NULL_PTR(MultiRateSchedulerRate *)); r++) {
+                    if (rates[r].name == gam->GetName()) {
+                        rate = &rates[r];
+                    }
+                }
+                AddGroup(thread, &executables[first], (last - first) + 1u, rate);
+                cursor = last + 1u;
+                e = last;
+            }
+        }
+    }
+    if ((ok) && (cursor < numberOfExecutables)) {
+        AddGroup(thread, &executables[cursor], numberOfExecutables - cursor, NULL_PTR(MultiRateSchedulerRate *));
+    }
+    if (ok) {
+        StaggerPhases(thread, scheduledThread.name);
+    }
+    return ok;
+}
+
+void MultiRateScheduler::StaggerPhases(MultiRateSchedulerThread &thread,
+                                       const MARTe::char8 * const threadName) const {
+    using namespace MARTe;
+    uint32 hyperperiod = 1u;
+    bool bounded = true;
+    uint32 g;
+    for (g = 0u; (g < thread.numberOfGroups) && (bounded); g++) {
+        uint32 divider = thread.groups[g].divider;
+        if (divider > 1u) {
+            uint32 a = hyperperiod;
+            uint32 b = divider;
+            while (b != 0u) {
+                uint32 remainder = a % b;
+                a = b;
+                b = remainder;
+            }
+            uint64 lcm = (static_cast<uint64>(hyperperiod) / a) * divider;
+            bounded = (lcm <= MULTI_RATE_SCHEDULER_MAX_HYPERPERIOD);
+            if (bounded) {
+                hyperperiod = static_cast<uint32>(lcm);
+            }
+        }
+    }
+    if (bounded) {
+        //The load of each cycle of the hyperperiod, starting with the configured phases
+        uint32 *load = new uint32[hyperperiod];
+        uint32 s;
+        for (s = 0u; s < hyperperiod; s++) {
+            load[s] = 0u;
+        }
+        for (g = 0u; g < thread.numberOfGroups; g++) {
+            MultiRateSchedulerGroup &group = thread.groups[g];
+            if ((group.divider > 1u) && (group.phase < group.divider)) {
+                for (s = group.phase; s < hyperperiod; s += group.divider) {
+                    load[s] += group.weight;
+                }
+            }
+        }
+        //Place the heaviest first, in the phase with the lowest peak (and then total) load
+        uint32 next;
+        do {
+            next = thread.numberOfGroups;
+            for (g = 0u; g < thread.numberOfGroups; g++) {
+                MultiRateSchedulerGroup &group = thread.groups[g];
+                if (group.phase == group.divider) {
+                    if ((next == thread.numberOfGroups) || (group.weight > thread.groups[next].weight)) {
+                        next = g;
+                    }
+                }
+            }
+            if (next < thread.numberOfGroups) {
+                MultiRateSchedulerGroup &group = thread.groups[next];
+                uint32 bestPhase = 0u;
+                uint32 bestPeak = 0xFFFFFFFFu;
+                uint32 bestTotal = 0xFFFFFFFFu;
+                uint32 p;
+                for (p = 0u; p < group.divider; p++) {
+                    uint32 peak = 0u;
+                    uint32 total = 0u;
+                    for (s = p; s < hyperperiod; s += group.divider) {
+                        if (load[s] > peak) {
+                            peak = load[s];
+                        }
+                        total += load[s];
+                    }
+                    if ((peak < bestPeak) || ((peak == bestPeak) && (total < bestTotal))) {
+                        bestPhase = p;
+                        bestPeak = peak;
+                        bestTotal = total;
+                    }
+                }
+                group.phase = bestPhase;
+                for (s = bestPhase; s < hyperperiod; s += group.divider) {
+                    load[s] += group.weight;
+                }
+            }
+        }
+        while (next < thread.numberOfGroups);
+        delete[] load;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "The Dividers of %s have a hyperperiod longer than %d cycles: the phases are set in order", threadName,
+                     MULTI_RATE_SCHEDULER_MAX_HYPERPERIOD);
+        uint32 placed = 0u;
+        for (g = 0u; g < thread.numberOfGroups; g++) {
+            MultiRateSchedulerGroup &group = thread.groups[g];
+            if (group.phase == group.divider) {
+                group.phase = placed % group.divider;
+                placed++;
+            }
+        }
+    }
+    for (g = 0u; g < thread.numberOfGroups; g++) {
+        MultiRateSchedulerGroup &group = thread.groups[g];
+        group.countdown = group.phase;
+        if (group.divider > 1u) {
+            REPORT_ERROR(ErrorManagement::Information, "%s: %s every %d cycles with phase %d", threadName, group.name, group.divider, group.phase);
+        }
+    }
+}
+
+MARTe::ErrorManagement::ErrorType MultiRateScheduler::StopThreads(const MARTe::uint32 buffer) {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    uint32 i;
+    for (i = 0u; i < numberOfThreads[buffer]; i++) {
+        SingleThreadService &executor = threads[buffer][i].executor;
+        if (executor.GetStatus() != EmbeddedThreadI::OffState) {
+            if (executor.Stop() != ErrorManagement::NoError) {
+                err = executor.Stop();
+                if (!err.ErrorsCleared()) {
+                    REPORT_ERROR(ErrorManagement::Warning, "Could not Stop the thread %d", i);
+                }
+            }
+        }
+    }
+    return err;
+}
+
+CLASS_REGISTER(MultiRateScheduler, "")
+} // namespace MARTe2Tutorial
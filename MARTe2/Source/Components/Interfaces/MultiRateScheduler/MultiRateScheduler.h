@@ -0,0 +1,309 @@
+/**
+ * @file MultiRateScheduler.h
+ * @brief Header file for class MultiRateScheduler
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * MultiRateScheduler with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef INTERFACES_MULTIRATESCHEDULER_MULTIRATESCHEDULER_H_
+#define INTERFACES_MULTIRATESCHEDULER_MULTIRATESCHEDULER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "ExecutableI.h"
+#include "GAMSchedulerI.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+/**
+ * @brief The configured rate of a GAM.
+ */
+struct MultiRateSchedulerRate {
+    /**
+     * The name of the GAM.
+     */
+    MARTe::StreamString name;
+
+    /**
+     * The GAM is executed every divider cycles.
+     */
+    MARTe::uint32 divider;
+
+    /**
+     * The first cycle of the GAM (< divider), or divider if the phase is to
+     * be staggered by the scheduler.
+     */
+    MARTe::uint32 phase;
+
+    /**
+     * The relative cost of the GAM, used to stagger the phases.
+     */
+    MARTe::uint32 weight;
+};
+
+/**
+ * @brief A GAM with its brokers, executed (or skipped) together.
+ */
+struct MultiRateSchedulerGroup {
+    /**
+     * The input brokers, the GAM and the output brokers.
+     */
+    MARTe::ExecutableI * const *executables;
+
+    /**
+     * The number of executables.
+     */
+    MARTe::uint32 numberOfExecutables;
+
+    /**
+     * The name of the GAM (NULL if executed in every cycle).
+     */
+    const MARTe::char8 *name;
+
+    /**
+     * See MultiRateSchedulerRate.
+     */
+    MARTe::uint32 divider;
+
+    /**
+     * See MultiRateSchedulerRate.
+     */
+    MARTe::uint32 phase;
+
+    /**
+     * See MultiRateSchedulerRate.
+     */
+    MARTe::uint32 weight;
+
+    /**
+     * The number of cycles until the next execution.
+     */
+    MARTe::uint32 countdown;
+};
+
+class MultiRateScheduler;
+
+/**
+ * @brief A real-time thread of a state.
+ */
+class MultiRateSchedulerThread : public MARTe::EmbeddedServiceMethodBinderI {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MultiRateSchedulerThread();
+
+    /**
+     * @brief Destructor. Stops the thread and frees the groups.
+     */
+    virtual ~MultiRateSchedulerThread();
+
+    /**
+     * @brief Executes one cycle (see MultiRateScheduler::ExecuteCycle).
+     * @param[in] info see EmbeddedServiceMethodBinderI::Execute.
+     * @return the result of the cycle.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+    /**
+     * The scheduler.
+     */
+    MultiRateScheduler *scheduler;
+
+    /**
+     * The groups, in the order of the thread.
+     */
+    MultiRateSchedulerGroup *groups;
+
+    /**
+     * The number of groups.
+     */
+    MARTe::uint32 numberOfGroups;
+
+    /**
+     * The executables of the current cycle.
+     */
+    MARTe::ExecutableI **active;
+
+    /**
+     * Where to write the cycle time.
+     */
+    MARTe::uint32 *cycleTime;
+
+    /**
+     * The start of the last cycle.
+     */
+    MARTe::uint64 lastCycleStart;
+
+    /**
+     * The thread.
+     */
+    MARTe::SingleThreadService executor;
+};
+
+/**
+ * @brief A GAMScheduler which executes some GAMs only every Divider cycles
+ * of their thread.
+ *
+ * @details The threads are created, and their cycle times written, as by
+ * the GAMScheduler. In each cycle of a thread, a GAM with a Divider of N is
+ * executed, together with its input and output brokers, only if the number
+ * of cycles of the thread since the start of the state, modulo N, is equal
+ * to its Phase. When a GAM is skipped its output signals keep their last
+ * value and the DataSources which it writes are not updated, so that, for
+ * example, a logger can be executed at 1/10 of the rate of the control in
+ * the same thread, without a second thread and a
+ * RealTimeThreadSynchronisation.
+ *
+ * If the Phase of a GAM is not set, the scheduler chooses, for each thread,
+ * the phase which minimises the maximum of the sum of the Weight of the
+ * divided GAMs executed in the same cycle, so that, e.g., two heavy GAMs
+ * with Divider = 2 are executed in alternate cycles. The GAMs are placed
+ * from the heaviest. The chosen phases are reported when the state is
+ * prepared.
+ *
+ * The GAMs which are not in Rates are executed in every cycle. The GAM
+ * which synchronises the thread (e.g. the one which reads a LinuxTimer)
+ * shall not be divided. The rates apply to the GAM in all the states and
+ * threads where it is executed.
+ *
+ * <pre>
+ * +Scheduler = {
+ *     Class = MultiRateScheduler
+ *     TimingDataSource = Timings
+ *     Rates = {
+ *         GAMPub = {
+ *             Divider = 2 //Compulsory. > 0.
+ *         }
+ *         GAMLogger = {
+ *             Divider = 10 //Compulsory. > 0.
+ *             Phase = 3 //Optional. < Divider. Default = staggered by the scheduler.
+ *             Weight = 4 //Optional. The relative cost of the GAM. Default = 1.
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class MultiRateScheduler : public MARTe::GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MultiRateScheduler();
+
+    /**
+     * @brief Destructor. Stops and frees the threads.
+     */
+    virtual ~MultiRateScheduler();
+
+    /**
+     * @brief Reads the Rates (see the class description).
+     * @param[in] data see GAMSchedulerI::Initialise.
+     * @return true if all the Divider are > 0 and all the Phase < Divider.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Stops the threads of the previous state and starts the threads
+     * of the next one.
+     * @return ErrorManagement::NoError if the threads could be started.
+     */
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution();
+
+    /**
+     * @brief Stops the threads of the current state.
+     * @return ErrorManagement::NoError if the threads could be stopped.
+     */
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution();
+
+    /**
+     * @brief Groups the executables of each thread of the next state by GAM
+     * and sets the phases of the groups.
+     */
+    virtual void CustomPrepareNextState();
+
+    /**
+     * @brief Writes the cycle time and executes the groups which are due
+     * in this cycle.
+     * @param[in] thread the thread.
+     * @return ErrorManagement::FatalError if an executable failed.
+     */
+    MARTe::ErrorManagement::ErrorType ExecuteCycle(MultiRateSchedulerThread &thread);
+
+private:
+    /**
+     * @brief Builds the groups of a thread.
+     * @return true if the groups could be built.
+     */
+    bool ConfigureThread(MARTe::ScheduledThread &scheduledThread,
+                         MultiRateSchedulerThread &thread);
+
+    /**
+     * @brief Sets the phases which were not configured.
+     */
+    void StaggerPhases(MultiRateSchedulerThread &thread,
+                       const MARTe::char8 * const threadName) const;
+
+    /**
+     * @brief Stops the threads of a buffer.
+     * @return ErrorManagement::NoError if the threads could be stopped.
+     */
+    MARTe::ErrorManagement::ErrorType StopThreads(const MARTe::uint32 buffer);
+
+    /**
+     * The rates read from the configuration.
+     */
+    MultiRateSchedulerRate *rates;
+
+    /**
+     * The number of rates.
+     */
+    MARTe::uint32 numberOfRates;
+
+    /**
+     * The threads of each state buffer.
+     */
+    MultiRateSchedulerThread *threads[2];
+
+    /**
+     * The number of threads of each state buffer.
+     */
+    MARTe::uint32 numberOfThreads[2];
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_MULTIRATESCHEDULER_MULTIRATESCHEDULER_H_ */
@@ -34,6 +34,7 @@
 #include "OPCUAClient.h"
 #include "RegisteredMethodsMessageFilter.h"
 #include "OPCUAVariable.h"
+#include "HotPathTrace.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -215,11 +216,13 @@ ErrorManagement::ErrorType OPCUAClient::Execute(ExecutionInfo& info) {
     else if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
         //  REPORT_ERROR(ErrorManagement::Information, "Sleeping - Stage != ExecutionInfo::BadTerminationStage"); // <<< PM
         Sleep::Sec(0.1F);
+        HOT_PATH_TRACE_BEGIN("OPCUAClient::Execute");
         OPCUAVariable::Lock();
 //        UA_Client_runAsync(opcuaClient,100);//changed from run_iterate
         if (connected)
             UA_Client_run_iterate(opcuaClient, 100);
         OPCUAVariable::UnLock();
+        HOT_PATH_TRACE_END("OPCUAClient::Execute");
     }
     #if LOCALDEB
     else {
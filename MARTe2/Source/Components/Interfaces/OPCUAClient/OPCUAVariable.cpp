@@ -31,8 +31,10 @@
 
 #include "ConfigurationDatabase.h"
 #include "CLASSMETHODREGISTER.h"
+#include "HeapManager.h"
 #include "RegisteredMethodsMessageFilter.h"
 #include "OPCUAVariable.h"
+#include "HotPathTrace.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -126,6 +128,7 @@ OPCUAVariable::OPCUAVariable() :
     functionMap[1u] = NULL_PTR(StreamString *);
 
     pvMemory = NULL_PTR(void *);
+    heap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
     memorySize = 0u;
     typeSize = 0u;
 
@@ -159,7 +162,7 @@ OPCUAVariable::~OPCUAVariable() {
             }
         }
         else {
-            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(pvMemory);
+            heap->Free(pvMemory);
         }
     }
     if (path != NULL_PTR(StreamString *))
@@ -183,6 +186,16 @@ bool OPCUAVariable::Initialise(StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::Warning, "numberOfElements not set. Using default of %d", numberOfElements);
         }
     }
+    if (ok) {
+        StreamString heapName;
+        if (data.Read("HeapName", heapName)) {
+            heap = HeapManager::FindHeap(heapName.Buffer());
+            ok = (heap != NULL_PTR(HeapI *));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Could not find a heap with the name %s", heapName.Buffer());
+            }
+        }
+    }
     if (ok) {
         if (!data.Read("NameSpaceIndex", nameSpaceIndex)) {
             REPORT_ERROR(ErrorManagement::Warning, "NameSpaceIndex not set. Using default of %d", nameSpaceIndex);
@@ -235,7 +248,7 @@ bool OPCUAVariable::Initialise(StructuredDataI & data) {
                 ok = ParsePath();
 
             if (ok)
-                pvMemory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize);
+                pvMemory = heap->Malloc(memorySize);
         }
     }
 
@@ -706,6 +719,7 @@ void OPCUAVariable::HandlePVEvent(UA_DataValue *value) {
 }
 
 void OPCUAVariable::TriggerEventMessage() {
+    HOT_PATH_TRACE_BEGIN("OPCUAVariable::TriggerEventMessage");
     ConfigurationDatabase cdb;
     bool ok = cdb.Write("Destination", destination.Buffer());
     if (eventMode.function.operator bool()) {
@@ -779,7 +793,7 @@ void OPCUAVariable::TriggerEventMessage() {
         }
     }
     if (ok) {
-        ReferenceT<Message> message(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ReferenceT<Message> message(heap);
         ok = message->Initialise(cdb);
         if (ok) {
             if (MessageI::SendMessage(message, this) != ErrorManagement::NoError) {
@@ -792,6 +806,7 @@ void OPCUAVariable::TriggerEventMessage() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not Initialise message");
         }
     }
+    HOT_PATH_TRACE_END("OPCUAVariable::TriggerEventMessage");
 }
 
 /*lint -e{1762} function cannot be made const as it is registered as an RPC*/
@@ -34,6 +34,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "HeapI.h"
 #include "MessageI.h"
 #include "Object.h"
 #include "StreamString.h"
@@ -58,6 +59,7 @@ namespace MARTe {
  *   NumberOfElements = 1 //Optional. Number of elements
  *   NameSpaceIndex = 1 // Optional 
  *   Timeout = 5.0 //Optional but if set shall be > 0. The timeout for the ca_pend_io operations in seconds. Default value is 5.0 s.
+ *   HeapName = RealTimeHeap //Optional. The heap (see HeapManager) of the PV memory and of the event Messages. Default value is the standard heap.
  *   Event = { //Optional. Information about the message to be triggered every-time the OPCUA PV value changes.
  *     Destination = StateMachine //Compulsory. Destination of the message.
  *     PVValue = Function //Compulsory. Can either be Function, Parameter, ParameterName or Ignore.
@@ -439,6 +441,11 @@ private:
      */
     void *pvMemory;
 
+    /**
+     * The heap of pvMemory and of the event Messages.
+     */
+    HeapI *heap;
+
     /**
      * The total memory size
      */
@@ -0,0 +1,136 @@
+/**
+ * @file PrefaultGAM.cpp
+ * @brief Source file for class PrefaultGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PrefaultGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <alloca.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "PrefaultGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Default StackPrefault.
+ */
+const MARTe::uint32 PREFAULT_GAM_DEFAULT_STACK = 65536u;
+
+/**
+ * Maximum StackPrefault.
+ */
+const MARTe::uint32 PREFAULT_GAM_MAX_STACK = 64u * 1024u * 1024u;
+
+/**
+ * One write per page is enough.
+ */
+const MARTe::uint32 PREFAULT_GAM_PAGE_SIZE = 4096u;
+
+/**
+ * @brief Writes one byte per page of size bytes of the stack below the caller.
+ * @details Not inlined, so that the memory is released when it returns.
+ */
+__attribute__((noinline)) void PrefaultStack(const MARTe::uint32 size) {
+    using namespace MARTe;
+    volatile char8 *stack = static_cast<volatile char8 *>(alloca(size));
+    uint32 i;
+    for (i = 0u; i < size; i += PREFAULT_GAM_PAGE_SIZE) {
+        stack[i] = '\0';
+    }
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+PrefaultGAM::PrefaultGAM() :
+        MARTe::GAM(),
+        MARTe::StatefulI() {
+    stackPrefault = PREFAULT_GAM_DEFAULT_STACK;
+    heapPrefault = 0u;
+    prefaulted = false;
+}
+
+PrefaultGAM::~PrefaultGAM() {
+}
+
+bool PrefaultGAM::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        (void) data.Read("StackPrefault", stackPrefault);
+        (void) data.Read("HeapPrefault", heapPrefault);
+        ok = (stackPrefault < PREFAULT_GAM_MAX_STACK);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "StackPrefault shall be smaller than %d", PREFAULT_GAM_MAX_STACK);
+        }
+    }
+    return ok;
+}
+
+bool PrefaultGAM::Setup() {
+    using namespace MARTe;
+    bool ok = ((GetNumberOfInputSignals() == 0u) && (GetNumberOfOutputSignals() == 0u));
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "No signals shall be set");
+    }
+    return ok;
+}
+
+bool PrefaultGAM::PrepareNextState(const MARTe::char8 * const currentStateName,
+                                   const MARTe::char8 * const nextStateName) {
+    //The next state may be executed by another thread
+    prefaulted = false;
+    return true;
+}
+
+bool PrefaultGAM::Execute() {
+    using namespace MARTe;
+    if (!prefaulted) {
+        if (stackPrefault > 0u) {
+            PrefaultStack(stackPrefault);
+        }
+        if (heapPrefault > 0u) {
+            void *heap = malloc(heapPrefault);
+            if (heap != NULL_PTR(void *)) {
+                (void) memset(heap, 0, heapPrefault);
+                free(heap);
+            }
+        }
+        prefaulted = true;
+    }
+    return true;
+}
+
+CLASS_REGISTER(PrefaultGAM, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,129 @@
+/**
+ * @file PrefaultGAM.h
+ * @brief Header file for class PrefaultGAM
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * PrefaultGAM with all of its public, protected and private members. It may
+ * also include definitions for inline methods which need to be visible to
+ * the compiler.
+ */
+
+#ifndef INTERFACES_REALTIMEMEMORY_PREFAULTGAM_H_
+#define INTERFACES_REALTIMEMEMORY_PREFAULTGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "StatefulI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Prefaults the stack and the heap of the RealTimeThread which
+ * executes it.
+ *
+ * @details In its first cycle after each state change, the GAM writes
+ * StackPrefault bytes below its stack frame and allocates, writes and frees
+ * HeapPrefault bytes, so that the pages which the other GAMs of the thread
+ * use are already mapped. The page faults are thus all taken in one, known,
+ * cycle instead of being spread over the first cycles of the state. In the
+ * following cycles the GAM does nothing.
+ *
+ * Shall be the first of the Functions of the thread. The StackPrefault
+ * shall be smaller than the StackSize of the thread. Not needed for the
+ * stack if a RealTimeMemory with LockMemory was initialised, as the stacks
+ * of the threads are then populated when the threads are created. The
+ * heap pages are only kept by the allocator after the free if a
+ * RealTimeMemory with HeapPrefault disabled the trimming.
+ *
+ * <pre>
+ * +GAMPrefault = {
+ *     Class = PrefaultGAM
+ *     StackPrefault = 65536 //Optional. Default = 65536.
+ *     HeapPrefault = 1048576 //Optional. Default = 0.
+ * }
+ * </pre>
+ */
+class PrefaultGAM : public MARTe::GAM, public MARTe::StatefulI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    PrefaultGAM();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~PrefaultGAM();
+
+    /**
+     * @brief Reads the StackPrefault and the HeapPrefault.
+     * @return true if the StackPrefault is smaller than 64 MB.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Checks that there are no signals.
+     * @return true if there are no signals.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Prefaults the memory again in the next first cycle.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const MARTe::char8 * const currentStateName,
+                                  const MARTe::char8 * const nextStateName);
+
+    /**
+     * @brief Prefaults the stack and the heap in the first cycle.
+     * @return true.
+     */
+    virtual bool Execute();
+
+private:
+    /**
+     * The number of bytes of stack to prefault.
+     */
+    MARTe::uint32 stackPrefault;
+
+    /**
+     * The number of bytes of heap to prefault.
+     */
+    MARTe::uint32 heapPrefault;
+
+    /**
+     * True once the memory is prefaulted.
+     */
+    bool prefaulted;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_REALTIMEMEMORY_PREFAULTGAM_H_ */
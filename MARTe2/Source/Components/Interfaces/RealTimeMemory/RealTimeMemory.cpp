@@ -0,0 +1,195 @@
+/**
+ * @file RealTimeMemory.cpp
+ * @brief Source file for class RealTimeMemory
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeMemory (public, protected, and private). Be aware that
+ * some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HeapManager.h"
+#include "RealTimeMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+RealTimeMemory::RealTimeMemory() :
+        MARTe::Object() {
+    heap = NULL_PTR(RealTimePoolHeap *);
+}
+
+RealTimeMemory::~RealTimeMemory() {
+    using namespace MARTe;
+    if (heap != NULL_PTR(RealTimePoolHeap *)) {
+        if (heap->GetNumberOfUsedBlocks() == 0u) {
+            (void) HeapManager::RemoveHeap(heap);
+            delete heap;
+        }
+        else {
+            //The objects destroyed later free their blocks through the HeapManager, which shall still find the heap
+            REPORT_ERROR(ErrorManagement::FatalError, "%d blocks of %s are still in use. The heap is left registered and is not freed",
+                         heap->GetNumberOfUsedBlocks(), heap->Name());
+        }
+    }
+}
+
+bool RealTimeMemory::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = Object::Initialise(data);
+    uint32 lockMemory = 1u;
+    if (ok) {
+        (void) data.Read("LockMemory", lockMemory);
+        if (lockMemory != 0u) {
+            ok = (mlockall(MCL_CURRENT | MCL_FUTURE) == 0);
+            if (ok) {
+                REPORT_ERROR(ErrorManagement::Information, "Memory locked");
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::OSError, "Could not lock the memory (check ulimit -l or CAP_IPC_LOCK)");
+            }
+        }
+    }
+    if (ok) {
+        uint32 heapPrefault = 0u;
+        (void) data.Read("HeapPrefault", heapPrefault);
+        if (heapPrefault > 0u) {
+            //Keep the freed memory in one arena, so that it is reused by all the threads
+            ok = (mallopt(M_TRIM_THRESHOLD, -1) == 1);
+            if (ok) {
+                ok = (mallopt(M_MMAP_MAX, 0) == 1);
+            }
+            if (ok) {
+                ok = (mallopt(M_ARENA_MAX, 1) == 1);
+            }
+            void *prefault = NULL_PTR(void *);
+            if (ok) {
+                prefault = malloc(heapPrefault);
+                ok = (prefault != NULL_PTR(void *));
+            }
+            if (ok) {
+                (void) memset(prefault, 0, heapPrefault);
+                free(prefault);
+                REPORT_ERROR(ErrorManagement::Information, "%d bytes of heap prefaulted", heapPrefault);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::OSError, "Could not prefault %d bytes of heap", heapPrefault);
+            }
+        }
+    }
+    if ((ok) && (!data.GetType("BlockSizes").IsVoid())) {
+        ok = CreateHeap(data, (lockMemory != 0u));
+    }
+    return ok;
+}
+
+bool RealTimeMemory::ExportData(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = Object::ExportData(data);
+    if ((ok) && (heap != NULL_PTR(RealTimePoolHeap *))) {
+        ok = data.Write("UsedBlocks", heap->GetNumberOfUsedBlocks());
+        if (ok) {
+            ok = data.Write("Fallbacks", heap->GetNumberOfFallbacks());
+        }
+        uint32 numberOfClasses = heap->GetNumberOfClasses();
+        uint32 *maxUsed = new uint32[numberOfClasses];
+        uint32 i;
+        for (i = 0u; i < numberOfClasses; i++) {
+            maxUsed[i] = __atomic_load_n(&heap->GetClass(i).maxUsed, __ATOMIC_RELAXED);
+        }
+        if (ok) {
+            Vector<uint32> maxUsedVector(maxUsed, numberOfClasses);
+            ok = data.Write("MaxUsedBlocks", maxUsedVector);
+        }
+        delete[] maxUsed;
+    }
+    return ok;
+}
+
+bool RealTimeMemory::CreateHeap(MARTe::StructuredDataI &data,
+                                const bool lockMemory) {
+    using namespace MARTe;
+    uint32 numberOfClasses = data.GetType("BlockSizes").GetNumberOfElements(0u);
+    bool ok = (numberOfClasses > 0u);
+    if (ok) {
+        ok = (data.GetType("NumberOfBlocks").GetNumberOfElements(0u) == numberOfClasses);
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBlocks shall have one element per BlockSizes");
+    }
+    uint32 *blockSizes = NULL_PTR(uint32 *);
+    uint32 *numberOfBlocks = NULL_PTR(uint32 *);
+    if (ok) {
+        blockSizes = new uint32[numberOfClasses];
+        numberOfBlocks = new uint32[numberOfClasses];
+        Vector<uint32> blockSizesVector(blockSizes, numberOfClasses);
+        Vector<uint32> numberOfBlocksVector(numberOfBlocks, numberOfClasses);
+        ok = data.Read("BlockSizes", blockSizesVector);
+        if (ok) {
+            ok = data.Read("NumberOfBlocks", numberOfBlocksVector);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not read the BlockSizes and NumberOfBlocks");
+        }
+    }
+    if (ok) {
+        heap = new RealTimePoolHeap();
+        ok = heap->Create(GetName(), blockSizes, numberOfBlocks, numberOfClasses, lockMemory);
+        if (ok) {
+            ok = HeapManager::AddHeap(heap);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Could not add %s to the HeapManager", GetName());
+            }
+        }
+        if (ok) {
+            REPORT_ERROR(ErrorManagement::Information, "Heap %s created with %d bytes in %d classes", GetName(), (heap->LastAddress() - heap->FirstAddress()) + 1u,
+                         numberOfClasses);
+        }
+        else {
+            delete heap;
+            heap = NULL_PTR(RealTimePoolHeap *);
+        }
+    }
+    if (blockSizes != NULL_PTR(uint32 *)) {
+        delete[] blockSizes;
+    }
+    if (numberOfBlocks != NULL_PTR(uint32 *)) {
+        delete[] numberOfBlocks;
+    }
+    return ok;
+}
+
+CLASS_REGISTER(RealTimeMemory, "")
+} // namespace MARTe2Tutorial
@@ -0,0 +1,133 @@
+/**
+ * @file RealTimeMemory.h
+ * @brief Header file for class RealTimeMemory
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * RealTimeMemory with all of its public, protected and private members. It
+ * may also include definitions for inline methods which need to be visible
+ * to the compiler.
+ */
+
+#ifndef INTERFACES_REALTIMEMEMORY_REALTIMEMEMORY_H_
+#define INTERFACES_REALTIMEMEMORY_REALTIMEMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Object.h"
+#include "RealTimePoolHeap.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Prepares the memory of the process so that the real-time threads
+ * do not take page faults nor call the system allocator.
+ *
+ * @details When initialised:
+ *  - if LockMemory, all the current and future pages of the process are
+ *    locked (mlockall(MCL_CURRENT | MCL_FUTURE)). As the RealTimeThreads are
+ *    created later (when the first state is started), their whole stacks
+ *    (StackSize) are populated and locked when the threads are created;
+ *  - if HeapPrefault > 0, the allocator is told never to return memory to
+ *    the system nor to serve large requests with mmap, and to use a single
+ *    arena for all the threads. HeapPrefault bytes are then allocated,
+ *    written and freed, so that they stay, prefaulted, in the arena;
+ *  - if BlockSizes is set, a RealTimePoolHeap is created and added to the
+ *    HeapManager, with the name of this object. The components which accept
+ *    a HeapName (e.g. the DataSources, OPCUAClient and
+ *    TCPSocketMessageProxy) can then allocate from it.
+ *
+ * The PrefaultGAM prefaults the stack and the heap from each RealTimeThread
+ * when the locking is not possible (e.g. without CAP_IPC_LOCK).
+ *
+ * This object shall be declared before the objects which use its heap, and
+ * is thus destroyed before them. The heap is only removed from the
+ * HeapManager, and freed, if none of its blocks is in use. Otherwise it is
+ * left registered, so that the blocks freed later through the HeapManager
+ * (e.g. by Object::operator delete) are still returned to it, and the
+ * blocks in use are reported as an error.
+ *
+ * ExportData reports, for the tuning of the pools, the number of blocks in
+ * use, the maximum number of blocks ever used in each class and the number
+ * of requests which the pools could not serve (Fallbacks).
+ *
+ * <pre>
+ * +RealTimeHeap = {
+ *     Class = RealTimeMemory
+ *     LockMemory = 1 //Optional. Call mlockall. Default = 1.
+ *     HeapPrefault = 16777216 //Optional. Bytes to prefault in the heap. Default = 0.
+ *     BlockSizes = {64 256 1024 4096} //Optional. Increasing. If not set no heap is created.
+ *     NumberOfBlocks = {1024 256 64 16} //Compulsory if BlockSizes is set. One per block size.
+ * }
+ * </pre>
+ */
+class RealTimeMemory : public MARTe::Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    RealTimeMemory();
+
+    /**
+     * @brief Destructor. Removes the heap from the HeapManager and frees it
+     * if none of its blocks is in use, otherwise leaves it registered.
+     */
+    virtual ~RealTimeMemory();
+
+    /**
+     * @brief Reads the parameters listed in the class description, locks
+     * and prefaults the memory and installs the heap.
+     * @param[in] data see Object::Initialise.
+     * @return true if the memory could be locked and the heap created.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Exports the usage of the heap.
+     * @details See Object::ExportData.
+     */
+    virtual bool ExportData(MARTe::StructuredDataI &data);
+
+private:
+    /**
+     * @brief Creates the heap from BlockSizes and NumberOfBlocks.
+     * @return true if the heap could be created and added to the HeapManager.
+     */
+    bool CreateHeap(MARTe::StructuredDataI &data,
+                    const bool lockMemory);
+
+    /**
+     * The heap (NULL if BlockSizes is not set).
+     */
+    RealTimePoolHeap *heap;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_REALTIMEMEMORY_REALTIMEMEMORY_H_ */
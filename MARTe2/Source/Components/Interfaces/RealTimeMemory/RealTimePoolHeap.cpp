@@ -0,0 +1,315 @@
+/**
+ * @file RealTimePoolHeap.cpp
+ * @brief Source file for class RealTimePoolHeap
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimePoolHeap (public, protected, and private). Be aware that
+ * some methods, such as those inline could be defined on the header file,
+ * instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <string.h>
+#include <sys/mman.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
+#include "RealTimePoolHeap.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The block sizes are multiple of this.
+ */
+const MARTe::uint32 REAL_TIME_POOL_HEAP_ALIGNMENT = 16u;
+
+/**
+ * Maximum time that Malloc waits for the lock of a class before falling
+ * back to the standard heap.
+ */
+const MARTe::uint32 REAL_TIME_POOL_HEAP_LOCK_TIMEOUT = 1u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+RealTimePoolHeap::RealTimePoolHeap() :
+        MARTe::HeapI() {
+    classes = NULL_PTR(RealTimePoolHeapClass *);
+    numberOfClasses = 0u;
+    memory = NULL_PTR(MARTe::uint8 *);
+    memorySize = 0u;
+    fallbacks = 0;
+}
+
+RealTimePoolHeap::~RealTimePoolHeap() {
+    if (memory != NULL_PTR(MARTe::uint8 *)) {
+        (void) munmap(memory, memorySize);
+    }
+    if (classes != NULL_PTR(RealTimePoolHeapClass *)) {
+        MARTe::uint32 i;
+        for (i = 0u; i < numberOfClasses; i++) {
+            (void) classes[i].mux.Close();
+        }
+        delete[] classes;
+    }
+}
+
+bool RealTimePoolHeap::Create(const MARTe::char8 * const nameIn,
+                              const MARTe::uint32 * const blockSizes,
+                              const MARTe::uint32 * const numberOfBlocks,
+                              const MARTe::uint32 numberOfClassesIn,
+                              const bool lockMemory) {
+    using namespace MARTe;
+    name = nameIn;
+    bool ok = (memory == NULL_PTR(uint8 *));
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The heap %s was already created", nameIn);
+    }
+    if (ok) {
+        ok = (numberOfClassesIn > 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "At least one block size shall be set");
+        }
+    }
+    uint32 i;
+    uint64 totalSize = 0u;
+    for (i = 0u; (i < numberOfClassesIn) && (ok); i++) {
+        ok = (blockSizes[i] > 0u) && (numberOfBlocks[i] > 0u);
+        if ((ok) && (i > 0u)) {
+            ok = (blockSizes[i] > blockSizes[i - 1u]);
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The block sizes shall increase and the number of blocks shall be > 0");
+        }
+        uint32 blockSize = ((blockSizes[i] + REAL_TIME_POOL_HEAP_ALIGNMENT - 1u) / REAL_TIME_POOL_HEAP_ALIGNMENT) * REAL_TIME_POOL_HEAP_ALIGNMENT;
+        totalSize += static_cast<uint64>(blockSize) * numberOfBlocks[i];
+    }
+    if (ok) {
+        ok = (totalSize < 0xFFFFFFFFu);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The pools of %s shall be smaller than 4 GB", nameIn);
+        }
+    }
+    if (ok) {
+        memorySize = static_cast<uint32>(totalSize);
+        //MAP_POPULATE prefaults all the pages now, not in the first cycles
+        void *mapped = mmap(NULL_PTR(void *), memorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        ok = (mapped != MAP_FAILED);
+        if (ok) {
+            memory = static_cast<uint8 *>(mapped);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not map %d bytes for %s", memorySize, nameIn);
+        }
+    }
+    if ((ok) && (lockMemory)) {
+        ok = (mlock(memory, memorySize) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not lock the %d bytes of %s (check ulimit -l)", memorySize, nameIn);
+        }
+    }
+    if (ok) {
+        numberOfClasses = numberOfClassesIn;
+        classes = new RealTimePoolHeapClass[numberOfClasses];
+        uint8 *first = memory;
+        for (i = 0u; i < numberOfClasses; i++) {
+            classes[i].blockSize = ((blockSizes[i] + REAL_TIME_POOL_HEAP_ALIGNMENT - 1u) / REAL_TIME_POOL_HEAP_ALIGNMENT) * REAL_TIME_POOL_HEAP_ALIGNMENT;
+            classes[i].numberOfBlocks = numberOfBlocks[i];
+            classes[i].first = first;
+            (void) classes[i].mux.Create();
+            classes[i].used = 0u;
+            classes[i].maxUsed = 0u;
+            //Chain the blocks in address order
+            classes[i].freeList = NULL_PTR(void *);
+            uint32 b;
+            for (b = numberOfBlocks[i]; b > 0u; b--) {
+                void **block = reinterpret_cast<void **>(&first[(b - 1u) * classes[i].blockSize]);
+                *block = classes[i].freeList;
+                classes[i].freeList = block;
+            }
+            first = &first[numberOfBlocks[i] * classes[i].blockSize];
+        }
+    }
+    else if (memory != NULL_PTR(uint8 *)) {
+        (void) munmap(memory, memorySize);
+        memory = NULL_PTR(uint8 *);
+    }
+    else {
+    }
+    return ok;
+}
+
+void *RealTimePoolHeap::Malloc(const MARTe::uint32 size) {
+    using namespace MARTe;
+    void *block = NULL_PTR(void *);
+    uint32 i;
+    //Take from a larger class if the right one is exhausted
+    for (i = 0u; (i < numberOfClasses) && (block == NULL_PTR(void *)); i++) {
+        if (size <= classes[i].blockSize) {
+            ErrorManagement::ErrorType err = classes[i].mux.FastLock(REAL_TIME_POOL_HEAP_LOCK_TIMEOUT);
+            if (err.ErrorsCleared()) {
+                block = classes[i].freeList;
+                if (block != NULL_PTR(void *)) {
+                    classes[i].freeList = *static_cast<void **>(block);
+                    classes[i].used++;
+                    if (classes[i].used > classes[i].maxUsed) {
+                        classes[i].maxUsed = classes[i].used;
+                    }
+                }
+                classes[i].mux.FastUnLock();
+            }
+        }
+    }
+    if (block == NULL_PTR(void *)) {
+        (void) __atomic_add_fetch(&fallbacks, 1, __ATOMIC_RELAXED);
+        block = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(size);
+    }
+    return block;
+}
+
+void RealTimePoolHeap::Free(void *&data) {
+    using namespace MARTe;
+    if (data != NULL_PTR(void *)) {
+        uint32 i = GetClassIndex(data);
+        if (i < numberOfClasses) {
+            //The block can only go back to its class: wait (yielding) for the lock
+            (void) classes[i].mux.FastLock();
+            *static_cast<void **>(data) = classes[i].freeList;
+            classes[i].freeList = data;
+            classes[i].used--;
+            classes[i].mux.FastUnLock();
+            data = NULL_PTR(void *);
+        }
+        else {
+            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(data);
+        }
+    }
+}
+
+void *RealTimePoolHeap::Realloc(void *&data,
+                                const MARTe::uint32 newSize) {
+    using namespace MARTe;
+    void *newData = NULL_PTR(void *);
+    if (data == NULL_PTR(void *)) {
+        newData = Malloc(newSize);
+    }
+    else if (newSize == 0u) {
+        Free(data);
+    }
+    else {
+        uint32 i = GetClassIndex(data);
+        if (i < numberOfClasses) {
+            if (newSize <= classes[i].blockSize) {
+                newData = data;
+            }
+            else {
+                newData = Malloc(newSize);
+                if (newData != NULL_PTR(void *)) {
+                    (void) memcpy(newData, data, classes[i].blockSize);
+                    Free(data);
+                }
+            }
+        }
+        else {
+            //The size of the old memory is not known: leave it to its heap
+            newData = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Realloc(data, newSize);
+        }
+    }
+    data = newData;
+    return newData;
+}
+
+void *RealTimePoolHeap::Duplicate(const void * const data,
+                                  const MARTe::uint32 size) {
+    using namespace MARTe;
+    void *copy = NULL_PTR(void *);
+    if (data != NULL_PTR(const void *)) {
+        uint32 copySize = size;
+        if (copySize == 0u) {
+            copySize = static_cast<uint32>(strlen(static_cast<const char8 *>(data))) + 1u;
+        }
+        copy = Malloc(copySize);
+        if (copy != NULL_PTR(void *)) {
+            (void) memcpy(copy, data, copySize);
+        }
+    }
+    return copy;
+}
+
+MARTe::uintp RealTimePoolHeap::FirstAddress() const {
+    return reinterpret_cast<MARTe::uintp>(memory);
+}
+
+MARTe::uintp RealTimePoolHeap::LastAddress() const {
+    MARTe::uintp last = 0u;
+    if (memory != NULL_PTR(MARTe::uint8 *)) {
+        last = reinterpret_cast<MARTe::uintp>(&memory[memorySize - 1u]);
+    }
+    return last;
+}
+
+const MARTe::char8 *RealTimePoolHeap::Name() const {
+    return name.Buffer();
+}
+
+MARTe::uint32 RealTimePoolHeap::GetNumberOfFallbacks() const {
+    return static_cast<MARTe::uint32>(__atomic_load_n(&fallbacks, __ATOMIC_RELAXED));
+}
+
+MARTe::uint32 RealTimePoolHeap::GetNumberOfUsedBlocks() const {
+    MARTe::uint32 used = 0u;
+    MARTe::uint32 i;
+    for (i = 0u; i < numberOfClasses; i++) {
+        used += __atomic_load_n(&classes[i].used, __ATOMIC_RELAXED);
+    }
+    return used;
+}
+
+MARTe::uint32 RealTimePoolHeap::GetNumberOfClasses() const {
+    return numberOfClasses;
+}
+
+const RealTimePoolHeapClass &RealTimePoolHeap::GetClass(const MARTe::uint32 idx) const {
+    return classes[idx];
+}
+
+MARTe::uint32 RealTimePoolHeap::GetClassIndex(const void * const data) const {
+    using namespace MARTe;
+    uint32 idx = numberOfClasses;
+    const uint8 * const address = static_cast<const uint8 *>(data);
+    if ((memory != NULL_PTR(uint8 *)) && (address >= memory) && (address < &memory[memorySize])) {
+        uint32 i;
+        for (i = 0u; (i < numberOfClasses) && (idx == numberOfClasses); i++) {
+            if (address < &classes[i].first[classes[i].numberOfBlocks * classes[i].blockSize]) {
+                idx = i;
+            }
+        }
+    }
+    return idx;
+}
+
+} // namespace MARTe2Tutorial
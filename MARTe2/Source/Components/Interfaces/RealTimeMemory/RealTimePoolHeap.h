@@ -0,0 +1,252 @@
+/**
+ * @file RealTimePoolHeap.h
+ * @brief Header file for class RealTimePoolHeap
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class
+ * RealTimePoolHeap with all of its public, protected and private members.
+ * It may also include definitions for inline methods which need to be
+ * visible to the compiler.
+ */
+
+#ifndef INTERFACES_REALTIMEMEMORY_REALTIMEPOOLHEAP_H_
+#define INTERFACES_REALTIMEMEMORY_REALTIMEPOOLHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+#include "HeapI.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+/**
+ * @brief The blocks of one size.
+ */
+struct RealTimePoolHeapClass {
+    /**
+     * The size of the blocks.
+     */
+    MARTe::uint32 blockSize;
+
+    /**
+     * The number of blocks.
+     */
+    MARTe::uint32 numberOfBlocks;
+
+    /**
+     * The first block.
+     */
+    MARTe::uint8 *first;
+
+    /**
+     * The free blocks (the first bytes of a free block point to the next).
+     */
+    void *freeList;
+
+    /**
+     * Protects the free list.
+     */
+    MARTe::FastPollingMutexSem mux;
+
+    /**
+     * The number of blocks in use.
+     */
+    MARTe::uint32 used;
+
+    /**
+     * The maximum number of blocks in use.
+     */
+    MARTe::uint32 maxUsed;
+};
+
+/**
+ * @brief A HeapI which allocates fixed-size blocks from preallocated,
+ * prefaulted (and optionally locked) pools.
+ *
+ * @details There is one pool per size class. Malloc takes a block from the
+ * free list of the smallest class which fits, so that Malloc and Free take
+ * a bounded time and never call the system allocator. A request larger than
+ * the largest class, or made when its pools are exhausted, is served by the
+ * standard heap and counted (see GetNumberOfFallbacks), so that an
+ * undersized pool is visible. Free recognises the blocks of the standard
+ * heap by their address.
+ *
+ * Each free list is protected by a FastPollingMutexSem, which yields while
+ * it waits, so that a thread preempted while holding it (e.g. by a
+ * SCHED_FIFO thread of the same priority on the same core) can release it.
+ * If Malloc cannot take the lock within a millisecond the request is served
+ * by the standard heap (and counted as a fallback) instead.
+ *
+ * The block sizes are rounded up to multiples of 16 bytes, so that all the
+ * blocks are aligned as the standard heap.
+ */
+class RealTimePoolHeap : public MARTe::HeapI {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    RealTimePoolHeap();
+
+    /**
+     * @brief Destructor. Releases the pools.
+     */
+    virtual ~RealTimePoolHeap();
+
+    /**
+     * @brief Allocates and prefaults the pools.
+     * @param[in] nameIn the name of the heap.
+     * @param[in] blockSizes the size of the blocks of each class, increasing.
+     * @param[in] numberOfBlocks the number of blocks of each class.
+     * @param[in] numberOfClassesIn the number of classes.
+     * @param[in] lockMemory if true the pools are locked in memory.
+     * @return true if the memory could be allocated (and locked).
+     */
+    bool Create(const MARTe::char8 * const nameIn,
+                const MARTe::uint32 * const blockSizes,
+                const MARTe::uint32 * const numberOfBlocks,
+                const MARTe::uint32 numberOfClassesIn,
+                const bool lockMemory);
+
+    /**
+     * @brief Takes a block of the smallest class which fits.
+     * @param[in] size the number of bytes.
+     * @return the block or, if no block is available, the memory of the
+     * standard heap.
+     */
+    virtual void *Malloc(const MARTe::uint32 size);
+
+    /**
+     * @brief Returns a block to its class (or the memory to the standard heap).
+     * @param[in,out] data the memory, set to NULL.
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @brief Keeps the block if newSize fits in its class, otherwise moves
+     * the data to a new block.
+     * @param[in,out] data the memory.
+     * @param[in] newSize the new size.
+     * @return the new memory.
+     */
+    virtual void *Realloc(void *&data,
+                          const MARTe::uint32 newSize);
+
+    /**
+     * @brief Copies data to a new block.
+     * @param[in] data the data.
+     * @param[in] size the number of bytes (0 for a null terminated string).
+     * @return the copy.
+     */
+    virtual void *Duplicate(const void * const data,
+                            const MARTe::uint32 size = 0u);
+
+    /**
+     * @brief Gets the first address of the pools.
+     * @return the first address of the pools.
+     */
+    virtual MARTe::uintp FirstAddress() const;
+
+    /**
+     * @brief Gets the last address of the pools.
+     * @return the last address of the pools.
+     */
+    virtual MARTe::uintp LastAddress() const;
+
+    /**
+     * @brief Gets the name of the heap.
+     * @return the name of the heap.
+     */
+    virtual const MARTe::char8 *Name() const;
+
+    /**
+     * @brief Gets the number of requests served by the standard heap.
+     * @return the number of requests served by the standard heap.
+     */
+    MARTe::uint32 GetNumberOfFallbacks() const;
+
+    /**
+     * @brief Gets the number of blocks in use in all the classes.
+     * @return the number of blocks in use.
+     */
+    MARTe::uint32 GetNumberOfUsedBlocks() const;
+
+    /**
+     * @brief Gets the number of classes.
+     * @return the number of classes.
+     */
+    MARTe::uint32 GetNumberOfClasses() const;
+
+    /**
+     * @brief Gets a class.
+     * @param[in] idx the index of the class.
+     * @return the class.
+     */
+    const RealTimePoolHeapClass &GetClass(const MARTe::uint32 idx) const;
+
+private:
+    /**
+     * @brief Gets the class of a block.
+     * @return the index of the class or numberOfClasses if the address is
+     * not in the pools.
+     */
+    MARTe::uint32 GetClassIndex(const void * const data) const;
+
+    /**
+     * The name of the heap.
+     */
+    MARTe::StreamString name;
+
+    /**
+     * The size classes.
+     */
+    RealTimePoolHeapClass *classes;
+
+    /**
+     * The number of size classes.
+     */
+    MARTe::uint32 numberOfClasses;
+
+    /**
+     * The memory of all the pools.
+     */
+    MARTe::uint8 *memory;
+
+    /**
+     * The size of the memory.
+     */
+    MARTe::uint32 memorySize;
+
+    /**
+     * The number of requests served by the standard heap.
+     */
+    volatile MARTe::int32 fallbacks;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_REALTIMEMEMORY_REALTIMEPOOLHEAP_H_ */
@@ -30,6 +30,8 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "ConfigurationDatabase.h"
+#include "HeapManager.h"
+#include "HotPathTrace.h"
 #include "Message.h"
 #include "MessageI.h"
 #include "StandardParser.h"
@@ -50,6 +52,7 @@ TCPSocketMessageProxy::TCPSocketMessageProxy() :
     waitForConnection = true;
     mux.Create();
     timeout = 10;
+    heap = MARTe::GlobalObjectsDatabase::Instance()->GetStandardHeap();
 
 }
 
@@ -77,6 +80,16 @@ bool TCPSocketMessageProxy::Initialise(MARTe::StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Could not Read the Port parameter");
         }
     }
+    if (ok) {
+        StreamString heapName;
+        if (data.Read("HeapName", heapName)) {
+            heap = HeapManager::FindHeap(heapName.Buffer());
+            ok = (heap != NULL_PTR(HeapI *));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Could not find a heap with the name %s", heapName.Buffer());
+            }
+        }
+    }
     if (ok) {
         ok = socket.Open();
         if (!ok) {
@@ -134,6 +147,7 @@ MARTe::ErrorManagement::ErrorType TCPSocketMessageProxy::Execute(MARTe::Executio
         }
     }
     if (info.GetStageSpecific() == MARTe::ExecutionInfo::ServiceRequestStageSpecific) {
+        HOT_PATH_TRACE_BEGIN("TCPSocketMessageProxy::Execute");
         BasicTCPSocket *client = reinterpret_cast<BasicTCPSocket *>(info.GetThreadSpecificContext());
         if (client != NULL_PTR(BasicTCPSocket *)) {
             const uint32 BUFFER_SIZE = 1024u;
@@ -149,7 +163,7 @@ MARTe::ErrorManagement::ErrorType TCPSocketMessageProxy::Execute(MARTe::Executio
                 configurationCfg.Seek(0LLU);
                 ConfigurationDatabase msgCdb;
                 StandardParser parser(configurationCfg, msgCdb, &err);
-                ReferenceT<Message> msg(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+                ReferenceT<Message> msg(heap);
                 ErrorManagement::ErrorType msgError;
                 msgError.parametersError = !parser.Parse();
                 if (msgError.ErrorsCleared()) {
@@ -179,6 +193,7 @@ MARTe::ErrorManagement::ErrorType TCPSocketMessageProxy::Execute(MARTe::Executio
             }
             delete client;
         }
+        HOT_PATH_TRACE_END("TCPSocketMessageProxy::Execute");
         return MARTe::ErrorManagement::Completed;
     }
     return err;
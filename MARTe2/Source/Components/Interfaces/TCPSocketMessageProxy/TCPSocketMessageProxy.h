@@ -34,6 +34,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "EmbeddedServiceMethodBinderI.h"
+#include "HeapI.h"
 #include "MultiClientService.h"
 #include "MutexSem.h"
 #include "Object.h"
@@ -55,6 +56,7 @@ namespace MARTe2Tutorial {
  * +TCPMessageProxy = {
  *     Class = TCPSocketMessageProxy
  *     Port = 24680//Compulsory. The port where to listen for the TCP messages.
+ *     HeapName = RealTimeHeap//Optional. The heap (see HeapManager) of the relayed messages. Default = the standard heap.
  * }
  * </pre>
  */
@@ -73,7 +75,7 @@ public:
   virtual ~TCPSocketMessageProxy();
 
   /**
-   * @brief Reads the Port from the configuration file.
+   * @brief Reads the Port and the HeapName from the configuration file.
    * @param[in] data see Object::Initialise. The parameter Port shall exist the
    * socket will be opened to listen on this port.
    * @return true if the Port parameter can be read, socket opened and the TCP
@@ -114,6 +116,11 @@ private:
    * The timeout in ms
    */
   MARTe::int32 timeout;
+
+  /**
+   * The heap of the relayed messages.
+   */
+  MARTe::HeapI *heap;
 };
 } // namespace MARTe2Tutorial
 
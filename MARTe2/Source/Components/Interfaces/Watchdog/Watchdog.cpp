@@ -0,0 +1,445 @@
+/**
+ * @file Watchdog.cpp
+ * @brief Source file for class Watchdog
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Watchdog (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CLASSMETHODREGISTER.h"
+#include "HighResolutionTimer.h"
+#include "Message.h"
+#include "ObjectRegistryDatabase.h"
+#include "Sleep.h"
+#include "Watchdog.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+
+Watchdog::Watchdog() :
+        MARTe::ReferenceContainer(), MARTe::EmbeddedServiceMethodBinderI(), MARTe::MessageI(), executor(*this) {
+    using namespace MARTe;
+    heartbeat = NULL_PTR(const volatile uint32 *);
+    numberOfBudgets = 0u;
+    budgetSignalNames = NULL_PTR(StreamString *);
+    budgets = NULL_PTR(uint32 *);
+    budgetSignals = NULL_PTR(const volatile uint32 **);
+    resolved = false;
+    armed = false;
+    heartbeatBudgetTicks = 0u;
+    escalationTimeoutTicks = 0u;
+    period = 0.0;
+    maxDeadlineMisses = 1u;
+    deadlineMisses = 0u;
+    deadlineMissWindowTicks = 0u;
+    deadlineMissTicks = NULL_PTR(uint64 *);
+    deadlineMissIndex = 0u;
+    escalationLevel = 0u;
+    lastHeartbeat = 0u;
+    lastHeartbeatTicks = 0u;
+    lastEscalationTicks = 0u;
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    mux.Create();
+
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
+}
+
+Watchdog::~Watchdog() {
+    if (budgetSignalNames != NULL_PTR(MARTe::StreamString *)) {
+        delete[] budgetSignalNames;
+    }
+    if (budgets != NULL_PTR(MARTe::uint32 *)) {
+        delete[] budgets;
+    }
+    if (budgetSignals != NULL_PTR(const volatile MARTe::uint32 **)) {
+        delete[] budgetSignals;
+    }
+    if (deadlineMissTicks != NULL_PTR(MARTe::uint64 *)) {
+        delete[] deadlineMissTicks;
+    }
+    (void) mux.Close();
+}
+
+void Watchdog::Purge(MARTe::ReferenceContainer &purgeList) {
+    using namespace MARTe;
+    if (executor.Stop() != ErrorManagement::NoError) {
+        if (executor.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    (void) RemoveMessageFilter(filter);
+    ReferenceContainer::Purge(purgeList);
+}
+
+bool Watchdog::Initialise(MARTe::StructuredDataI &data) {
+    using namespace MARTe;
+    bool ok = ReferenceContainer::Initialise(data);
+    if (ok) {
+        ok = data.Read("TimingDataSource", timingDataSourcePath);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not read the TimingDataSource parameter");
+        }
+    }
+    if (ok) {
+        ok = data.Read("HeartbeatDataSource", heartbeatDataSourcePath);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not read the HeartbeatDataSource parameter");
+        }
+    }
+    if (ok) {
+        if (!data.Read("HeartbeatSignal", heartbeatSignalName)) {
+            heartbeatSignalName = "Counter";
+        }
+    }
+    uint32 heartbeatBudget = 0u;
+    if (ok) {
+        ok = data.Read("HeartbeatBudget", heartbeatBudget);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not read the HeartbeatBudget parameter");
+        }
+    }
+    if (ok) {
+        ok = (heartbeatBudget > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "HeartbeatBudget shall be > 0");
+        }
+    }
+    if (ok) {
+        uint32 periodUs = heartbeatBudget;
+        (void) data.Read("Period", periodUs);
+        ok = (periodUs > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Period shall be > 0");
+        }
+        period = static_cast<float64>(periodUs) * 1e-6;
+    }
+    if (ok) {
+        (void) data.Read("MaxDeadlineMisses", maxDeadlineMisses);
+        ok = (maxDeadlineMisses > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "MaxDeadlineMisses shall be > 0");
+        }
+    }
+    if (ok) {
+        deadlineMissTicks = new uint64[maxDeadlineMisses];
+        uint32 escalationTimeout = 1000000u;
+        (void) data.Read("EscalationTimeout", escalationTimeout);
+        uint32 deadlineMissWindow = 0u;
+        (void) data.Read("DeadlineMissWindow", deadlineMissWindow);
+        float64 ticksPerUs = static_cast<float64>(HighResolutionTimer::Frequency()) * 1e-6;
+        heartbeatBudgetTicks = static_cast<uint64>(static_cast<float64>(heartbeatBudget) * ticksPerUs);
+        escalationTimeoutTicks = static_cast<uint64>(static_cast<float64>(escalationTimeout) * ticksPerUs);
+        deadlineMissWindowTicks = static_cast<uint64>(static_cast<float64>(deadlineMissWindow) * ticksPerUs);
+        (void) data.Read("CPUs", cpuMask);
+        (void) data.Read("StackSize", stackSize);
+    }
+    if (ok) {
+        if (data.MoveRelative("Budgets")) {
+            numberOfBudgets = data.GetNumberOfChildren();
+            budgetSignalNames = new StreamString[numberOfBudgets];
+            budgets = new uint32[numberOfBudgets];
+            budgetSignals = new const volatile uint32 *[numberOfBudgets];
+            uint32 i;
+            for (i = 0u; (i < numberOfBudgets) && (ok); i++) {
+                budgetSignals[i] = NULL_PTR(const volatile uint32 *);
+                ok = data.MoveToChild(i);
+                if (ok) {
+                    ok = data.Read("Signal", budgetSignalNames[i]);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "Could not read the Signal of Budgets.%s", data.GetName());
+                    }
+                }
+                if (ok) {
+                    ok = data.Read("Budget", budgets[i]);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "Could not read the Budget of Budgets.%s", data.GetName());
+                    }
+                }
+                if (ok) {
+                    ok = data.MoveToAncestor(1u);
+                }
+            }
+            if (!data.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        uint32 numberOfMessages = 0u;
+        uint32 i;
+        for (i = 0u; i < Size(); i++) {
+            ReferenceT<Message> msg = Get(i);
+            if (msg.IsValid()) {
+                numberOfMessages++;
+            }
+        }
+        ok = (numberOfMessages > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At least one escalation Message shall be declared");
+        }
+    }
+    if (ok) {
+        executor.SetName(GetName());
+        executor.SetCPUMask(cpuMask);
+        executor.SetStackSize(stackSize);
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start SingleThreadService");
+        }
+    }
+    return ok;
+}
+
+bool Watchdog::ResolveSignal(MARTe::ReferenceT<MARTe::DataSourceI> dataSource, const MARTe::char8 * const signalName,
+                             const volatile MARTe::uint32 *&address) const {
+    using namespace MARTe;
+    uint32 signalIdx = 0u;
+    bool ok = dataSource->GetSignalIndex(signalIdx, signalName);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Signal %s not found in %s", signalName, dataSource->GetName());
+    }
+    if (ok) {
+        ok = (dataSource->GetSignalType(signalIdx) == UnsignedInteger32Bit);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Signal %s shall be a uint32", signalName);
+        }
+    }
+    void *signalAddress = NULL_PTR(void *);
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not get the memory of signal %s", signalName);
+        }
+    }
+    if (ok) {
+        address = static_cast<const volatile uint32 *>(signalAddress);
+    }
+    return ok;
+}
+
+bool Watchdog::ResolveSignals() {
+    using namespace MARTe;
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    heartbeatDataSource = ord->Find(heartbeatDataSourcePath.Buffer());
+    bool ok = heartbeatDataSource.IsValid();
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Could not find the DataSource %s", heartbeatDataSourcePath.Buffer());
+    }
+    if (ok) {
+        ok = ResolveSignal(heartbeatDataSource, heartbeatSignalName.Buffer(), heartbeat);
+    }
+    if ((ok) && (numberOfBudgets > 0u)) {
+        timingDataSource = ord->Find(timingDataSourcePath.Buffer());
+        ok = timingDataSource.IsValid();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not find the DataSource %s", timingDataSourcePath.Buffer());
+        }
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfBudgets) && (ok); i++) {
+        ok = ResolveSignal(timingDataSource, budgetSignalNames[i].Buffer(), budgetSignals[i]);
+    }
+    return ok;
+}
+
+void Watchdog::ExpireDeadlineMisses(const MARTe::uint64 now) {
+    using namespace MARTe;
+    if (deadlineMissWindowTicks > 0u) {
+        uint32 misses = deadlineMisses;
+        bool expired = true;
+        while ((misses > 0u) && (expired)) {
+            uint32 oldest = ((deadlineMissIndex + maxDeadlineMisses) - misses) % maxDeadlineMisses;
+            expired = ((now - deadlineMissTicks[oldest]) > deadlineMissWindowTicks);
+            if (expired) {
+                misses--;
+            }
+        }
+        __atomic_store_n(&deadlineMisses, misses, __ATOMIC_RELAXED);
+    }
+}
+
+MARTe::uint32 Watchdog::Check() {
+    using namespace MARTe;
+    uint32 toSend = 0u;
+    uint64 now = HighResolutionTimer::Counter();
+    uint32 currentHeartbeat = *heartbeat;
+    bool alive = (currentHeartbeat != lastHeartbeat);
+    if (alive) {
+        lastHeartbeat = currentHeartbeat;
+        lastHeartbeatTicks = now;
+    }
+    if (escalationLevel == 0u) {
+        ExpireDeadlineMisses(now);
+        bool miss = false;
+        if (alive) {
+            uint32 i;
+            for (i = 0u; (i < numberOfBudgets) && (!miss); i++) {
+                miss = (*budgetSignals[i] > budgets[i]);
+            }
+        }
+        else if ((now - lastHeartbeatTicks) > heartbeatBudgetTicks) {
+            //Count one miss for each HeartbeatBudget without a heartbeat
+            miss = true;
+            lastHeartbeatTicks = now;
+        }
+        else {
+            //NOOP
+        }
+        if (miss) {
+            deadlineMissTicks[deadlineMissIndex] = now;
+            deadlineMissIndex = (deadlineMissIndex + 1u) % maxDeadlineMisses;
+            __atomic_store_n(&deadlineMisses, deadlineMisses + 1u, __ATOMIC_RELAXED);
+            REPORT_ERROR(ErrorManagement::Warning, "Deadline miss %d/%d", deadlineMisses, maxDeadlineMisses);
+        }
+        if (deadlineMisses >= maxDeadlineMisses) {
+            toSend = 1u;
+        }
+    }
+    else if (alive) {
+        //The last escalation step was enough to bring the threads back
+        REPORT_ERROR(ErrorManagement::Information, "Heartbeat resumed after escalation step %d. Disarming", escalationLevel);
+        armed = false;
+    }
+    else if ((now - lastEscalationTicks) > escalationTimeoutTicks) {
+        toSend = escalationLevel + 1u;
+    }
+    else {
+        //NOOP
+    }
+    if (toSend > 0u) {
+        __atomic_store_n(&escalationLevel, toSend, __ATOMIC_RELAXED);
+        lastEscalationTicks = now;
+        __atomic_store_n(&deadlineMisses, 0u, __ATOMIC_RELAXED);
+    }
+    return toSend;
+}
+
+MARTe::ErrorManagement::ErrorType Watchdog::Execute(MARTe::ExecutionInfo &info) {
+    using namespace MARTe;
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint32 toSend = 0u;
+        (void) mux.FastLock();
+        if (armed) {
+            toSend = Check();
+        }
+        mux.FastUnLock();
+        if (toSend > 0u) {
+            //Escalation steps are the toSend-th Message child
+            ReferenceT<Message> msg;
+            uint32 i;
+            uint32 n = 0u;
+            for (i = 0u; (i < Size()) && (n < toSend); i++) {
+                msg = Get(i);
+                if (msg.IsValid()) {
+                    n++;
+                }
+            }
+            if (n == toSend) {
+                REPORT_ERROR(ErrorManagement::Warning, "Escalation step %d: sending %s to %s", toSend, msg->GetFunction().Buffer(),
+                             msg->GetDestination().Buffer());
+                if (MessageI::SendMessage(msg, this) != ErrorManagement::NoError) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not send escalation message to %s", msg->GetDestination().Buffer());
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "No more escalation steps available");
+                (void) mux.FastLock();
+                armed = false;
+                mux.FastUnLock();
+            }
+        }
+        Sleep::NoMore(period);
+    }
+    return ErrorManagement::NoError;
+}
+
+MARTe::ErrorManagement::ErrorType Watchdog::Start() {
+    using namespace MARTe;
+    ErrorManagement::ErrorType err;
+    (void) mux.FastLock();
+    if (!resolved) {
+        resolved = ResolveSignals();
+    }
+    err.parametersError = !resolved;
+    if (err.ErrorsCleared()) {
+        __atomic_store_n(&deadlineMisses, 0u, __ATOMIC_RELAXED);
+        __atomic_store_n(&escalationLevel, 0u, __ATOMIC_RELAXED);
+        lastHeartbeat = *heartbeat;
+        lastHeartbeatTicks = HighResolutionTimer::Counter();
+        armed = true;
+    }
+    mux.FastUnLock();
+    if (err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::Information, "Watchdog armed");
+    }
+    return err;
+}
+
+MARTe::ErrorManagement::ErrorType Watchdog::Stop() {
+    using namespace MARTe;
+    (void) mux.FastLock();
+    armed = false;
+    mux.FastUnLock();
+    REPORT_ERROR(ErrorManagement::Information, "Watchdog disarmed");
+    return ErrorManagement::NoError;
+}
+
+MARTe::ErrorManagement::ErrorType Watchdog::Reset() {
+    using namespace MARTe;
+    (void) mux.FastLock();
+    __atomic_store_n(&deadlineMisses, 0u, __ATOMIC_RELAXED);
+    __atomic_store_n(&escalationLevel, 0u, __ATOMIC_RELAXED);
+    lastHeartbeatTicks = HighResolutionTimer::Counter();
+    mux.FastUnLock();
+    return ErrorManagement::NoError;
+}
+
+MARTe::uint32 Watchdog::GetDeadlineMisses() const {
+    //Written by the Watchdog thread
+    return __atomic_load_n(&deadlineMisses, __ATOMIC_RELAXED);
+}
+
+MARTe::uint32 Watchdog::GetEscalationLevel() const {
+    return __atomic_load_n(&escalationLevel, __ATOMIC_RELAXED);
+}
+
+CLASS_REGISTER(Watchdog, "")
+CLASS_METHOD_REGISTER(Watchdog, Start)
+CLASS_METHOD_REGISTER(Watchdog, Stop)
+CLASS_METHOD_REGISTER(Watchdog, Reset)
+} // namespace MARTe2Tutorial
@@ -0,0 +1,378 @@
+/**
+ * @file Watchdog.h
+ * @brief Header file for class Watchdog
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class Watchdog
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef INTERFACES_WATCHDOG_WATCHDOG_H_
+#define INTERFACES_WATCHDOG_WATCHDOG_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "FastPollingMutexSem.h"
+#include "MessageI.h"
+#include "ReferenceContainer.h"
+#include "RegisteredMethodsMessageFilter.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe2Tutorial {
+/**
+ * @brief Supervises the real-time threads of a RealTimeApplication and
+ * escalates when they miss their deadlines.
+ *
+ * @details The Watchdog runs on its own thread (ideally pinned to a CPU which
+ * is not used by the RealTimeThreads) and every Period microseconds it:
+ *  - reads the HeartbeatSignal of the HeartbeatDataSource (e.g. the Counter
+ *    of a LinuxTimer), which is expected to change at every cycle. If it did
+ *    not change for more than HeartbeatBudget microseconds the thread is
+ *    considered stuck and a deadline miss is counted;
+ *  - if the heartbeat changed, reads each of the Budgets signals of the
+ *    TimingDataSource (e.g. Run.Thread1_CycleTime or GAMPID_ExecTime) and
+ *    counts a deadline miss if any of them exceeds its Budget.
+ *
+ * With Period not larger than the RealTimeThread period, a miss is thus
+ * detected at most one cycle after it happened.
+ *
+ * If DeadlineMissWindow is set, a miss is forgotten DeadlineMissWindow
+ * microseconds after it was counted, so that only MaxDeadlineMisses misses
+ * within any DeadlineMissWindow escalate and sporadic misses do not
+ * accumulate over the life of the application.
+ *
+ * When MaxDeadlineMisses misses have been counted the Watchdog escalates by
+ * sending the first Message declared inside it. From then on it only checks
+ * the heartbeat: if the heartbeat does not resume within EscalationTimeout
+ * microseconds the next Message is sent, and so on. If the heartbeat resumes
+ * the Watchdog disarms itself until it receives a new Start.
+ *
+ * The Watchdog is disarmed after Initialise (signals can only be resolved
+ * after the RealTimeApplication has been configured) and shall be armed
+ * with a Start message, typically sent by the StateMachine once the
+ * application is running. The Start, Stop and Reset functions are
+ * registered for RPC.
+ *
+ * <pre>
+ * +Watchdog = {
+ *     Class = Watchdog
+ *     TimingDataSource = RTApp.Data.Timings //Compulsory. Full path of the TimingDataSource.
+ *     HeartbeatDataSource = RTApp.Data.Timer //Compulsory. Full path of the DataSource holding the heartbeat.
+ *     HeartbeatSignal = Counter //Optional. uint32 signal which changes at every cycle. Default = Counter.
+ *     HeartbeatBudget = 12000 //Compulsory. Maximum time (us) between two heartbeats.
+ *     Period = 1000 //Optional. Polling period (us). Default = HeartbeatBudget.
+ *     MaxDeadlineMisses = 5 //Optional. Deadline misses tolerated before escalating. Default = 1.
+ *     DeadlineMissWindow = 1000000 //Optional. Time (us) after which a miss is forgotten. Default = 0 (never).
+ *     EscalationTimeout = 1000000 //Optional. Time (us) given to each escalation step. Default = 1000000.
+ *     CPUs = 0x4 //Optional. Affinity of the Watchdog thread. Default = 0xff.
+ *     StackSize = 65536 //Optional. Stack size of the Watchdog thread. Default = THREADS_DEFAULT_STACKSIZE.
+ *     Budgets = { //Optional. uint32 signals of the TimingDataSource to be checked.
+ *         Cycle = {
+ *             Signal = Run.Thread1_CycleTime
+ *             Budget = 10500 //us
+ *         }
+ *         PID = {
+ *             Signal = GAMPID_ExecTime
+ *             Budget = 500 //us
+ *         }
+ *     }
+ *     +GotoErrorMsg = { //Escalation steps, sent in order.
+ *         Class = Message
+ *         Destination = StateMachine
+ *         Function = GOTOERROR
+ *     }
+ *     +KillMsg = {
+ *         Class = Message
+ *         Destination = Killer
+ *         Function = Kill
+ *     }
+ * }
+ * </pre>
+ */
+class Watchdog : public MARTe::ReferenceContainer,
+                 public MARTe::EmbeddedServiceMethodBinderI,
+                 public MARTe::MessageI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Installs the message filter.
+     */
+    Watchdog();
+
+    /**
+     * @brief Destructor. Frees the budgets memory.
+     */
+    virtual ~Watchdog();
+
+    /**
+     * @brief Reads the parameters listed in the class description, creates
+     * the escalation Messages and starts the (disarmed) Watchdog thread.
+     * @param[in] data see ReferenceContainer::Initialise.
+     * @return true if all the compulsory parameters are set, at least one
+     * escalation Message is declared and the thread could be started.
+     */
+    virtual bool Initialise(MARTe::StructuredDataI &data);
+
+    /**
+     * @brief Stops the Watchdog thread and removes the message filter.
+     * @details See ReferenceContainer::Purge
+     */
+    virtual void Purge(MARTe::ReferenceContainer &purgeList);
+
+    /**
+     * @brief Callback function for the Watchdog thread. Checks the heartbeat
+     * and the timing signals and escalates as described in the class
+     * description.
+     * @param[in] info see EmbeddedServiceMethodBinderI
+     * @return ErrorManagement::NoError.
+     */
+    virtual MARTe::ErrorManagement::ErrorType Execute(MARTe::ExecutionInfo &info);
+
+    /**
+     * @brief Resolves the signals (if not already done), clears the counters
+     * and arms the Watchdog.
+     * @return ErrorManagement::NoError if all the signals could be resolved.
+     */
+    MARTe::ErrorManagement::ErrorType Start();
+
+    /**
+     * @brief Disarms the Watchdog.
+     * @return ErrorManagement::NoError.
+     */
+    MARTe::ErrorManagement::ErrorType Stop();
+
+    /**
+     * @brief Clears the deadline misses and the escalation level.
+     * @return ErrorManagement::NoError.
+     */
+    MARTe::ErrorManagement::ErrorType Reset();
+
+    /**
+     * @brief Gets the number of deadline misses counted since the last
+     * escalation step (or Start/Reset) and within the DeadlineMissWindow.
+     * @details Can be called from any thread.
+     * @return the number of deadline misses.
+     */
+    MARTe::uint32 GetDeadlineMisses() const;
+
+    /**
+     * @brief Gets the number of escalation Messages sent since the last
+     * Start/Reset.
+     * @details Can be called from any thread.
+     * @return the escalation level.
+     */
+    MARTe::uint32 GetEscalationLevel() const;
+
+private:
+    /**
+     * @brief Looks for the data sources and signals and stores the address
+     * of their memory.
+     * @return true if all the signals exist and are uint32.
+     */
+    bool ResolveSignals();
+
+    /**
+     * @brief Resolves the memory address of a uint32 signal.
+     * @param[in] dataSource the DataSource holding the signal.
+     * @param[in] signalName the name of the signal.
+     * @param[out] address the signal memory.
+     * @return true if the signal exists and is a uint32.
+     */
+    bool ResolveSignal(MARTe::ReferenceT<MARTe::DataSourceI> dataSource,
+                       const MARTe::char8 * const signalName,
+                       const volatile MARTe::uint32 *&address) const;
+
+    /**
+     * @brief Checks the heartbeat and the timing signals.
+     * @return the index + 1 of the escalation Message to be sent, or 0 if
+     * none shall be sent.
+     */
+    MARTe::uint32 Check();
+
+    /**
+     * @brief Forgets the deadline misses older than the DeadlineMissWindow.
+     * @param[in] now the current HighResolutionTimer counter.
+     */
+    void ExpireDeadlineMisses(const MARTe::uint64 now);
+
+    /**
+     * The Watchdog thread.
+     */
+    MARTe::SingleThreadService executor;
+
+    /**
+     * The message filter for the registered methods.
+     */
+    MARTe::ReferenceT<MARTe::RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * Protects the state shared between Execute and the RPC methods.
+     */
+    MARTe::FastPollingMutexSem mux;
+
+    /**
+     * Full path of the TimingDataSource.
+     */
+    MARTe::StreamString timingDataSourcePath;
+
+    /**
+     * Full path of the heartbeat DataSource.
+     */
+    MARTe::StreamString heartbeatDataSourcePath;
+
+    /**
+     * Name of the heartbeat signal.
+     */
+    MARTe::StreamString heartbeatSignalName;
+
+    /**
+     * The TimingDataSource (held to keep its memory alive).
+     */
+    MARTe::ReferenceT<MARTe::DataSourceI> timingDataSource;
+
+    /**
+     * The heartbeat DataSource (held to keep its memory alive).
+     */
+    MARTe::ReferenceT<MARTe::DataSourceI> heartbeatDataSource;
+
+    /**
+     * Memory of the heartbeat signal.
+     */
+    const volatile MARTe::uint32 *heartbeat;
+
+    /**
+     * Number of timing signals to be checked.
+     */
+    MARTe::uint32 numberOfBudgets;
+
+    /**
+     * Names of the timing signals to be checked.
+     */
+    MARTe::StreamString *budgetSignalNames;
+
+    /**
+     * Budget (us) of each timing signal.
+     */
+    MARTe::uint32 *budgets;
+
+    /**
+     * Memory of each timing signal.
+     */
+    const volatile MARTe::uint32 **budgetSignals;
+
+    /**
+     * True if the signals have been resolved.
+     */
+    bool resolved;
+
+    /**
+     * True if the Watchdog is armed.
+     */
+    bool armed;
+
+    /**
+     * Maximum time between two heartbeats in HighResolutionTimer ticks.
+     */
+    MARTe::uint64 heartbeatBudgetTicks;
+
+    /**
+     * Escalation timeout in HighResolutionTimer ticks.
+     */
+    MARTe::uint64 escalationTimeoutTicks;
+
+    /**
+     * Polling period in seconds.
+     */
+    MARTe::float64 period;
+
+    /**
+     * Deadline misses tolerated before escalating.
+     */
+    MARTe::uint32 maxDeadlineMisses;
+
+    /**
+     * Deadline misses counted since the last escalation step.
+     */
+    MARTe::uint32 deadlineMisses;
+
+    /**
+     * Time after which a miss is forgotten in HighResolutionTimer ticks
+     * (0 if never).
+     */
+    MARTe::uint64 deadlineMissWindowTicks;
+
+    /**
+     * HighResolutionTimer counter of the last maxDeadlineMisses misses
+     * (ring buffer).
+     */
+    MARTe::uint64 *deadlineMissTicks;
+
+    /**
+     * Next write index in deadlineMissTicks.
+     */
+    MARTe::uint32 deadlineMissIndex;
+
+    /**
+     * Number of escalation Messages sent.
+     */
+    MARTe::uint32 escalationLevel;
+
+    /**
+     * Last heartbeat value.
+     */
+    MARTe::uint32 lastHeartbeat;
+
+    /**
+     * HighResolutionTimer counter when the heartbeat last changed (or when a
+     * miss was last counted against it).
+     */
+    MARTe::uint64 lastHeartbeatTicks;
+
+    /**
+     * HighResolutionTimer counter of the last escalation step.
+     */
+    MARTe::uint64 lastEscalationTicks;
+
+    /**
+     * The CPU mask for the executor.
+     */
+    MARTe::uint32 cpuMask;
+
+    /**
+     * The stack size for the executor.
+     */
+    MARTe::uint32 stackSize;
+};
+} // namespace MARTe2Tutorial
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERFACES_WATCHDOG_WATCHDOG_H_ */
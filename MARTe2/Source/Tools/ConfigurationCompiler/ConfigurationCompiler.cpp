@@ -0,0 +1,248 @@
+/**
+ * @file ConfigurationCompiler.cpp
+ * @brief Source file for the ConfigurationCompiler tool
+ * @date 19/10/2026
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details Compiles configuration files into the binary images loaded by the
+ * CachedRealTimeLoader (see ConfigurationCache), e.g. when deploying, so
+ * that even the first start skips the parsing.
+ *
+ * Each CFG_FILE is parsed, its image is written to CACHE_DIR and then
+ * loaded back and compared, leaf by leaf, with the parsed configuration.
+ * For each file one line is printed with the image and the time taken to
+ * parse the text and to load the image:
+ * config,image,parse_us,load_us
+ *
+ * Build: make -f Makefile.gcc (built with the other components).
+ *
+ * Usage (with the LD_LIBRARY_PATH of MARTeApp.sh):
+ * ConfigurationCompiler.ex CACHE_DIR CFG_FILE [CFG_FILE ...]
+ * e.g.
+ * ./ConfigurationCompiler.ex $HOME/.cache/MARTe2ConfigCache ../Configurations/Logger/RTApp-Log.cfg ../Configurations/Logger/RTApp-Log-FSM.cfg
+ *
+ * CACHE_DIR is created with mode 0700 if missing and shall be owned by the
+ * user and not writable by the group or the others, as the
+ * CachedRealTimeLoader ignores it otherwise.
+ *
+ * The exit status is the number of files which could not be compiled.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationDatabase.h"
+#include "File.h"
+#include "HighResolutionTimer.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * @brief Prints the errors of the framework on the standard error.
+ */
+void CompilerErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                  const MARTe::char8 * const errorDescription) {
+    fprintf(stderr, "[%s:%d] %s\n", errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+/**
+ * @brief Microseconds elapsed since start.
+ */
+MARTe::uint32 ElapsedMicroseconds(const MARTe::uint64 start) {
+    using namespace MARTe;
+    return static_cast<uint32>(static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period() * 1e6);
+}
+
+/**
+ * @brief Checks that two trees have the same nodes and the same leaves, as
+ * strings.
+ * @return true if the current nodes of both trees (and their subtrees) match.
+ */
+bool Compare(MARTe::ConfigurationDatabase &parsed,
+             MARTe::ConfigurationDatabase &loaded) {
+    using namespace MARTe;
+    uint32 numberOfChildren = parsed.GetNumberOfChildren();
+    bool ok = (numberOfChildren == loaded.GetNumberOfChildren());
+    uint32 i;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        StreamString childName = parsed.GetChildName(i);
+        if (parsed.MoveRelative(childName.Buffer())) {
+            ok = loaded.MoveRelative(childName.Buffer());
+            if (ok) {
+                ok = Compare(parsed, loaded);
+                if (ok) {
+                    ok = loaded.MoveToAncestor(1u);
+                }
+            }
+            if (ok) {
+                ok = parsed.MoveToAncestor(1u);
+            }
+        }
+        else {
+            AnyType parsedLeaf = parsed.GetType(childName.Buffer());
+            AnyType loadedLeaf = loaded.GetType(childName.Buffer());
+            ok = (parsedLeaf.GetNumberOfDimensions() == loadedLeaf.GetNumberOfDimensions());
+            if ((ok) && (parsedLeaf.GetNumberOfDimensions() == 0u)) {
+                StreamString parsedValue;
+                StreamString loadedValue;
+                ok = parsed.Read(childName.Buffer(), parsedValue);
+                if (ok) {
+                    ok = loaded.Read(childName.Buffer(), loadedValue);
+                }
+                if (ok) {
+                    ok = (parsedValue == loadedValue);
+                }
+            }
+            else if (ok) {
+                uint32 d;
+                for (d = 0u; (d < parsedLeaf.GetNumberOfDimensions()) && (ok); d++) {
+                    ok = (parsedLeaf.GetNumberOfElements(d) == loadedLeaf.GetNumberOfElements(d));
+                }
+            }
+            else {
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s differs in the image", childName.Buffer());
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Compiles one configuration file.
+ * @return true if the image was written and verified.
+ */
+bool CompileFile(const MARTe::char8 * const cacheDirectory,
+                 const MARTe::char8 * const cfgFileName) {
+    using namespace MARTe;
+    using namespace MARTe2Tutorial;
+    File cfgFile;
+    bool ok = cfgFile.Open(cfgFileName, File::ACCESS_MODE_R);
+    uint32 size = 0u;
+    char8 *text = NULL_PTR(char8 *);
+    if (ok) {
+        size = static_cast<uint32>(cfgFile.Size());
+        text = new char8[size + 1u];
+        ok = cfgFile.Seek(0LLU);
+        if (ok) {
+            uint32 readSize = size;
+            ok = cfgFile.Read(text, readSize);
+            if (ok) {
+                ok = (readSize == size);
+            }
+        }
+        text[size] = '\0';
+    }
+    if (!ok) {
+        fprintf(stderr, "Could not read %s\n", cfgFileName);
+    }
+    (void) cfgFile.Close();
+    //Parse the text exactly as the CachedRealTimeLoader does
+    uint64 hash = 0u;
+    ConfigurationDatabase parsed;
+    uint32 parseTime = 0u;
+    if (ok) {
+        hash = ConfigurationCache::Hash(text, size);
+        uint64 start = HighResolutionTimer::Counter();
+        StreamString textStream = text;
+        (void) textStream.Seek(0u);
+        StreamString err;
+        StandardParser parser(textStream, parsed, &err);
+        ok = parser.Parse();
+        parseTime = ElapsedMicroseconds(start);
+        if (!ok) {
+            fprintf(stderr, "Could not parse %s: %s\n", cfgFileName, err.Buffer());
+        }
+    }
+    if (text != NULL_PTR(char8 *)) {
+        delete[] text;
+    }
+    StreamString imageName;
+    if (ok) {
+        ok = ConfigurationCache::GetFileName(cacheDirectory, hash, imageName);
+    }
+    if (ok) {
+        ok = ConfigurationCache::Compile(parsed, hash, imageName.Buffer());
+    }
+    ConfigurationDatabase loaded;
+    uint32 loadTime = 0u;
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        ok = ConfigurationCache::Load(imageName.Buffer(), hash, loaded);
+        loadTime = ElapsedMicroseconds(start);
+        if (!ok) {
+            fprintf(stderr, "Could not load back %s\n", imageName.Buffer());
+        }
+    }
+    if (ok) {
+        ok = parsed.MoveToRoot();
+    }
+    if (ok) {
+        ok = Compare(parsed, loaded);
+    }
+    if (ok) {
+        printf("%s,%s,%u,%u\n", cfgFileName, imageName.Buffer(), parseTime, loadTime);
+    }
+    else {
+        //Do not leave an image which does not match the text
+        if (imageName.Size() > 0u) {
+            (void) remove(imageName.Buffer());
+        }
+        fprintf(stderr, "Could not compile %s\n", cfgFileName);
+    }
+    return ok;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+int main(int argc,
+         char **argv) {
+    using namespace MARTe;
+    ErrorManagement::SetErrorProcessFunction(&CompilerErrorProcessFunction);
+    int failures = 0;
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s CACHE_DIR CFG_FILE [CFG_FILE ...]\n", argv[0]);
+        failures = 1;
+    }
+    else if (!MARTe2Tutorial::ConfigurationCache::PrepareDirectory(argv[1])) {
+        fprintf(stderr, "The cache directory %s cannot be trusted\n", argv[1]);
+        failures = 1;
+    }
+    else {
+        printf("config,image,parse_us,load_us\n");
+        int i;
+        for (i = 2; i < argc; i++) {
+            if (!CompileFile(argv[1], argv[i])) {
+                failures++;
+            }
+        }
+    }
+    return failures;
+}
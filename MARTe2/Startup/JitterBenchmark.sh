@@ -0,0 +1,81 @@
+#!/bin/bash
+
+# Arguments [-t DURATION] [-o OUTPUT_DIR] [-n "SLEEP_NATURES"] [-c "CPU_MASKS"] [CFG_FILE ...]
+# -t DURATION = Seconds each configuration runs (default 60)
+# -o OUTPUT_DIR = Where jitter.csv, jitter_hist.csv and the logs are written (default ../Benchmarks/Jitter)
+# -n SLEEP_NATURES = SleepNature of the LinuxTimer data sources (default "Default Busy", - keeps the configuration)
+# -c CPU_MASKS = CPUs of the real-time threads (default "-", i.e. keep the configuration)
+# CFG_FILE = The configurations to run (default all the ../Configurations/*/*.cfg)
+#
+# Runs every configuration, for every SleepNature and CPU mask, headless with
+# CycleJitterBenchmark.ex and appends the cycle and GAM execution time
+# statistics of its real-time threads to OUTPUT_DIR/jitter.csv and their
+# histograms to OUTPUT_DIR/jitter_hist.csv. The machine (x86_64, aarch64) is
+# recorded in every line, so the files of different targets can be concatenated.
+# The configurations which cannot run (e.g. missing SDN, OPC UA or MDSplus
+# peers) are listed in OUTPUT_DIR/failed.txt with their log.
+
+source ../marte2_setup.sh
+
+DURATION=60
+OUTPUT_DIR=../Benchmarks/Jitter
+SLEEP_NATURES="Default Busy"
+CPU_MASKS="-"
+
+# Consume input arguments
+while [[ $# -gt 1 ]]
+do
+key="$1"
+
+case $key in
+    -t|--time)
+    DURATION="$2"
+    shift # past argument
+    ;;
+    -o|--output)
+    OUTPUT_DIR="$2"
+    shift # past argument
+    ;;
+    -n|--sleep-natures)
+    SLEEP_NATURES="$2"
+    shift # past argument
+    ;;
+    -c|--cpus)
+    CPU_MASKS="$2"
+    shift # past argument
+    ;;
+    *)
+    break
+    ;;
+esac
+shift # past argument or value
+done
+
+CFG_FILES="$@"
+if [ -z "$CFG_FILES" ]; then
+    CFG_FILES=$(ls ../Configurations/*/*.cfg)
+fi
+
+# Same libraries as MARTeApp.sh
+eval "$(grep '^LD_LIBRARY_PATH=' MARTeApp.sh)"
+export LD_LIBRARY_PATH=$LD_LIBRARY_PATH
+
+BENCHMARK=$MARTe2_Examples_DIR/Build/$TARGET/Benchmarks/CycleJitter/CycleJitterBenchmark.ex
+
+mkdir -p $OUTPUT_DIR
+for CFG in $CFG_FILES
+do
+    for SLEEP_NATURE in $SLEEP_NATURES
+    do
+        for CPUS in $CPU_MASKS
+        do
+            LOG=$OUTPUT_DIR/$(basename $CFG .cfg)-$SLEEP_NATURE-$CPUS.log
+            echo "$CFG SleepNature=$SLEEP_NATURE CPUs=$CPUS"
+            # Leave time to initialise and to stop the state
+            timeout $((DURATION + 30)) $BENCHMARK $CFG $DURATION $OUTPUT_DIR/jitter.csv $OUTPUT_DIR/jitter_hist.csv $SLEEP_NATURE $CPUS > $LOG 2>&1
+            if [ $? -ne 0 ]; then
+                echo "$CFG $SLEEP_NATURE $CPUS $LOG" >> $OUTPUT_DIR/failed.txt
+            fi
+        done
+    done
+done
@@ -1,5 +1,7 @@
 function mds_json_to_tree(file_path)
     %MDS_JSON_TO_TREE
+    %   One mdstcl call per node: for trees with many nodes use
+    %   mds_json_to_tree_bulk (or Python/json_to_tree.py).
 
     % ----------  BEGIN CODE  ----------
     % Get file parts
@@ -0,0 +1,66 @@
+function mds_json_to_tree_bulk(file_path)
+%MDS_JSON_TO_TREE_BULK Same as mds_json_to_tree, for large trees.
+%   The full node list is computed from the JSON up front (mds_read_json),
+%   then all the nodes are added by a single mdstcl session (one edit, one
+%   write) and the data, if any, is put with the tree opened once.
+%   Requires mdstcl in the PATH (see MDSplus_setup).
+
+% ----------  BEGIN CODE  ----------
+% Read and check all the nodes
+nodes = mds_read_json(file_path);
+if numel(nodes) == 0
+    return
+end
+tree_name = nodes{1}.name;
+nodes(1) = [];
+
+% Check if 'treename'_path exist
+if isempty(getenv([tree_name '_path']))
+    % Error
+    fprintf('ERROR: Unable to find %s\n', tree_name)
+    fprintf('\tPlease export %s_path = /path/to/tree\n', tree_name)
+    return
+end
+
+% Write the mdstcl commands
+cmd_file = [tempname '.tcl'];
+fd = fopen(cmd_file, 'w');
+fprintf(fd, 'edit %s/new\n', tree_name);
+for i = 1:numel(nodes)
+    fprintf(fd, 'add node %s/usage=%s\n', nodes{i}.name, nodes{i}.usage);
+end
+fprintf(fd, 'write\n');
+fprintf(fd, 'close\n');
+fclose(fd);
+
+% Create the tree in one session
+fprintf('INFO: Creating %s with %d nodes... ', tree_name, numel(nodes))
+[status, output] = system(['mdstcl < "' cmd_file '"']);
+delete(cmd_file);
+if status ~= 0
+    fprintf('\nERROR: mdstcl failed\n%s\n', output)
+    return
+end
+fprintf('Done\n')
+
+% Put the data
+has_data = cellfun(@(node) (strcmp(node.usage, 'signal') && isfield(node, 'x') && isfield(node, 'y')) || ...
+    (strcmp(node.usage, 'numeric') && isfield(node, 'value')), nodes);
+if any(has_data)
+    mdsopen(tree_name, -1);
+    for node = nodes(has_data)
+        curr = node{1};
+        switch curr.usage
+            case 'signal'
+                x = eval(curr.x);
+                y = eval(curr.y);
+                mdsput(curr.name, 'BUILD_SIGNAL($1,,$2)', y, x);
+                fprintf('INFO: Put in node %s data %s\n', curr.name, curr.y)
+            case 'numeric'
+                mdsput(curr.name, '$1', curr.value);
+                fprintf('INFO: Put in node %s data %s\n', curr.name, num2str(curr.value))
+        end
+    end
+    mdsclose;
+end
+% -----------  END CODE  -----------
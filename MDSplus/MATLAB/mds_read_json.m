@@ -67,10 +67,14 @@ while (numel(open) ~= 0)
         open{end + 1} = curr.subnodes{i};
     end
 
-    % Add node
-    node.name = curr.name;
-    node.usage = curr.usage;
-    nodes = [nodes, node];
+    % Add node (with its data, if any)
+    node = struct('name', curr.name, 'usage', curr.usage);
+    for key = {'x', 'y', 'value'}
+        if isfield(curr, key{1}) && ~isempty(curr.(key{1}))
+            node.(key{1}) = curr.(key{1});
+        end
+    end
+    nodes = [nodes, {node}];
 
 end
 % -----------  END CODE  -----------
\ No newline at end of file
@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+"""Creates an MDSplus tree from a JSON description, with the same schema as
+MATLAB/mytree.json (used by MATLAB/mds_json_to_tree.m):
+
+    {"name": TREE, "usage": "tree", "subnodes": [
+        {"name": NODE, "usage": "structure"|"signal"|"numeric"|"text"|...,
+         "subnodes": [...],
+         "x": X, "y": Y,  (optional, signal data)
+         "value": VALUE}  (optional, numeric data)
+    ]}
+
+The full node list is computed up front, then the nodes are added in a
+single edit session and the tree is written once. x, y and value can be
+JSON numbers/arrays or numpy expressions (e.g. "linspace(0, 1, 100)").
+
+Usage:
+    ./json_to_tree.py ../MATLAB/mytree.json
+    ./json_to_tree.py --dry-run ../MATLAB/mytree.json
+
+The tree is created in <tree>_path or, if not set, in --path (default: the
+current directory).
+"""
+
+import argparse
+import json
+import os
+import sys
+
+
+def read_nodes(file_path):
+    """Gets the tree name and the list of nodes (parents first)."""
+    with open(file_path) as json_file:
+        tree = json.load(json_file)
+    nodes = []
+    pending = [(node, node.get('name')) for node in tree.get('subnodes', [])]
+    while pending:
+        node, path = pending.pop(0)
+        for key in ('name', 'usage'):
+            if not node.get(key):
+                raise ValueError('Missing %s in node %s' % (key, path))
+        nodes.append((path, node))
+        for subnode in node.get('subnodes', []):
+            pending.append((subnode, path + ':' + str(subnode.get('name'))))
+    return tree['name'], nodes
+
+
+def evaluate(value):
+    """Evaluates a data field: JSON values as they are, strings with numpy."""
+    import numpy
+    if isinstance(value, str):
+        namespace = dict((name, getattr(numpy, name)) for name in dir(numpy) if not name.startswith('_'))
+        return eval(value, {'__builtins__': {}}, namespace)
+    return numpy.array(value)
+
+
+def create_tree(tree_name, nodes):
+    import MDSplus as mds
+    tree = mds.Tree(tree_name, -1, 'NEW')
+    for path, node in nodes:
+        tree.addNode(path, node['usage'].upper())
+    tree.write()
+    print('INFO: %s created with %d nodes' % (tree_name, len(nodes)))
+    for path, node in nodes:
+        usage = node['usage'].lower()
+        if usage == 'signal' and node.get('x') is not None and node.get('y') is not None:
+            data = mds.Signal(evaluate(node['y']), None, evaluate(node['x']))
+        elif usage == 'numeric' and node.get('value') is not None:
+            data = evaluate(node['value'])
+        else:
+            continue
+        tree.getNode(path).putData(data)
+        print('INFO: Put in node %s' % path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Creates an MDSplus tree from a JSON description.')
+    parser.add_argument('json', help='the JSON file (e.g. ../MATLAB/mytree.json)')
+    parser.add_argument('--path', default=os.getcwd(), help='directory of the tree if <tree>_path is not set (default: current directory)')
+    parser.add_argument('--dry-run', action='store_true', help='only print the nodes, do not create the tree')
+    args = parser.parse_args()
+
+    tree_name, nodes = read_nodes(args.json)
+    if os.path.splitext(os.path.basename(args.json))[0] != tree_name:
+        print('WARNING: Input file name and tree name does not match')
+    if args.dry_run:
+        for path, node in nodes:
+            print('%s/usage=%s' % (path, node['usage']))
+        return 0
+    if not os.environ.get(tree_name + '_path'):
+        os.environ[tree_name + '_path'] = os.path.abspath(args.path)
+    create_tree(tree_name, nodes)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
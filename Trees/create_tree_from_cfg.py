@@ -0,0 +1,255 @@
+#!/usr/bin/env python
+"""Creates the MDSplus trees written by the MDSWriter and MDSSegmentWriter
+DataSources of a MARTe2 configuration file.
+
+Every signal of every writer (Class = MDSWriter or MDSSegmentWriter) with a
+NodeName (and DecimatedNodeName, if any) becomes a SIGNAL node of the tree
+TreeName, with the structure nodes of its path. The node compression
+follows the signal Type: integer signals (counters, times) compress well
+with the MDSplus delta compression and are stored with compress_segments,
+floating point signals are stored as they are.
+
+The segment length of a signal is set by MakeSegmentAfterNWrites in the
+configuration, so it is not part of the tree. For each signal the tool
+prints a suggested value, such that a segment holds about --segment-bytes
+(the NumberOfElements * size of Type bytes written per cycle times the
+number of writes), and flags the values which are far from it.
+
+Usage:
+    ./create_tree_from_cfg.py ../MARTe2/Configurations/Logger/RTApp-Log-MDSW.cfg
+    ./create_tree_from_cfg.py ../MARTe2/Configurations/WrRd/RTApp-Wr-Segments.cfg
+    ./create_tree_from_cfg.py --dry-run --path /tmp/trees CONFIG.cfg
+
+The trees are created in --path (default: the current directory), by
+setting <tree>_path, as the hand-written create_tree.py scripts do.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+WRITER_CLASSES = ('MDSWriter', 'MDSSegmentWriter')
+
+TYPE_SIZES = {
+    'char8': 1, 'int8': 1, 'uint8': 1,
+    'int16': 2, 'uint16': 2,
+    'int32': 4, 'uint32': 4, 'float32': 4,
+    'int64': 8, 'uint64': 8, 'float64': 8,
+}
+
+TOKEN_RE = re.compile(r'''
+    (?P<comment>//[^\n]*|/\*.*?\*/)
+  | (?P<string>"(?:[^"\\]|\\.)*")
+  | (?P<symbol>[{}=])
+  | (?P<cast>\([A-Za-z0-9_]+\))
+  | (?P<word>[^\s{}="]+)
+  | (?P<space>\s+)
+''', re.VERBOSE | re.DOTALL)
+
+
+def tokenize(text):
+    """Splits a MARTe2 configuration in tokens, dropping comments and casts."""
+    tokens = []
+    for match in TOKEN_RE.finditer(text):
+        kind = match.lastgroup
+        if kind in ('comment', 'space', 'cast'):
+            continue
+        value = match.group(kind)
+        if kind == 'string':
+            value = value[1:-1]
+        tokens.append((kind, value))
+    return tokens
+
+
+def parse_block(tokens, position):
+    """Parses 'name = value' pairs until the closing brace of the block.
+
+    Returns the block as a list of (name, value) pairs, which keeps the order
+    and the repeated names, and the position after the block. A value is a
+    string, a list (vectors and matrices) or a block.
+    """
+    block = []
+    while position < len(tokens) and tokens[position] != ('symbol', '}'):
+        name = tokens[position][1]
+        if tokens[position + 1] != ('symbol', '='):
+            raise ValueError('Expected = after %s' % name)
+        position += 2
+        if tokens[position] == ('symbol', '{'):
+            is_block = (position + 2 < len(tokens) and tokens[position + 2] == ('symbol', '='))
+            if is_block:
+                value, position = parse_block(tokens, position + 1)
+            else:
+                value, position = parse_array(tokens, position + 1)
+            position += 1
+        else:
+            value = tokens[position][1]
+            position += 1
+        block.append((name, value))
+    return block, position
+
+
+def parse_array(tokens, position):
+    """Parses the elements of a vector or matrix until its closing brace."""
+    array = []
+    while tokens[position] != ('symbol', '}'):
+        if tokens[position] == ('symbol', '{'):
+            row, position = parse_array(tokens, position + 1)
+            array.append(row)
+        else:
+            array.append(tokens[position][1])
+        position += 1
+    return array, position
+
+
+def parse_cfg(text):
+    tokens = tokenize(text)
+    block, position = parse_block(tokens, 0)
+    if position != len(tokens):
+        raise ValueError('Unbalanced braces')
+    return block
+
+
+def get(block, name, default=None):
+    for key, value in block:
+        if key == name:
+            return value
+    return default
+
+
+def find_writers(block, path=''):
+    """Yields (path, block) of every MDSWriter and MDSSegmentWriter in the configuration."""
+    for name, value in block:
+        if isinstance(value, list) and value and isinstance(value[0], tuple):
+            node_path = path + '.' + name.lstrip('+$') if path else name.lstrip('+$')
+            if str(get(value, 'Class', '')).split('::')[-1] in WRITER_CLASSES:
+                yield node_path, value
+            else:
+                for writer in find_writers(value, node_path):
+                    yield writer
+
+
+def node_path(node_name):
+    """Normalises a writer NodeName to a path relative to the top."""
+    name = node_name.split('::')[-1].lstrip('\\')
+    if name.upper().startswith('TOP'):
+        name = name[3:]
+    return name.lstrip('.:')
+
+
+def structure_paths(path):
+    """Gets the paths of the structure nodes which contain a node."""
+    parents = []
+    for index, char in enumerate(path):
+        if char in '.:':
+            parents.append(path[:index])
+    return parents
+
+
+def suggested_writes(bytes_per_write, segment_bytes):
+    """Number of writes per segment: a power of 2 close to segment_bytes."""
+    writes = max(1, segment_bytes // max(1, bytes_per_write))
+    power = 1
+    while power * 2 <= writes:
+        power *= 2
+    return power
+
+
+def collect_nodes(cfg, segment_bytes):
+    """Gets the trees and, for each tree, the nodes with their settings."""
+    trees = {}
+    for writer_path, writer in find_writers(cfg):
+        tree_name = get(writer, 'TreeName')
+        signals = get(writer, 'Signals', [])
+        if tree_name is None:
+            print('%s has no TreeName, skipped' % writer_path)
+            continue
+        nodes = trees.setdefault(tree_name.lower(), {})
+        for signal_name, signal in signals:
+            node_name = get(signal, 'NodeName')
+            if node_name is None:
+                continue
+            signal_type = get(signal, 'Type', 'uint32')
+            elements = int(get(signal, 'NumberOfElements', '1'))
+            bytes_per_write = elements * TYPE_SIZES.get(signal_type, 8)
+            writes = get(signal, 'MakeSegmentAfterNWrites')
+            automatic = get(signal, 'AutomaticSegmentation', '0') != '0'
+            compress = not signal_type.startswith('float')
+            settings = {
+                'signal': '%s.%s' % (writer_path, signal_name),
+                'type': signal_type,
+                'elements': elements,
+                'bytes_per_write': bytes_per_write,
+                'writes': None if writes is None else int(writes),
+                'automatic': automatic,
+                'suggested': suggested_writes(bytes_per_write, segment_bytes),
+                'compress': compress,
+            }
+            for name in (node_name, get(signal, 'DecimatedNodeName')):
+                if name is None:
+                    continue
+                path = node_path(name)
+                previous = nodes.get(path)
+                if previous is not None and previous['signal'] != settings['signal']:
+                    print('Warning: %s is written by %s and %s' % (path, previous['signal'], settings['signal']))
+                nodes[path] = settings
+    return trees
+
+
+def report(trees):
+    for tree_name, nodes in sorted(trees.items()):
+        print('Tree %s' % tree_name)
+        print('  %-24s %-8s %8s %8s %10s %10s %s' % ('Node', 'Type', 'Elements', 'Bytes', 'NWrites', 'Suggested', 'Compress'))
+        for path, settings in sorted(nodes.items()):
+            writes = 'auto' if settings['automatic'] else str(settings['writes'])
+            flag = ''
+            if not settings['automatic'] and settings['writes'] is not None:
+                ratio = float(settings['writes']) / settings['suggested']
+                if ratio < 0.25 or ratio > 4.0:
+                    flag = ' <- MakeSegmentAfterNWrites = %d suggested' % settings['suggested']
+            print('  %-24s %-8s %8d %8d %10s %10d %s%s' % (path, settings['type'], settings['elements'], settings['bytes_per_write'], writes,
+                                                       settings['suggested'], 'yes' if settings['compress'] else 'no', flag))
+
+
+def create_trees(trees, tree_path):
+    import MDSplus as mds
+    for tree_name, nodes in sorted(trees.items()):
+        os.environ[tree_name + '_path'] = tree_path
+        tree = mds.Tree(tree_name, -1, 'NEW')
+        created = set()
+        for path, settings in sorted(nodes.items()):
+            for parent in structure_paths(path):
+                if parent not in created:
+                    tree.addNode(parent, 'STRUCTURE')
+                    created.add(parent)
+            node = tree.addNode(path, 'SIGNAL')
+            created.add(path)
+            node.compress_segments = settings['compress']
+            node.compress_on_put = settings['compress']
+            node.do_not_compress = not settings['compress']
+        tree.write()
+        print('Created %s in %s' % (tree_name, tree_path))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Creates the MDSplus trees of the MDSWriters and MDSSegmentWriters of a MARTe2 configuration.')
+    parser.add_argument('cfg', help='the MARTe2 configuration file')
+    parser.add_argument('--path', default=os.getcwd(), help='directory of the trees (default: current directory)')
+    parser.add_argument('--segment-bytes', type=int, default=65536, help='target size of a segment in bytes (default: 65536)')
+    parser.add_argument('--dry-run', action='store_true', help='only print the nodes, do not create the trees')
+    args = parser.parse_args()
+
+    with open(args.cfg) as cfg_file:
+        cfg = parse_cfg(cfg_file.read())
+    trees = collect_nodes(cfg, args.segment_bytes)
+    if not trees:
+        print('No MDSWriter or MDSSegmentWriter found in %s' % args.cfg)
+        return 1
+    report(trees)
+    if not args.dry_run:
+        create_trees(trees, os.path.abspath(args.path))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())